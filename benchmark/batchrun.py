@@ -19,6 +19,7 @@ from catalyst_benchmark.toplevel import (
     SYSHASH_ORIG,
     SYSINFO,
     collect,
+    compare,
     load,
     plot,
     syshash,
@@ -37,3 +38,6 @@ if "plot" in a.actions:
     plot(a, df, sysinfo)
 else:
     print("Skipping the 'plot' action")
+if "compare" in a.actions:
+    # Exit with a non-zero code on regressions so that the comparison could gate a CI job
+    sys.exit(1 if compare(a) > 0 else 0)
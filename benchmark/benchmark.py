@@ -23,6 +23,7 @@ from traceback import print_exc
 import numpy as np
 from catalyst_benchmark.measurements import (
     REGISTRY,
+    SCALING_PROBLEMS,
     BenchmarkResult,
     parse_args,
     parse_implementation,
@@ -44,7 +45,8 @@ runcmd = apcmds.add_parser("run",
 runcmd.add_argument("--timeout", type=str, metavar="SEC", default="inf",
                     help="Timeout (default - not set)")
 runcmd.add_argument("-p", "--problem", type=str, required=True,
-                    help="Problem to run (?|grover|vqe)")
+                    help="Problem to run (?|grover|chemvqe|qft|sampling|hamiltonian|dynqubits|"
+                    "mcm|async)")
 runcmd.add_argument("-m", "--measure", type=str, required=True,
                     help="Value to measure (?|compile|runtime)")
 runcmd.add_argument("-i", "--implementation", type=str, required=True,
@@ -59,7 +61,9 @@ runcmd.add_argument("--numerical-check", default=False, action=BooleanOptionalAc
 runcmd.add_argument("-N", "--nqubits", type=int, default=11, metavar="INT",
                     help="Number of qubits")
 runcmd.add_argument("-L","--nlayers", type=int, default=None, metavar="INT",
-                    help="Number of layers, problem-specific (default - auto)")
+                    help="Number of layers, problem-specific (default - auto). For the scaling "
+                    "problems: the number of shots (sampling), Hamiltonian terms (hamiltonian), "
+                    "layers (dynqubits), measurement loop iterations (mcm) or QNodes (async)")
 runcmd.add_argument("--vqe-diff-method", type=str, default="finite-diff",
                     help="VQE-specific: Differentiation method (default - backprop)")
 # fmt: on
@@ -73,7 +77,8 @@ elif a.command == "run":
     should_exit = False
     if a.problem == "?":
         print("problems:")
-        print("\n".join(sorted(["- grover", "- vqe", "- chemvqe"])))
+        problems = ["grover", "vqe", "chemvqe", "qft", *SCALING_PROBLEMS]
+        print("\n".join(sorted("- " + x for x in problems)))
         should_exit = True
     if a.measure == "?":
         print("measurements:")
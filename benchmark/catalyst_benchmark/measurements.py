@@ -24,6 +24,7 @@ from argparse import ArgumentParser
 from argparse import Namespace as ParsedArguments
 from contextlib import contextmanager
 from functools import partial
+from resource import RUSAGE_SELF, getrusage
 from signal import ITIMER_REAL, SIGALRM, setitimer, signal
 from time import time
 from typing import List, Optional, Tuple
@@ -79,6 +80,62 @@ def printerr(*args, **kwargs) -> None:
     print(*args, **kwargs, file=sys.stderr)
 
 
+SCALING_PROBLEMS = ["sampling", "hamiltonian", "dynqubits", "mcm", "async"]
+
+
+def scaling_problem_catalyst(a: ParsedArguments, **qnode_kwargs):
+    """Instantiate a Catalyst scaling problem. The problem-specific size is passed as `nlayers`."""
+    import pennylane as qml
+    from catalyst_benchmark.test_cases.scaling_catalyst import PROBLEMS
+
+    shots = a.nlayers if a.problem == "sampling" else None
+    dev = qml.device("lightning.qubit", wires=a.nqubits, shots=shots)
+    return PROBLEMS[a.problem](dev, a.nlayers, **qnode_kwargs)
+
+
+def reset_peak_rss() -> None:
+    """Reset the memory high-water mark of the current process, so that it only covers the
+    measurements that follow rather than the imports and the preparation of the problem. Only
+    supported on Linux, elsewhere the high-water mark covers the whole process."""
+    try:
+        with open("/proc/self/clear_refs", "w", encoding="utf-8") as f:
+            f.write("5")
+    except OSError:
+        pass
+
+
+def peak_rss_mb() -> float:
+    """Memory high-water mark of the current process since the last `reset_peak_rss`, MB"""
+    try:
+        with open("/proc/self/status", "r", encoding="utf-8") as f:
+            for line in f:
+                if line.startswith("VmHWM:"):
+                    return int(line.split()[1]) / 1024.0
+    except OSError:
+        pass
+    return getrusage(RUSAGE_SELF).ru_maxrss / 1024.0
+
+
+def throughput_metrics(times: List[float], ngates: Optional[int], nshots: int = 0) -> dict:
+    """Compute throughput metrics from the median of the measured times: gates and shots per
+    second, plus the memory high-water mark of the measurements (see `reset_peak_rss`)."""
+    metrics = {"maxrss_mb": peak_rss_mb()}
+    tmed = float(np.median(times)) if times else 0.0
+    if tmed > 0:
+        if ngates:
+            metrics["gates_per_sec"] = ngates / tmed
+        if nshots:
+            metrics["shots_per_sec"] = nshots / tmed
+    return metrics
+
+
+def flatten_result(r) -> list:
+    """Flatten a (possibly nested) workflow result into a list of numbers"""
+    if isinstance(r, (tuple, list)):
+        return np.concatenate([np.ravel(np.asarray(x)) for x in r]).tolist()
+    return np.ravel(np.asarray(r)).tolist()
+
+
 def parse_implementation(implementation: str) -> Tuple[str, str, Optional[str]]:
     """Parse the implementation parameter, expect the "framework[+jax]/device" syntax."""
     tokens = implementation.split("/")
@@ -164,6 +221,10 @@ def measure_compile_catalyst(a: ParsedArguments) -> BenchmarkResult:
         p = Problem(
             qml.device("lightning.qubit", wires=a.nqubits), a.nlayers, expansion_strategy="device"
         )
+    elif a.problem in SCALING_PROBLEMS:
+        from catalyst_benchmark.test_cases.scaling_catalyst import qcompile, workflow
+
+        p = scaling_problem_catalyst(a, expansion_strategy="device")
     else:
         raise NotImplementedError(f"Unsupported problem {a.problem}")
 
@@ -173,19 +234,27 @@ def measure_compile_catalyst(a: ParsedArguments) -> BenchmarkResult:
         qcompile(p, weights)
         return workflow(p, weights)
 
+    reset_peak_rss()
     times = []
     for i in range(a.niter):
         weights = p.trial_params(i)
 
         b = time()
-        jit_main = qjit(_main)
+        jit_main = qjit(_main, async_qnodes=a.problem == "async")
         e = time()
         times.append(e - b)
 
-    r = jit_main(weights).tolist() if a.numerical_check else None
+    r = flatten_result(jit_main(weights)) if a.numerical_check else None
 
     return BenchmarkResult.fromMeasurements(
-        r, a.argv, prep=None, times=times, depth=None, versions=versions, timeout=a.timeout
+        r,
+        a.argv,
+        prep=None,
+        times=times,
+        depth=None,
+        versions=versions,
+        timeout=a.timeout,
+        metrics=throughput_metrics(times, None),
     )
 
 
@@ -238,6 +307,10 @@ def measure_runtime_catalyst(a: ParsedArguments) -> BenchmarkResult:
             qml.device("lightning.qubit", wires=a.nqubits),
             a.nlayers,
         )
+    elif a.problem in SCALING_PROBLEMS:
+        from catalyst_benchmark.test_cases.scaling_catalyst import qcompile, size, workflow
+
+        p = scaling_problem_catalyst(a)
     else:
         raise NotImplementedError(f"Unsupported problem {a.problem}")
 
@@ -248,11 +321,13 @@ def measure_runtime_catalyst(a: ParsedArguments) -> BenchmarkResult:
         return workflow(p, weights)
 
     b = time()
-    jit_main = qjit(_main)
+    jit_main = qjit(_main, async_qnodes=a.problem == "async")
     e = time()
     cmptime = e - b
 
+    reset_peak_rss()
     times = []
+    results = []
     for i in range(a.niter):
         weights = p.trial_params(i)
 
@@ -260,9 +335,23 @@ def measure_runtime_catalyst(a: ParsedArguments) -> BenchmarkResult:
         r = jit_main(weights)
         e = time()
         times.append(e - b)
+        results.append(r)
 
+    depth = (
+        round(np.mean([size(p, result) for result in results]))
+        if a.problem in SCALING_PROBLEMS
+        else None
+    )
+    nshots = p.nshots() if a.problem in SCALING_PROBLEMS else 0
     return BenchmarkResult.fromMeasurements(
-        r.tolist(), a.argv, cmptime, times, depth=None, versions=versions, timeout=a.timeout
+        flatten_result(r),
+        a.argv,
+        cmptime,
+        times,
+        depth=depth,
+        versions=versions,
+        timeout=a.timeout,
+        metrics=throughput_metrics(times, depth, nshots),
     )
 
 
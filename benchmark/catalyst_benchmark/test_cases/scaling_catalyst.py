@@ -0,0 +1,232 @@
+# Copyright 2024 Xanadu Quantum Technologies Inc.
+
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+
+#     http://www.apache.org/licenses/LICENSE-2.0
+
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+""" Scaling problems (many shots, large Hamiltonians, dynamic wires, mid-circuit measurement loops
+and async QNodes), PennyLane+Catalyst implementation. Every problem is parameterized by the number
+of qubits and by a single problem-specific size passed as `nlayers`. """
+
+# pylint: disable=too-many-arguments
+# pylint: disable=unused-argument
+
+from dataclasses import dataclass
+
+import jax.numpy as jnp
+import numpy as np
+import pennylane as qml
+from catalyst_benchmark.types import Problem
+
+from catalyst import cond, for_loop, measure
+
+PAULIS = [qml.PauliX, qml.PauliY, qml.PauliZ]
+
+
+def _layer(params, nqubits, shift=0):
+    """A layer of single-qubit rotations followed by a ring of CNOTs. Contributes `2 * nqubits`
+    gates."""
+
+    @for_loop(0, nqubits, 1)
+    def rotations(i):
+        qml.RY(params[(i + shift) % params.shape[0]], wires=i)
+
+    rotations()
+
+    @for_loop(0, nqubits, 1)
+    def ring(i):
+        qml.CNOT(wires=[i, (i + 1) % nqubits])
+
+    ring()
+
+
+@dataclass
+class ProblemScaling(Problem):
+    """Base class of the scaling problems. `size` is the problem-specific scale: the number of
+    shots, of Hamiltonian terms, of loop iterations or of QNodes."""
+
+    def __init__(self, dev, size=None, **qnode_kwargs):
+        super().__init__(dev, **qnode_kwargs)
+        self.size = size if size else 1
+        self.qcircuit = None
+
+    def trial_params(self, i: int):
+        rng = np.random.default_rng(i)
+        return jnp.array(rng.uniform(0, 2 * np.pi, size=self.nqubits), dtype=jnp.float64)
+
+    def ngates(self, result=None) -> int:
+        """The number of gates applied by one run of the workflow, which returned `result`"""
+        raise NotImplementedError()
+
+    def nshots(self) -> int:
+        """The number of shots taken by one run of the workflow"""
+        return 0
+
+
+class ProblemSampling(ProblemScaling):
+    """Many-shot sampling: `size` is the number of shots."""
+
+    def ngates(self, result=None) -> int:
+        return 2 * self.nqubits
+
+    def nshots(self) -> int:
+        return self.size
+
+
+class ProblemHamiltonian(ProblemScaling):
+    """Analytic expectation value of a random Pauli Hamiltonian: `size` is the number of terms."""
+
+    def __init__(self, dev, size=None, **qnode_kwargs):
+        super().__init__(dev, size, **qnode_kwargs)
+        rng = np.random.default_rng(42)
+        coeffs = rng.uniform(-1, 1, size=self.size)
+        ops = []
+        for _ in range(self.size):
+            wires = rng.choice(self.nqubits, size=min(4, self.nqubits), replace=False)
+            term = None
+            for w in wires:
+                p = PAULIS[rng.integers(len(PAULIS))](int(w))
+                term = p if term is None else term @ p
+            ops.append(term)
+        self.hamiltonian = qml.Hamiltonian(coeffs, ops)
+
+    def ngates(self, result=None) -> int:
+        return 2 * self.nqubits
+
+
+class ProblemDynamicQubits(ProblemScaling):
+    """Gates on wires computed at runtime: `size` is the number of layers."""
+
+    def ngates(self, result=None) -> int:
+        return 2 * self.nqubits * self.size
+
+
+class ProblemMCM(ProblemScaling):
+    """Loop of mid-circuit measurements with reset and feed-forward: `size` is the number of
+    iterations."""
+
+    def ngates(self, result=None) -> int:
+        # Besides the layer and the RX gate of every iteration, each measured 1 applies the
+        # PauliX gate of the reset and the one of the feed-forward. The workflow returns the
+        # number of measured 1s.
+        _, ones = result
+        return 2 * self.nqubits + self.size + 2 * int(ones)
+
+
+class ProblemAsync(ProblemScaling):
+    """Independent QNodes executed with `async_qnodes`: `size` is the number of QNodes."""
+
+    def ngates(self, result=None) -> int:
+        return 2 * self.nqubits * self.size
+
+
+PROBLEMS = {
+    "sampling": ProblemSampling,
+    "hamiltonian": ProblemHamiltonian,
+    "dynqubits": ProblemDynamicQubits,
+    "mcm": ProblemMCM,
+    "async": ProblemAsync,
+}
+
+
+def qcompile(p: ProblemScaling, params):
+    """Compile the quantum parts of the problem"""
+    # pylint: disable=no-value-for-parameter
+    del params
+    N = p.nqubits
+    S = p.size
+
+    if isinstance(p, ProblemSampling):
+
+        def _circuit(params):
+            _layer(params, N)
+            return qml.sample()
+
+    elif isinstance(p, ProblemHamiltonian):
+
+        def _circuit(params):
+            _layer(params, N)
+            return qml.expval(p.hamiltonian)
+
+    elif isinstance(p, ProblemDynamicQubits):
+
+        def _circuit(params):
+            @for_loop(0, S, 1)
+            def layers(l):
+                @for_loop(0, N, 1)
+                def rotations(i):
+                    # The wire depends on the loop iteration and is only known at runtime
+                    qml.RY(params[i], wires=(i + l) % N)
+
+                rotations()
+
+                @for_loop(0, N, 1)
+                def ring(i):
+                    qml.CNOT(wires=[(i + l) % N, (i + l + 1) % N])
+
+                ring()
+
+            layers()
+            return qml.expval(qml.PauliZ(0))
+
+    elif isinstance(p, ProblemMCM):
+
+        def _circuit(params):
+            _layer(params, N)
+
+            @for_loop(0, S, 1)
+            def loop(i, acc):
+                w = i % N
+                qml.RX(params[w], wires=w)
+                m = measure(w, reset=True)
+
+                @cond(m)
+                def feed_forward():
+                    qml.PauliX(wires=(w + 1) % N)
+
+                feed_forward()
+                return acc + m
+
+            ones = loop(0)
+            return qml.expval(qml.PauliZ(0)), ones
+
+    elif isinstance(p, ProblemAsync):
+
+        def _single(params):
+            _layer(params, N)
+            return qml.expval(qml.PauliZ(0))
+
+        qnodes = [
+            qml.QNode(lambda params, k=k: _single(jnp.roll(params, k)), p.dev, **p.qnode_kwargs)
+            for k in range(S)
+        ]
+
+        def _circuit(params):
+            return jnp.array([qn(params) for qn in qnodes])
+
+        p.qcircuit = _circuit
+        return p
+
+    else:
+        raise NotImplementedError(f"Unsupported problem {p}")
+
+    p.qcircuit = qml.QNode(_circuit, p.dev, **p.qnode_kwargs)
+    return p
+
+
+def workflow(p: ProblemScaling, params):
+    """Problem workflow"""
+    return p.qcircuit(params)
+
+
+def size(p: ProblemScaling, result=None) -> int:
+    """Compute the size of the problem circuit in gates, for the run of the workflow which
+    returned `result`"""
+    return p.ngates(result)
@@ -22,6 +22,7 @@ from copy import deepcopy
 from functools import partial
 from hashlib import sha256
 from itertools import chain
+from json import dump as json_dump
 from json import load as json_load
 from os import makedirs
 from os.path import dirname, isfile, join
@@ -29,6 +30,7 @@ from subprocess import run as subprocess_run
 from typing import Iterable, List, Optional, Set, Tuple, Union
 
 import altair as alt
+import numpy as np
 import pandas as pd
 import vl_convert as vlc
 from altair import Chart
@@ -75,6 +77,12 @@ CATPROBLEMS = {
     "deep": ["grover"],
     # "hybrid": [None],
     "variational": ["chemvqe"],
+    "scaling": ["sampling", "hamiltonian", "dynqubits", "mcm", "async"],
+}
+
+# Categories which are only implemented for a subset of IMPLEMENTATIONS
+CATIMPLEMENTATIONS = {
+    "scaling": ["catalyst/lightning.qubit"],
 }
 
 QUBITS = {
@@ -90,6 +98,16 @@ QUBITS = {
     ("variational", "vqe", "runtime"): [6, 7, 8, 9, 10, 11, 12, 13, 14, 15],
     ("variational", "chemvqe", "compile"): [4, 6, 8, 12],
     ("variational", "chemvqe", "runtime"): [4, 6, 8, 12],
+    ("scaling", "sampling", "compile"): [24],
+    ("scaling", "sampling", "runtime"): [16, 20, 24, 26, 28, 30],
+    ("scaling", "hamiltonian", "compile"): [24],
+    ("scaling", "hamiltonian", "runtime"): [16, 20, 24, 26, 28],
+    ("scaling", "dynqubits", "compile"): [24],
+    ("scaling", "dynqubits", "runtime"): [16, 20, 24, 26, 28],
+    ("scaling", "mcm", "compile"): [24],
+    ("scaling", "mcm", "runtime"): [16, 20, 24, 26],
+    ("scaling", "async", "compile"): [20],
+    ("scaling", "async", "runtime"): [16, 20, 24],
 }
 
 MAXLAYERS = 1500
@@ -102,6 +120,24 @@ LAYERS = {
         [10, 100, 200, 300, 400, 500, 600, 700, 800, 900, 1000, 1100, 1200, 1300, 1400, MAXLAYERS],
     ("deep", "qft", "runtime"):
         [10, 100, 200, 300, 400, 500, 600, 700, 800, 900, 1000, 1100, 1200, 1300, 1400, MAXLAYERS],
+    # The scaling problems use the layers as their problem-specific size, see `benchmark.py -h`
+    ("scaling", "sampling", "compile"): [1000],
+    ("scaling", "sampling", "runtime"): [1000, 10000, 100000, 1000000],
+    ("scaling", "hamiltonian", "compile"): [10, 100, 1000],
+    ("scaling", "hamiltonian", "runtime"): [10, 100, 1000],
+    ("scaling", "dynqubits", "compile"): [10, 100],
+    ("scaling", "dynqubits", "runtime"): [10, 100],
+    ("scaling", "mcm", "compile"): [10, 100],
+    ("scaling", "mcm", "runtime"): [10, 100, 1000],
+    ("scaling", "async", "compile"): [2, 8],
+    ("scaling", "async", "runtime"): [2, 4, 8],
+}
+
+# Throughput metrics reported by the scaling problems, with their titles
+METRICS = {
+    "shots_per_sec": "Shots per second",
+    "gates_per_sec": "Gates per second",
+    "maxrss_mb": "Memory high-water mark, MB",
 }
 
 KNOWN_FAILURES = {
@@ -160,6 +196,9 @@ def ofile(  # pylint: disable=too-many-arguments
         assert nlayers is None
         assert diffmethod is None
         params = []
+    elif problem in CATPROBLEMS["scaling"]:
+        assert diffmethod is None
+        params = [f"--nlayers={nlayers}"] if nlayers is not None else []
     else:
         raise ValueError(f"Unsupported problem {problem}")
     cmdline = [
@@ -187,11 +226,13 @@ def all_configurations(a: ParsedArguments) -> Iterable[tuple]:
     # pylint: disable=too-many-nested-blocks
     for measure in MEASUREMENTS:
         for impl in IMPLEMENTATIONS:
-            for cat in ["regular", "deep", "hybrid", "variational"]:
+            for cat in ["regular", "deep", "hybrid", "variational", "scaling"]:
                 if not any((m in a.measure.split(",")) for m in [measure, "all"]):
                     continue
                 if not any((c in a.category.split(",")) for c in [cat, "all"]):
                     continue
+                if impl not in CATIMPLEMENTATIONS.get(cat, IMPLEMENTATIONS):
+                    continue
 
                 for problem in CATPROBLEMS.get(cat, [None]):
                     if problem is None:
@@ -304,6 +345,9 @@ def load(a: ParsedArguments) -> Tuple[DataFrame, Optional[Sysinfo]]:
                     else (float(a.timeout_1run) if a.timeout_1run else 1e9)
                 )
                 data["timeout"].append(timeout_ntrials / len(r.measurement_sec))
+                metrics = getattr(r, "metrics", None) or {}
+                for metric in METRICS:
+                    data[metric].append(metrics.get(metric))
                 systems.add(r.sysinfo)
     if nmissing > 0:
         print(f"There are {nmissing} data records missing", file=sys.stderr)
@@ -317,6 +361,95 @@ def load(a: ParsedArguments) -> Tuple[DataFrame, Optional[Sysinfo]]:
     return DataFrame(data), (list(systems)[0] if len(systems) > 0 else None)
 
 
+def median_ratio_ci(
+    base: List[float], new: List[float], confidence: float, nboot: int, seed: int = 0
+) -> Tuple[float, float, float]:
+    """Ratio of the medians of the `new` and the `base` samples along with its bootstrap
+    confidence interval. Ratios greater than one mean that `new` is slower."""
+    rng = np.random.default_rng(seed)
+    b, n = np.asarray(base, dtype=float), np.asarray(new, dtype=float)
+    ratio = float(np.median(n) / np.median(b))
+    bs = np.median(rng.choice(b, size=(nboot, len(b))), axis=1)
+    ns = np.median(rng.choice(n, size=(nboot, len(n))), axis=1)
+    alpha = (1.0 - confidence) / 2.0
+    lo, hi = np.quantile(ns / bs, [alpha, 1.0 - alpha])
+    return ratio, float(lo), float(hi)
+
+
+def compare(a: ParsedArguments) -> int:
+    """Compare the measurements tagged with `--tag` against the baseline measurements tagged with
+    `--baseline-tag`. A configuration regresses if the lower bound of the confidence interval of
+    the median time ratio exceeds `1 + threshold`. Return the number of regressions."""
+    # pylint: disable=broad-except,broad-exception-caught,too-many-locals
+    abase = deepcopy(a)
+    abase.tag = a.baseline_tag
+    abase.force_sysinfo_hash = a.baseline_sysinfo_hash or a.force_sysinfo_hash
+
+    rows = []
+    nmissing = 0
+    for config in all_configurations(a):
+        cat, measure, problem, impl, nqubits, nlayers, diffmethod = config
+        try:
+            rnew = loadresults(ofile(a, *config)[0])
+            rbase = loadresults(ofile(abase, *config)[0])
+        except Exception:
+            nmissing += 1
+            continue
+        if not rnew.measurement_sec or not rbase.measurement_sec:
+            nmissing += 1
+            continue
+
+        ratio, lo, hi = median_ratio_ci(
+            rbase.measurement_sec, rnew.measurement_sec, a.compare_confidence, a.compare_nbootstrap
+        )
+        if lo > 1.0 + a.compare_threshold:
+            status = "REGRESSION"
+        elif hi < 1.0 / (1.0 + a.compare_threshold):
+            status = "IMPROVEMENT"
+        else:
+            status = "OK"
+        rows.append(
+            {
+                "cat": cat,
+                "measure": measure,
+                "problem": problem,
+                "impl": impl,
+                "nqubits": nqubits,
+                "nlayers": nlayers,
+                "diffmethod": diffmethod,
+                "median_base_sec": float(np.median(rbase.measurement_sec)),
+                "median_new_sec": float(np.median(rnew.measurement_sec)),
+                "ratio": ratio,
+                "ratio_ci_low": lo,
+                "ratio_ci_high": hi,
+                "status": status,
+            }
+        )
+
+    for r in rows:
+        pdesc = f"{r['problem']}[{r['nqubits']},{r['nlayers']}]"
+        if r["diffmethod"] is not None:
+            pdesc += f"[{r['diffmethod']}]"
+        print(
+            f"{r['measure']: <8} {r['impl']: <32} {pdesc: <36} "
+            f"{r['median_base_sec']:10.4f}s -> {r['median_new_sec']:10.4f}s "
+            f"x{r['ratio']:.3f} [{r['ratio_ci_low']:.3f}, {r['ratio_ci_high']:.3f}] {r['status']}"
+        )
+
+    nregressions = sum(1 for r in rows if r["status"] == "REGRESSION")
+    print(
+        f"Compared {len(rows)} configurations of '{tag(a)}' against '{tag(abase)}': "
+        f"{nregressions} regression(s) beyond {a.compare_threshold:.0%}, "
+        f"{nmissing} configuration(s) without data on both sides"
+    )
+    if a.compare_output:
+        if len(dirname(a.compare_output)) > 0:
+            makedirs(dirname(a.compare_output), exist_ok=True)
+        with open(a.compare_output, "w", encoding="utf-8") as f:
+            json_dump(rows, f, indent=4)
+    return nregressions
+
+
 def writefile(a: ParsedArguments, fname, chart) -> None:
     """Write chart to file(s) in the configured formats"""
     # pylint: disable=no-member; `vlc` DOES HAVE `vegalite_to_{svg,png}`
@@ -672,6 +805,31 @@ def plot(a: ParsedArguments, df_full: DataFrame, sysinfo: Optional[Sysinfo] = No
                     .to_dict(),
                 )
 
+        # Scaling circuits, throughput metrics
+        for problem in CATPROBLEMS["scaling"]:
+            df = _filter("scaling", "runtime", problem)
+            if len(df) == 0:
+                continue
+            for metric, metric_title in METRICS.items():
+                df2 = df[df[metric].notnull()]
+                if len(df2) == 0:
+                    continue
+                writefile(
+                    a,
+                    f"_img/scaling_{problem}_{metric}",
+                    Chart(df2)
+                    .mark_line(point=True)
+                    .encode(
+                        x=_nqubitsEncoding(),
+                        y=alt.Y(
+                            f"mean({metric}):Q", title=metric_title, scale=alt.Scale(type="log")
+                        ),
+                        color=alt.Color("nlayers:N", title="Size"),
+                    )
+                    .properties(title=_mktitle(f"{metric_title}, Scaling circuits ({problem})"))
+                    .to_dict(),
+                )
+
         df = _filter("regular", "runtime", "chemvqe-hybrid")
         if len(df) > 0:
             df = _add_timeouts(df)
@@ -714,15 +872,16 @@ AP = ArgumentParser(prog="python3 batchrun.py")
 AP.add_argument("-m", "--measure", type=str, default="all",
                 help="Value to measure: compile|runtime|all, (default - 'all')")
 AP.add_argument("-c", "--category", type=str, default="regular,deep,variational",
-                help=("Category of circutis to evaluate regular|deep|hybrid|variational|all "
+                help=("Category of circutis to evaluate "
+                "regular|deep|hybrid|variational|scaling|all "
                 "(default - 'regular,deep,variational')"))
 AP.add_argument("-p", "--problems", type=str, default="all",
-                help=("Problems to evaluate: [(grover|chemvqe|chemvqe-hybrid|all),] "
-                "(default - 'all')"))
+                help=("Problems to evaluate: [(grover|chemvqe|chemvqe-hybrid|sampling|hamiltonian|"
+                "dynqubits|mcm|async|all),] (default - 'all')"))
 AP.add_argument("--dry-run", default=False, action=BooleanOptionalAction,
                 help="Enable this mode to print command lines but not actually run anything")
 AP.add_argument("-a", "--actions", type=str, default="collect,plot",
-                help="Which actions to perform (default - 'collect,plot')")
+                help="Which actions to perform: collect|plot|compare (default - 'collect,plot')")
 AP.add_argument("-t", "--timeout-1run", type=str, metavar="SEC", default="1000.0",
                 help="Timeout for single benchmark run (default - 1000)")
 AP.add_argument("--tag", type=str, default=None,
@@ -735,6 +894,20 @@ AP.add_argument("--plot-combine-adjoint-backprop", default=False, action=Boolean
                 help="Plot adjoint and backprop diff. methods on the same plot")
 AP.add_argument("-V", "--verbose", default=False, action=BooleanOptionalAction,
                 help="Print verbose messages")
+AP.add_argument("--baseline-tag", type=str, default=None,
+                help="Compare: tag of the baseline data records (default - the format version)")
+AP.add_argument("--baseline-sysinfo-hash", type=str, default=None,
+                help="Compare: sysinfo hash of the baseline data records (default - same as the "
+                "compared records)")
+AP.add_argument("--compare-threshold", type=float, default=0.1, metavar="FLOAT",
+                help="Compare: relative slowdown of the median time treated as a regression "
+                "(default - 0.1)")
+AP.add_argument("--compare-confidence", type=float, default=0.95, metavar="FLOAT",
+                help="Compare: confidence level of the bootstrap interval (default - 0.95)")
+AP.add_argument("--compare-nbootstrap", type=int, default=1000, metavar="INT",
+                help="Compare: number of bootstrap resamples (default - 1000)")
+AP.add_argument("--compare-output", type=str, default=None, metavar="FILE.json",
+                help="Compare: save the per-configuration deltas to a JSON file")
 # fmt: on
 
 
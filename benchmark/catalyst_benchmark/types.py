@@ -107,6 +107,9 @@ class BenchmarkResult(BenchmarkResultV1):
                      time measurements this field is not used.
         measurement_sec: List of main measurement results
         versions: Dictionary specifying versions of important Python packages
+        timeout_sec: Timeout of the whole measurement (if set)
+        metrics: Throughput metrics such as `gates_per_sec`, `shots_per_sec` and `maxrss_mb`
+                 (if available)
 
     Notes:
     * We do not override the __init__ in order to make automatic JSON
@@ -118,6 +121,7 @@ class BenchmarkResult(BenchmarkResultV1):
 
     versions: Dict[str, str]
     timeout_sec: Optional[float]
+    metrics: Optional[Dict[str, float]] = None
 
     @classmethod
     def fromMeasurements(
@@ -129,6 +133,7 @@ class BenchmarkResult(BenchmarkResultV1):
         depth: Optional[int],
         versions: Dict[str, str],
         timeout: Optional[float],
+        metrics: Optional[Dict[str, float]] = None,
     ):  # pylint: disable=too-many-arguments
         """Format the measurement results"""
         return BenchmarkResult(
@@ -140,6 +145,7 @@ class BenchmarkResult(BenchmarkResultV1):
             times,
             versions,
             float(timeout),
+            metrics,
         )
 
 
@@ -0,0 +1,340 @@
+# Copyright 2024 Xanadu Quantum Technologies Inc.
+
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+
+#     http://www.apache.org/licenses/LICENSE-2.0
+
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+""" Compiler throughput benchmark: time and memory of every default pipeline applied to
+synthetic Quantum-dialect modules of growing size. """
+import os
+import sys
+from argparse import ArgumentParser
+from json import dump as json_dump
+from os.path import abspath, dirname, isfile, join
+from shutil import which
+from subprocess import Popen
+from tempfile import TemporaryDirectory
+from time import perf_counter
+from typing import Iterator, List, Tuple
+
+from catalyst.compiler import DEFAULT_ASYNC_PIPELINES, DEFAULT_PIPELINES
+
+# Gates applied in every loop body and in every QNode of the non-`gates` families.
+BLOCK_SIZE = 8
+
+FAMILIES = {
+    "gates": "one QNode with SIZE gates",
+    "loops": f"one QNode with SIZE scf.for loops of {BLOCK_SIZE} gates",
+    "qnodes": f"SIZE QNodes of {BLOCK_SIZE} gates called from the entry point",
+    "grad-adjoint": "gradient.grad of a QNode with SIZE gates, adjoint method",
+    "grad-ps": "gradient.grad of a QNode with SIZE gates, parameter-shift method",
+    "grad-fd": "gradient.grad of a QNode with SIZE gates, finite-difference method",
+    "zne": "mitigation.zne of a QNode with SIZE gates",
+}
+
+DIFF_METHODS = {
+    "grad-adjoint": ("adjoint", "auto"),
+    "grad-ps": ("parameter-shift", "auto"),
+    "grad-fd": ("finite-diff", "fd"),
+}
+
+
+class _Emitter:
+    """Accumulate MLIR text and hand out unique SSA names."""
+
+    def __init__(self):
+        self.lines = []
+        self.counter = 0
+
+    def fresh(self, prefix="v"):
+        """Return a new SSA value name."""
+        self.counter += 1
+        return f"%{prefix}{self.counter}"
+
+    def __call__(self, line):
+        self.lines.append(line)
+
+
+def _emit_gates(e: _Emitter, indent, reg, nwires, ngates, params, nparams) -> str:
+    """Extract all qubits of `reg`, apply `ngates` gates cycling over the wires and insert the
+    qubits back. Return the SSA name of the resulting register."""
+    qubits = []
+    for w in range(nwires):
+        q = e.fresh("q")
+        e(f"{indent}{q} = quantum.extract {reg}[{w}] : !quantum.reg -> !quantum.bit")
+        qubits.append(q)
+
+    for g in range(ngates):
+        w = g % nwires
+        if g % 3 == 2 and nwires > 1:
+            t = (w + 1) % nwires
+            a, b = e.fresh("q"), e.fresh("q")
+            e(
+                f'{indent}{a}, {b} = quantum.custom "CNOT"() {qubits[w]}, {qubits[t]}'
+                " : !quantum.bit, !quantum.bit"
+            )
+            qubits[w], qubits[t] = a, b
+        else:
+            q = e.fresh("q")
+            gate = "RX" if g % 2 else "RZ"
+            e(
+                f'{indent}{q} = quantum.custom "{gate}"({params[g % nparams]}) {qubits[w]}'
+                " : !quantum.bit"
+            )
+            qubits[w] = q
+
+    for w, q in enumerate(qubits):
+        r = e.fresh("r")
+        e(f"{indent}{r} = quantum.insert {reg}[{w}], {q} : !quantum.reg, !quantum.bit")
+        reg = r
+    return reg
+
+
+def _emit_qnode(e: _Emitter, name, nwires, nparams, ngates, nloops=0, diff_method=None):
+    """Emit a QNode taking a `tensor<nparams x f64>` and returning an expectation value."""
+    attrs = "qnode" if diff_method is None else f'qnode, diff_method = "{diff_method}"'
+    e(f"func.func private @{name}(%arg0: tensor<{nparams}xf64>) -> f64 attributes {{{attrs}}} {{")
+    e('    quantum.device ["rtd_lightning.so", "LightningQubit", "{shots: 0}"]')
+    params = []
+    for p in range(nparams):
+        c, t = e.fresh("c"), e.fresh("p")
+        e(f"    {c} = arith.constant {p} : index")
+        e(f"    {t} = tensor.extract %arg0[{c}] : tensor<{nparams}xf64>")
+        params.append(t)
+    reg = e.fresh("r")
+    e(f"    {reg} = quantum.alloc({nwires}) : !quantum.reg")
+
+    if nloops:
+        lb, ub, step = e.fresh("c"), e.fresh("c"), e.fresh("c")
+        e(f"    {lb} = arith.constant 0 : index")
+        e(f"    {ub} = arith.constant 2 : index")
+        e(f"    {step} = arith.constant 1 : index")
+        for _ in range(nloops):
+            out, it, rin = e.fresh("r"), e.fresh("i"), e.fresh("r")
+            e(
+                f"    {out} = scf.for {it} = {lb} to {ub} step {step} "
+                f"iter_args({rin} = {reg}) -> (!quantum.reg) {{"
+            )
+            body = _emit_gates(e, " " * 8, rin, nwires, BLOCK_SIZE, params, nparams)
+            e(f"        scf.yield {body} : !quantum.reg")
+            e("    }")
+            reg = out
+    else:
+        reg = _emit_gates(e, " " * 4, reg, nwires, ngates, params, nparams)
+
+    q, obs, res = e.fresh("q"), e.fresh("o"), e.fresh("e")
+    e(f"    {q} = quantum.extract {reg}[0] : !quantum.reg -> !quantum.bit")
+    e(f"    {obs} = quantum.namedobs {q}[PauliZ] : !quantum.obs")
+    e(f"    {res} = quantum.expval {obs} : f64")
+    e(f"    quantum.dealloc {reg} : !quantum.reg")
+    e("    quantum.device_release")
+    e(f"    return {res} : f64")
+    e("}")
+
+
+def generate_module(family: str, size: int, nwires: int) -> str:
+    """Generate a synthetic module of the given family whose size grows linearly with `size`."""
+    assert family in FAMILIES, f"Unknown family {family}"
+    nparams = min(size, 16) if family != "qnodes" else BLOCK_SIZE
+    e = _Emitter()
+    e(f"module @bench_{family.replace('-', '_')}_{size} {{")
+
+    if family == "qnodes":
+        for i in range(size):
+            _emit_qnode(e, f"circuit{i}", nwires, nparams, BLOCK_SIZE)
+        ret_type = "f64"
+    elif family == "loops":
+        _emit_qnode(e, "circuit0", nwires, nparams, 0, nloops=size)
+        ret_type = "f64"
+    elif family in DIFF_METHODS:
+        _emit_qnode(e, "circuit0", nwires, nparams, size, diff_method=DIFF_METHODS[family][0])
+        ret_type = f"tensor<{nparams}xf64>"
+    elif family == "zne":
+        _emit_qnode(e, "circuit0", nwires, nparams, size)
+        ret_type = "tensor<3xf64>"
+    else:
+        _emit_qnode(e, "circuit0", nwires, nparams, size)
+        ret_type = "f64"
+
+    arg_type = f"tensor<{nparams}xf64>"
+    e(
+        f"func.func public @jit_bench(%arg0: {arg_type}) -> {ret_type}"
+        " attributes {llvm.emit_c_interface} {"
+    )
+    if family == "qnodes":
+        acc = None
+        for i in range(size):
+            r = e.fresh("e")
+            e(f"    {r} = func.call @circuit{i}(%arg0) : ({arg_type}) -> f64")
+            if acc is not None:
+                s = e.fresh("s")
+                e(f"    {s} = arith.addf {acc}, {r} : f64")
+                r = s
+            acc = r
+        e(f"    return {acc} : f64")
+    elif family in DIFF_METHODS:
+        method = DIFF_METHODS[family][1]
+        e(f'    %0 = gradient.grad "{method}" @circuit0(%arg0) : ({arg_type}) -> {ret_type}')
+        e(f"    return %0 : {ret_type}")
+    elif family == "zne":
+        e("    %sf = arith.constant dense<[1, 2, 3]> : tensor<3xindex>")
+        e(
+            "    %0 = mitigation.zne @circuit0(%arg0) scaleFactors (%sf : tensor<3xindex>)"
+            f" : ({arg_type}) -> {ret_type}"
+        )
+        e(f"    return %0 : {ret_type}")
+    else:
+        e(f"    %0 = func.call @circuit0(%arg0) : ({arg_type}) -> f64")
+        e("    return %0 : f64")
+    e("}")
+
+    e("func.func @setup() {")
+    e("    quantum.init")
+    e("    return")
+    e("}")
+    e("func.func @teardown() {")
+    e("    quantum.finalize")
+    e("    return")
+    e("}")
+    e("}")
+    return "\n".join(e.lines) + "\n"
+
+
+def run_pipeline(quantum_opt: str, passes: List[str], ir: str, timing: bool) -> Tuple[str, dict]:
+    """Run a single pipeline with `quantum-opt` and return its output IR with the measured
+    wall-clock time (seconds) and peak resident memory (KiB) of the compiler process."""
+    cmd = [quantum_opt, f"--pass-pipeline=builtin.module({','.join(passes)})"]
+    if timing:
+        cmd.append("--mlir-timing")
+
+    with TemporaryDirectory() as tmp:
+        fin, fout, ferr = join(tmp, "in.mlir"), join(tmp, "out.mlir"), join(tmp, "err.txt")
+        with open(fin, "w", encoding="utf-8") as f:
+            f.write(ir)
+
+        with open(fin, "rb") as i, open(fout, "wb") as o, open(ferr, "wb") as e:
+            start = perf_counter()
+            proc = Popen(cmd, stdin=i, stdout=o, stderr=e)  # pylint: disable=R1732
+            # Reap the child directly so that its resource usage is reported individually.
+            _, status, rusage = os.wait4(proc.pid, 0)
+            elapsed = perf_counter() - start
+        proc.returncode = os.waitstatus_to_exitcode(status)
+
+        with open(fout, "r", encoding="utf-8") as f:
+            out = f.read()
+        with open(ferr, "r", encoding="utf-8") as f:
+            err = f.read()
+
+    if proc.returncode:
+        raise RuntimeError(f"{' '.join(cmd)} failed with exit code {proc.returncode}:\n{err}")
+
+    result = {
+        "time_s": elapsed,
+        "maxrss_kib": rusage.ru_maxrss,
+        "ir_bytes_in": len(ir),
+        "ir_bytes_out": len(out),
+    }
+    if timing:
+        result["timing_report"] = err
+    return out, result
+
+
+def run_pipelines(quantum_opt: str, pipelines, ir: str, timing: bool) -> Iterator[dict]:
+    """Run the pipelines one after the other, feeding each one with the output of the previous
+    pipeline as the compiler driver does."""
+    for name, passes in pipelines:
+        ir, result = run_pipeline(quantum_opt, passes, ir, timing)
+        yield {"pipeline": name, **result}
+
+
+def find_quantum_opt(hint: str) -> str:
+    """Locate the `quantum-opt` binary from the command line, the PATH, or the build tree."""
+    if hint:
+        return hint
+    found = which("quantum-opt")
+    if found:
+        return found
+    default = join(dirname(dirname(abspath(__file__))), "mlir", "build", "bin", "quantum-opt")
+    if isfile(default):
+        return default
+    raise RuntimeError("Could not find quantum-opt, please pass it with --quantum-opt")
+
+
+# fmt: off
+ap = ArgumentParser(prog="python3 compiler_throughput.py",
+                    description="Measure the time and the memory of every default compilation "
+                                "pipeline on synthetic modules of growing size",
+                    epilog="Families: " + "; ".join(f"{k} - {v}" for k, v in FAMILIES.items()))
+ap.add_argument("-f", "--family", type=str, action="append", default=None,
+                help=f"Module family to generate ({'|'.join(FAMILIES)}), could be repeated "
+                "(default - all)")
+ap.add_argument("-s", "--sizes", type=str, default="16,64,256,1024", metavar="INT[,INT...]",
+                help="Comma-separated list of module sizes (default - 16,64,256,1024)")
+ap.add_argument("-w", "--nwires", type=int, default=4, metavar="INT",
+                help="Number of qubits of each QNode (default - 4)")
+ap.add_argument("-n", "--niter", type=int, default=3, metavar="INT",
+                help="Number of measurement trials per module (default - 3)")
+ap.add_argument("--async-pipelines", default=False, action="store_true",
+                help="Measure the pipelines used for async QNodes")
+ap.add_argument("--mlir-timing", default=False, action="store_true",
+                help="Record the per-pass timing report of MLIR for every pipeline")
+ap.add_argument("--quantum-opt", type=str, default=None, metavar="PATH",
+                help="Path to the quantum-opt binary (default - look up in the PATH and in "
+                "mlir/build/bin)")
+ap.add_argument("--dump-only", type=str, default=None, metavar="DIR",
+                help="Only write the generated modules to DIR without compiling them")
+ap.add_argument("-o", "--output", type=str, default="-", metavar="FILE.json",
+                help="Output *.json filename (default - '-' meaning stdout)")
+# fmt: on
+
+
+def main(argv) -> int:
+    """Entry point"""
+    a = ap.parse_args(argv)
+    families = a.family or list(FAMILIES)
+    sizes = [int(s) for s in a.sizes.split(",")]
+    pipelines = DEFAULT_ASYNC_PIPELINES if a.async_pipelines else DEFAULT_PIPELINES
+
+    if a.dump_only is not None:
+        os.makedirs(a.dump_only, exist_ok=True)
+        for family in families:
+            for size in sizes:
+                fname = join(a.dump_only, f"{family}_{size}.mlir")
+                with open(fname, "w", encoding="utf-8") as f:
+                    f.write(generate_module(family, size, a.nwires))
+        return 0
+
+    quantum_opt = find_quantum_opt(a.quantum_opt)
+    records = []
+    for family in families:
+        for size in sizes:
+            ir = generate_module(family, size, a.nwires)
+            for trial in range(a.niter):
+                for record in run_pipelines(quantum_opt, pipelines, ir, a.mlir_timing):
+                    record.update({"family": family, "size": size, "trial": trial})
+                    records.append(record)
+                    print(
+                        f"{family:>12} size={size:<6} {record['pipeline']:<24}"
+                        f" {record['time_s']:9.4f}s {record['maxrss_kib']:>9} KiB",
+                        file=sys.stderr,
+                    )
+
+    result = {"pipelines": [name for name, _ in pipelines], "records": records}
+    if a.output == "-":
+        json_dump(result, sys.stdout, indent=4)
+    else:
+        os.makedirs(dirname(abspath(a.output)), exist_ok=True)
+        with open(a.output, "w", encoding="utf-8") as f:
+            json_dump(result, f, indent=4)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
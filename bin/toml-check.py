@@ -58,7 +58,8 @@ parser = Lark(
         gate_properties: "properties" "=" "[" gate_property ("," gate_property)* "]"
         gate_property: "\\"controllable\\"" | "\\"invertible\\"" | "\\"differentiable\\""
         flag_decl: ( "qjit_compatible" | "runtime_code_generation" | \
-                     "mid_circuit_measurement" | "dynamic_qubit_management" ) "=" boolean
+                     "mid_circuit_measurement" | "dynamic_qubit_management" | \
+                     "packed_samples" ) "=" boolean
         option_decl: name "=" (name | "\\"" name "\\"")
         name: /[a-zA-Z0-9_]+/
         boolean: "true" | "false"
@@ -153,6 +153,10 @@ def base_callback(func):
             # If we are not in the tracing context, just evaluate the function.
             return func(*args, **kwargs)
 
+        if retty is None and EvaluationContext.is_recording_batch():
+            # Callbacks without results only run when the results of a batch are collected.
+            return None
+
         return callback_implementation(func, retty, *args, **kwargs)
 
     return bind_callback
@@ -34,6 +34,7 @@ from catalyst.jax_primitives import (
     grad_p,
     jvp_p,
     probs_p,
+    set_state_p,
     vjp_p,
 )
 from catalyst.jax_tracer import Function
@@ -694,6 +695,13 @@ def _make_jaxpr_check_differentiable(f: Differentiable, grad_params: GradParams,
     return the output tree."""
     method = grad_params.method
     jaxpr, shape = jax.make_jaxpr(f, return_shape=True)(*args)
+
+    # The runtime prepares the states natively without differentiating them, so the state
+    # preparations are traced again as gates when they depend on the differentiated arguments.
+    active = [pos in grad_params.expanded_argnum for pos in range(len(jaxpr.in_avals))]
+    if _has_active_state_preparation(jaxpr.jaxpr, active):
+        with EvaluationContext.decomposed_state_preparations():
+            jaxpr, shape = jax.make_jaxpr(f, return_shape=True)(*args)
     _, out_tree = tree_flatten(shape)
     assert len(jaxpr.eqns) == 1, "Expected jaxpr consisting of a single function call."
     assert jaxpr.eqns[0].primitive == func_p, "Expected jaxpr consisting of a single function call."
@@ -723,6 +731,39 @@ def _make_jaxpr_check_differentiable(f: Differentiable, grad_params: GradParams,
     return jaxpr, out_tree
 
 
+def _has_active_state_preparation(jaxpr: Jaxpr, active: List[bool]) -> bool:
+    """Whether the amplitudes of a state preparation in the jaxpr, or in its nested jaxprs, depend
+    on the active inputs. The results of an equation with an active input are all active."""
+
+    def is_active(var):
+        return not isinstance(var, jax.core.Literal) and var in active_vars
+
+    active_vars = {var for var, is_input_active in zip(jaxpr.invars, active) if is_input_active}
+    for eqn in jaxpr.eqns:
+        active_inputs = [is_active(var) for var in eqn.invars]
+        if not any(active_inputs):
+            continue
+        if eqn.primitive is set_state_p and active_inputs[0]:
+            return True
+
+        # Calls forward their inputs one to one, other nested jaxprs take all of them as active
+        for param in eqn.params.values():
+            for sub_jaxpr in param if isinstance(param, (list, tuple)) else [param]:
+                if isinstance(sub_jaxpr, jax.core.ClosedJaxpr):
+                    sub_jaxpr = sub_jaxpr.jaxpr
+                if not isinstance(sub_jaxpr, jax.core.Jaxpr):
+                    continue
+                sub_active = (
+                    active_inputs
+                    if len(sub_jaxpr.invars) == len(eqn.invars)
+                    else [True] * len(sub_jaxpr.invars)
+                )
+                if _has_active_state_preparation(sub_jaxpr, sub_active):
+                    return True
+        active_vars.update(eqn.outvars)
+    return False
+
+
 def _verify_differentiable_child_qnodes(jaxpr, method):
     """Traverse QNodes being differentiated in the 'call graph' of the JAXPR to verify them."""
     visited = set()
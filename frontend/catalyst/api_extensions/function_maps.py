@@ -26,9 +26,11 @@ from typing import Any, Callable, Optional, Union
 import jax
 import jax.numpy as jnp
 import numpy as np
+import pennylane as qml
 from jax._src.tree_util import tree_flatten, tree_leaves, tree_structure, tree_unflatten
 
 from catalyst.api_extensions.control_flow import for_loop
+from catalyst.jax_primitives import batch_begin_p, batch_end_p, batch_execute_p, batch_lane_p
 from catalyst.tracing.contexts import EvaluationContext
 
 
@@ -39,6 +41,7 @@ def vmap(
     in_axes=0,
     out_axes=0,
     axis_size=None,
+    batched_execution=False,
 ):  # pylint: disable=unused-argument
     """A :func:`~.qjit` compatible vectorizing map.
     Creates a function which maps an input function over argument axes.
@@ -52,6 +55,9 @@ def vmap(
         axis_size (int): An integer can be optionally provided to indicate the size of the
             axis to be mapped. If omitted, the size of the mapped axis will be inferred from
             the provided arguments.
+        batched_execution (bool): If ``True``, ``fn`` must be a QNode, and the circuits of all
+            the samples are simulated together in a single pass over a batched state vector
+            instead of one after the other. See the details below.
 
     Returns:
         Callable: Vectorized version of ``fn``.
@@ -118,6 +124,34 @@ def vmap(
 
         The ``out_axes`` parameter can be also used to specify the positions of the mapped axis
         in the output. ``out_axes`` is subject to the same modes as well.
+
+    .. details::
+        :title: Batched execution
+
+        With ``batched_execution=True``, the QNode is run twice for every sample. The first run
+        records the circuit of each sample on the device, the device then simulates the
+        circuits of all the samples at once, with the batch dimension being the innermost
+        dimension of the state vector, and the second run returns the measurement results of
+        each sample. Side effects, such as :func:`~.debug.callback` and :func:`~.debug.print`,
+        are only executed by the second run, once per sample.
+
+        All the samples must apply the same gates to the same wires, and only differ in the gate
+        parameters and observable coefficients. The ``lightning.qubit`` device supports batched
+        execution in analytic mode for expectation values, variances, probabilities, and states;
+        mid-circuit measurements, sampling, and gradients are not supported.
+
+        .. code-block:: python
+
+            @qjit
+            @partial(vmap, batched_execution=True)
+            @qml.qnode(qml.device("lightning.qubit", wires=2))
+            def circuit(x):
+                qml.RX(x, wires=0)
+                qml.CNOT(wires=[0, 1])
+                return qml.expval(qml.PauliZ(1))
+
+        >>> circuit(jnp.array([0.1, 0.2, 0.3]))
+        Array([0.99500417, 0.98006658, 0.95533649], dtype=float64)
     """
 
     kwargs = copy.copy(locals())
@@ -146,6 +180,7 @@ class VmapCallable:
         axis_size (int): An integer can be optionally provided to indicate the size of the
             axis to be mapped. If omitted, the size of the mapped axis will be inferred from
             the provided arguments.
+        batched_execution (bool): Whether to simulate the circuits of all the samples together.
 
     Raises:
         ValueError: Invalid ``in_axes``, ``out_axes``, and ``axis_size`` values.
@@ -157,11 +192,13 @@ class VmapCallable:
         in_axes: Union[int, Sequence[Any]],
         out_axes: Union[int, Sequence[Any]],
         axis_size: Optional[int],
+        batched_execution: bool = False,
     ):
         self.fn = fn
         self.in_axes = in_axes
         self.out_axes = out_axes
         self.axis_size = axis_size
+        self.batched_execution = batched_execution
         self._validate_configuration()
 
     def _validate_configuration(self):
@@ -178,6 +215,12 @@ class VmapCallable:
                 f"but got {self.out_axes}"
             )
 
+        if self.batched_execution and not isinstance(self.fn, qml.QNode):
+            raise ValueError(
+                "Invalid 'batched_execution'; the mapped function must be a QNode, "
+                f"but got {self.fn}"
+            )
+
     def __call__(self, *args, **kwargs):
         """Vectorization around the hybrid program using catalyst.for_loop"""
 
@@ -213,6 +256,12 @@ class VmapCallable:
 
         fn_args = tree_unflatten(args_tree, fn_args_flat)
 
+        # Record the circuits of all the samples, and simulate them together, before running
+        # 'fn' again for each sample to collect the results.
+        if self.batched_execution:
+            self._record_batch(args_flat, args_tree, in_axes_flat, batch_loc, batch_size, kwargs)
+            batch_lane_p.bind(0)
+
         # Run 'fn' one time to get output-shape
         init_result = self.fn(*fn_args, **kwargs)
 
@@ -260,6 +309,8 @@ class VmapCallable:
                 fn_args_flat[loc] = jnp.take(args_flat[loc], i, axis=ax)
 
             fn_args = tree_unflatten(args_tree, fn_args_flat)
+            if self.batched_execution:
+                batch_lane_p.bind(i)
             res = self.fn(*fn_args, **kwargs)
 
             res_flat, _ = tree_flatten(res)
@@ -272,6 +323,9 @@ class VmapCallable:
 
         batched_result_list = loop_fn(batched_result_list)
 
+        if self.batched_execution:
+            batch_end_p.bind()
+
         # Support out_axes on dim > 0
         for loc in out_loc:
             if ax := out_axes_flat[loc]:
@@ -282,6 +336,35 @@ class VmapCallable:
         # Unflatten batched_result before return
         return tree_unflatten(init_result_tree, batched_result_list)
 
+    def _record_batch(self, args_flat, args_tree, in_axes_flat, batch_loc, batch_size, kwargs):
+        """Record the circuit of every sample of the batch on the device, and simulate all of
+        them at once.
+
+        Args:
+            args_flat (List): Flattened list of the batched arguments.
+            args_tree (PyTreeDef): The structure of the arguments.
+            in_axes_flat (List): Flattened list of in-axes including `None` elements.
+            batch_loc (List): The locations of the batched arguments in ``args_flat``.
+            batch_size (int): The number of samples.
+            kwargs (Dict): The keyword arguments of ``fn``.
+        """
+
+        batch_begin_p.bind(batch_size=batch_size)
+
+        @for_loop(0, batch_size, 1)
+        def record_fn(i):
+            fn_args_flat = args_flat.copy()
+            for loc in batch_loc:
+                fn_args_flat[loc] = jnp.take(args_flat[loc], i, axis=in_axes_flat[loc])
+
+            batch_lane_p.bind(i)
+            self.fn(*tree_unflatten(args_tree, fn_args_flat), **kwargs)
+
+        # The side effects of 'fn' run in the replay sweep only, once per sample.
+        with EvaluationContext.recording_batch():
+            record_fn()
+        batch_execute_p.bind()
+
     def _get_batch_loc(self, axes_flat):
         """
         Get the list of mapping locations in the flattened list of in-axes or out-axes.
@@ -250,6 +250,7 @@ def adjoint(f: Union[Callable, Operator]) -> Union[Callable, Operator]:
                 ]
 
             _check_no_measurements(quantum_tape)
+            quantum_tape = _decompose_state_preparations(quantum_tape)
 
             adjoint_region = HybridOpRegion(
                 inner_trace, quantum_tape, arg_classical_tracers, res_classical_tracers
@@ -561,6 +562,20 @@ def qctrl_distribute(
 
 
 ## PRIVATE ##
+def _decompose_state_preparations(tape: QuantumTape) -> QuantumTape:
+    """Decompose the state preparations of the tape into gates, as the native ones of the runtime
+    are not unitary and cannot be inverted"""
+
+    with QueuingManager.stop_recording():
+        ops = []
+        for op in tape.operations:
+            if isinstance(op, (qml.StatePrep, qml.BasisState)):
+                ops.extend(op.decomposition())
+            else:
+                ops.append(op)
+    return QuantumTape(ops, tape.measurements)
+
+
 def _check_no_measurements(tape: QuantumTape) -> None:
     """Check the nested quantum tape for the absense of quantum measurements of any kind"""
 
@@ -66,6 +66,8 @@ class CompileOptions:
         static_argnums (Optional[Union[int, Iterable[int]]]): indices of static arguments.
             Default is ``None``.
         abstracted_axes (Optional[Any]): store the abstracted_axes value. Defaults to ``None``.
+        device_options (Optional[Dict[str, Any]]): runtime options passed to every device of the
+            program, on top of the options read from the PennyLane devices. Defaults to ``None``.
     """
 
     verbose: Optional[bool] = False
@@ -79,6 +81,7 @@ class CompileOptions:
     static_argnums: Optional[Union[int, Iterable[int]]] = None
     abstracted_axes: Optional[Union[Iterable[Iterable[str]], Dict[int, str]]] = None
     lower_to_llvm: Optional[bool] = True
+    device_options: Optional[Dict[str, Any]] = None
 
     def __post_init__(self):
         # Make the format of static_argnums easier to handle.
@@ -146,6 +149,8 @@ QUANTUM_COMPILATION_PASS = (
         "lower-mitigation",
         "lower-gradients",
         "adjoint-lowering",
+        "recognize-qft",
+        "group-measurements",
     ],
 )
 
@@ -174,7 +179,8 @@ BUFFERIZATION_PASS = (
         "convert-arraylist-to-memref",
         "convert-bufferization-to-memref",
         "canonicalize",
-        # "cse",
+        "cse",
+        "loop-invariant-code-motion",
         "cp-global-memref",
     ],
 )
@@ -241,6 +247,15 @@ DEFAULT_ASYNC_PIPELINES = [
 ]
 
 
+def get_runtime_bitcode() -> str:
+    """Return the path to the runtime C-API bitcode, or an empty string if it was not built.
+
+    The compiler driver links this bitcode into the program so that runtime calls can be inlined.
+    """
+    bitcode = path.join(get_lib_path("runtime", "RUNTIME_LIB_DIR"), "librt_capi.bc")
+    return bitcode if path.isfile(bitcode) else ""
+
+
 class LinkerDriver:
     """Compiler used to drive the linking stage.
     In order to avoid relying on a single linker at run time and allow the user some flexibility,
@@ -337,12 +352,13 @@ class LinkerDriver:
         elif platform.system() == "Darwin":  # pragma: nocover
             system_flags += ["-Wl,-arch_errors_fatal"]
 
-        # The exception handling mechanism requires linking against
-        # __gxx_personality_v0 which is either on -lstdc++ in
-        # or -lc++. We choose based on the operating system.
-        if options.async_qnodes and platform.system() == "Linux":  # pragma: nocover
+        # The exception handling mechanism, as well as the runtime functions inlined from the
+        # runtime bitcode, require linking against __gxx_personality_v0 which is either on
+        # -lstdc++ or -lc++. We choose based on the operating system.
+        needs_cxx_runtime = options.async_qnodes or get_runtime_bitcode()
+        if needs_cxx_runtime and platform.system() == "Linux":  # pragma: nocover
             system_flags += ["-lstdc++"]
-        elif options.async_qnodes and platform.system() == "Darwin":  # pragma: nocover
+        elif needs_cxx_runtime and platform.system() == "Darwin":  # pragma: nocover
             system_flags += ["-lc++"]
 
         default_flags = [
@@ -488,6 +504,7 @@ class Compiler:
                 verbose=self.options.verbose,
                 pipelines=self.options.get_pipelines(),
                 lower_to_llvm=lower_to_llvm,
+                runtime_bitcode=get_runtime_bitcode(),
             )
         except RuntimeError as e:
             raise CompileError(*e.args) from e
@@ -129,7 +129,8 @@ def print_memref(x):
     if EvaluationContext.is_tracing():
         if not isinstance(x, jax.core.Tracer):
             raise TypeError("Arguments to print_memref must be of type jax.core.Tracer")
-        print_p.bind(x, memref=True)
+        if not EvaluationContext.is_recording_batch():
+            print_p.bind(x, memref=True)
     else:
         # Dispatch to Python print outside a qjit context.
         builtins.print(x)
@@ -28,6 +28,7 @@ from pennylane.measurements import (
     ProbabilityMP,
     VarianceMP,
 )
+from pennylane.ops.op_math.controlled import create_controlled_op
 from pennylane.tape.tape import (
     _validate_computational_basis_sampling,
     rotations_and_diagonal_measurements,
@@ -45,6 +46,8 @@ def catalyst_decomposer(op):
     Raises a CompileError for MidMeasureMP"""
     if isinstance(op, MidMeasureMP):
         raise CompileError("Must use 'measure' from Catalyst instead of PennyLane.")
+    if isinstance(op, qml.ops.Controlled) and not op.base.has_matrix:
+        return decompose_controlled_base(op)
     if op.name in {"MultiControlledX", "BlockEncode"} or isinstance(op, qml.ops.Controlled):
         return _decompose_to_matrix(op)
     return op.decomposition()
@@ -92,6 +95,20 @@ def catalyst_decompose(
     return (tape,), lambda x: x[0]
 
 
+def decompose_controlled_base(op):
+    """Control the decomposition of the base of a controlled operation, for the bases without a
+    matrix such as state preparations."""
+    return [
+        create_controlled_op(
+            base_op,
+            control=op.control_wires,
+            control_values=op.control_values,
+            work_wires=op.work_wires,
+        )
+        for base_op in op.base.decomposition()
+    ]
+
+
 def _decompose_to_matrix(op):
     try:
         mat = op.matrix()
@@ -210,7 +227,7 @@ def measurements_from_counts(tape):
         results_processed = []
         for m in tape.measurements:
             mapped_counts_outcome = _map_counts(
-                counts_outcomes, m.wires, qml.wires.Wires(list(measured_wires))
+                states, counts_outcomes, m.wires, qml.wires.Wires(list(measured_wires))
             )
             if isinstance(m, ExpectationMP):
                 probs = _get_probs(mapped_counts_outcome)
@@ -222,9 +239,8 @@ def measurements_from_counts(tape):
                 probs = _get_probs(mapped_counts_outcome)
                 results_processed.append(probs)
             elif isinstance(m, CountsMP):
-                results_processed.append(
-                    tuple([states[0 : 2 ** len(m.wires)], mapped_counts_outcome])
-                )
+                basis_states = jax.numpy.arange(2 ** len(m.wires), dtype=states.dtype)
+                results_processed.append(tuple([basis_states, mapped_counts_outcome]))
         if len(tape.measurements) == 1:
             results_processed = results_processed[0]
         else:
@@ -258,16 +274,22 @@ def _get_var(eigvals, prob_vector):
     return var
 
 
-def _map_counts(counts, sub_wires, wire_order):
-    """Map the count outcome given a wires and wire order."""
-    wire_map = dict(zip(wire_order, range(len(wire_order))))
-    mapped_wires = [wire_map[w] for w in sub_wires]
+def _map_counts(states, counts, sub_wires, wire_order):
+    """Map the count outcome given a wires and wire order.
 
-    mapped_counts = {}
+    The bitstrings are read from ``states`` rather than from the position of the counts, since
+    sparse counts only hold the observed bitstrings, padded with a bitstring of -1.
+    """
+    wire_map = dict(zip(wire_order, range(len(wire_order))))
     num_wires = len(wire_order)
-    for outcome, occurrence in enumerate(counts):
-        binary_outcome = format(outcome, f"0{num_wires}b")
-        mapped_outcome = "".join(binary_outcome[i] for i in mapped_wires)
-        mapped_counts[mapped_outcome] = mapped_counts.get(mapped_outcome, 0) + occurrence
+    num_sub_wires = len(sub_wires)
+
+    outcomes = jax.numpy.asarray(states, jax.numpy.int64)
+    counts = jax.numpy.where(outcomes >= 0, counts, 0)
+    mapped_outcomes = jax.numpy.zeros_like(outcomes)
+    for i, w in enumerate(sub_wires):
+        bit = (outcomes >> (num_wires - 1 - wire_map[w])) & 1
+        mapped_outcomes = mapped_outcomes | (bit << (num_sub_wires - 1 - i))
 
-    return jax.numpy.array(list(mapped_counts.values()))
+    mapped_counts = jax.numpy.zeros(2**num_sub_wires, dtype=counts.dtype)
+    return mapped_counts.at[mapped_outcomes].add(counts)
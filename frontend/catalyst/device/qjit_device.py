@@ -32,8 +32,10 @@ from pennylane.transforms.core import TransformProgram
 from catalyst.device.decomposition import (
     catalyst_acceptance,
     catalyst_decompose,
+    decompose_controlled_base,
     measurements_from_counts,
 )
+from catalyst.tracing.contexts import EvaluationContext
 from catalyst.utils.exceptions import CompileError
 from catalyst.utils.patching import Patcher
 from catalyst.utils.runtime_environment import get_lib_path
@@ -62,6 +64,7 @@ RUNTIME_OPERATIONS = [
     "IsingZZ",
     "ISWAP",
     "MultiRZ",
+    "PauliRot",
     "PauliX",
     "PauliY",
     "PauliZ",
@@ -78,6 +81,8 @@ RUNTIME_OPERATIONS = [
     "T",
     "Toffoli",
     "GlobalPhase",
+    "StatePrep",
+    "BasisState",
 ]
 # The runtime interface does not care about specific gate properties, so set them all to True.
 RUNTIME_OPERATIONS = {
@@ -85,6 +90,18 @@ RUNTIME_OPERATIONS = {
     for op in RUNTIME_OPERATIONS
 }
 
+# The state preparations the runtime performs natively, on the backends which implement them, unless
+# they are decomposed into gates to be differentiated. They are not unitary, so that their adjoint
+# and controlled versions are decomposed as well.
+STATE_PREP_OPERATIONS = {"StatePrep", "BasisState"}
+STATE_PREP_BACKENDS = {"LightningSimulator", "LightningKokkosSimulator"}
+RUNTIME_OPERATIONS.update(
+    {
+        op: OperationProperties(invertible=False, controllable=False, differentiable=False)
+        for op in STATE_PREP_OPERATIONS
+    }
+)
+
 # TODO: This should be removed after implementing `get_c_interface`
 # for the following backend devices:
 SUPPORTED_RT_DEVICES = {
@@ -164,21 +181,42 @@ def extract_backend_info(device: qml.QubitDevice, capabilities: DeviceCapabiliti
         if hasattr(device, v):
             device_kwargs[k] = getattr(device, v)
 
+    for k, v in EvaluationContext.get_device_options().items():
+        if k not in capabilities.options:
+            raise CompileError(f"The {dname} device does not support the option '{k}'")
+        device_kwargs[k] = v
+
     return BackendInfo(dname, device_name, device_lpath, device_kwargs)
 
 
-def get_qjit_device_capabilities(target_capabilities: DeviceCapabilities) -> Set[str]:
+def get_qjit_device_capabilities(
+    target_capabilities: DeviceCapabilities, backend_name: str = "default"
+) -> Set[str]:
     """Calculate the set of supported quantum gates for the QJIT device from the gates
     allowed on the target quantum device."""
     # Supported gates of the target PennyLane's device
     qjit_config = deepcopy(target_capabilities)
 
     # Gates that Catalyst runtime supports
-    qir_gates = RUNTIME_OPERATIONS
+    native_state_prep = (
+        backend_name in STATE_PREP_BACKENDS
+        and not EvaluationContext.is_decomposing_state_preparations()
+    )
+    qir_gates = {
+        op: p
+        for op, p in RUNTIME_OPERATIONS.items()
+        if native_state_prep or op not in STATE_PREP_OPERATIONS
+    }
 
     # Intersection of the above
     qjit_config.native_ops = intersect_operations(target_capabilities.native_ops, qir_gates)
 
+    # The backends preparing states natively do so even when the device decomposes them
+    if native_state_prep:
+        for op in STATE_PREP_OPERATIONS & set(target_capabilities.to_decomp_ops):
+            qjit_config.to_decomp_ops.pop(op)
+            qjit_config.native_ops[op] = RUNTIME_OPERATIONS[op]
+
     # Control-flow gates to be lowered down to the LLVM control-flow instructions,
     # all of which can be inverted, controlled, and differentiated.
     qjit_config.native_ops.update(
@@ -258,7 +296,9 @@ class QJITDevice(qml.QubitDevice):
         self.backend_lib = backend.lpath if backend else ""
         self.backend_kwargs = backend.kwargs if backend else {}
 
-        self.qjit_capabilities = get_qjit_device_capabilities(original_device_capabilities)
+        self.qjit_capabilities = get_qjit_device_capabilities(
+            original_device_capabilities, self.backend_name
+        )
 
     @property
     def operations(self) -> Set[str]:
@@ -302,6 +342,8 @@ class QJITDevice(qml.QubitDevice):
         )
 
         def _decomp_to_unitary(self, *_args, **_kwargs):
+            if isinstance(self, qml.ops.Controlled) and not self.base.has_matrix:
+                return decompose_controlled_base(self)
             try:
                 mat = self.matrix()
             except Exception as e:
@@ -364,7 +406,9 @@ class QJITDeviceNewAPI(qml.devices.Device):
         self.backend_lib = backend.lpath if backend else ""
         self.backend_kwargs = backend.kwargs if backend else {}
 
-        self.qjit_capabilities = get_qjit_device_capabilities(original_device_capabilities)
+        self.qjit_capabilities = get_qjit_device_capabilities(
+            original_device_capabilities, self.backend_name
+        )
 
     @property
     def operations(self) -> Set[str]:
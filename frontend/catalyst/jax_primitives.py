@@ -47,6 +47,10 @@ from mlir_quantum.dialects.mitigation import ZneOp
 from mlir_quantum.dialects.quantum import (
     AdjointOp,
     AllocOp,
+    BatchBeginOp,
+    BatchEndOp,
+    BatchExecuteOp,
+    BatchLaneOp,
     ComputationalBasisOp,
     CountsOp,
     CustomOp,
@@ -62,9 +66,13 @@ from mlir_quantum.dialects.quantum import (
     MeasureOp,
     MultiRZOp,
     NamedObsOp,
+    PauliRotOp,
     ProbsOp,
     QubitUnitaryOp,
     SampleOp,
+    SetBasisStateOp,
+    SetStateOp,
+    ShadowOp,
     StateOp,
     TensorOp,
     VarianceOp,
@@ -181,6 +189,14 @@ zne_p = core.Primitive("zne")
 zne_p.multiple_results = True
 qdevice_p = core.Primitive("qdevice")
 qdevice_p.multiple_results = True
+batch_begin_p = core.Primitive("batch_begin")
+batch_begin_p.multiple_results = True
+batch_lane_p = core.Primitive("batch_lane")
+batch_lane_p.multiple_results = True
+batch_execute_p = core.Primitive("batch_execute")
+batch_execute_p.multiple_results = True
+batch_end_p = core.Primitive("batch_end")
+batch_end_p.multiple_results = True
 qalloc_p = core.Primitive("qalloc")
 qdealloc_p = core.Primitive("qdealloc")
 qdealloc_p.multiple_results = True
@@ -192,6 +208,10 @@ qinst_p = core.Primitive("qinst")
 qinst_p.multiple_results = True
 qunitary_p = core.Primitive("qunitary")
 qunitary_p.multiple_results = True
+set_state_p = core.Primitive("set_state")
+set_state_p.multiple_results = True
+set_basis_state_p = core.Primitive("set_basis_state")
+set_basis_state_p.multiple_results = True
 qmeasure_p = core.Primitive("qmeasure")
 qmeasure_p.multiple_results = True
 compbasis_p = core.Primitive("compbasis")
@@ -200,6 +220,7 @@ hermitian_p = core.Primitive("hermitian")
 tensorobs_p = core.Primitive("tensorobs")
 hamiltonian_p = core.Primitive("hamiltonian")
 sample_p = core.Primitive("sample")
+shadow_p = core.Primitive("shadow")
 counts_p = core.Primitive("counts")
 counts_p.multiple_results = True
 expval_p = core.Primitive("expval")
@@ -599,6 +620,66 @@ def _qdevice_lowering(jax_ctx: mlir.LoweringRuleContext, rtd_lib, rtd_name, rtd_
     return ()
 
 
+#
+# batched execution
+#
+@batch_begin_p.def_abstract_eval
+def _batch_begin_abstract_eval(batch_size):
+    return ()
+
+
+def _batch_begin_lowering(jax_ctx: mlir.LoweringRuleContext, batch_size):
+    ctx = jax_ctx.module_context.context
+    ctx.allow_unregistered_dialects = True
+    i64_type = ir.IntegerType.get_signless(64, ctx)
+    BatchBeginOp(ConstantOp(i64_type, batch_size).result)
+    return ()
+
+
+@batch_lane_p.def_abstract_eval
+def _batch_lane_abstract_eval(lane):
+    return ()
+
+
+def _batch_lane_lowering(jax_ctx: mlir.LoweringRuleContext, lane: ir.Value):
+    ctx = jax_ctx.module_context.context
+    ctx.allow_unregistered_dialects = True
+
+    assert ir.RankedTensorType.isinstance(lane.type), lane.type
+    assert ir.RankedTensorType(lane.type).shape == [], "Scalar integer required for batch lane!"
+    baseType = ir.RankedTensorType(lane.type).element_type
+    lane = TensorExtractOp(baseType, lane, []).result
+    if ir.IntegerType(lane.type).width < 64:
+        lane = ExtUIOp(ir.IntegerType.get_signless(64), lane).result
+
+    BatchLaneOp(lane)
+    return ()
+
+
+@batch_execute_p.def_abstract_eval
+def _batch_execute_abstract_eval():
+    return ()
+
+
+def _batch_execute_lowering(jax_ctx: mlir.LoweringRuleContext):
+    ctx = jax_ctx.module_context.context
+    ctx.allow_unregistered_dialects = True
+    BatchExecuteOp()
+    return ()
+
+
+@batch_end_p.def_abstract_eval
+def _batch_end_abstract_eval():
+    return ()
+
+
+def _batch_end_lowering(jax_ctx: mlir.LoweringRuleContext):
+    ctx = jax_ctx.module_context.context
+    ctx.allow_unregistered_dialects = True
+    BatchEndOp()
+    return ()
+
+
 #
 # qalloc
 #
@@ -802,7 +883,12 @@ def _gphase_lowering(
 #
 @qinst_p.def_abstract_eval
 def _qinst_abstract_eval(
-    *qubits_or_params, op=None, qubits_len: int = 0, params_len: int = 0, ctrl_len: int = 0
+    *qubits_or_params,
+    op=None,
+    qubits_len: int = 0,
+    params_len: int = 0,
+    ctrl_len: int = 0,
+    pauli_word=None,
 ):
     # The signature here is: (using * to denote zero or more)
     # qubits*, params*, ctrl_qubits*, ctrl_values*
@@ -817,7 +903,7 @@ def _qinst_abstract_eval(
 
 @qinst_p.def_impl
 def _qinst_def_impl(
-    ctx, *qubits_or_params, op, qubits_len, params_len, ctrl_len
+    ctx, *qubits_or_params, op, qubits_len, params_len, ctrl_len, pauli_word=None
 ):  # pragma: no cover
     raise NotImplementedError()
 
@@ -829,6 +915,7 @@ def _qinst_lowering(
     qubits_len: int = 0,
     params_len: int = 0,
     ctrl_len: int = 0,
+    pauli_word=None,
 ):
     ctx = jax_ctx.module_context.context
     ctx.allow_unregistered_dialects = True
@@ -882,6 +969,19 @@ def _qinst_lowering(
             in_ctrl_values=ctrl_values_i1,
         ).results
 
+    if name_str == "PauliRot":
+        assert len(float_params) == 1, "PauliRot takes one float parameter"
+        assert pauli_word is not None, "PauliRot requires a Pauli word"
+        return PauliRotOp(
+            out_qubits=[qubit.type for qubit in qubits],
+            out_ctrl_qubits=[qubit.type for qubit in ctrl_qubits],
+            theta=float_params[0],
+            pauli_word=ir.StringAttr.get(pauli_word),
+            in_qubits=qubits,
+            in_ctrl_qubits=ctrl_qubits,
+            in_ctrl_values=ctrl_values_i1,
+        ).results
+
     return CustomOp(
         out_qubits=[qubit.type for qubit in qubits],
         out_ctrl_qubits=[qubit.type for qubit in ctrl_qubits],
@@ -968,6 +1068,55 @@ def _qunitary_lowering(
     ).results
 
 
+#
+# set_state / set_basis_state
+#
+@set_state_p.def_abstract_eval
+def _set_state_abstract_eval(state, *qubits):
+    assert all(isinstance(qubit, AbstractQbit) for qubit in qubits)
+    return (AbstractQbit(),) * len(qubits)
+
+
+@set_state_p.def_impl
+def _set_state_def_impl(ctx, state, *qubits):  # pragma: no cover
+    raise NotImplementedError()
+
+
+def _set_state_lowering(jax_ctx: mlir.LoweringRuleContext, state: ir.Value, *qubits: tuple):
+    ctx = jax_ctx.module_context.context
+    ctx.allow_unregistered_dialects = True
+
+    element_type = ir.RankedTensorType(state.type).element_type
+    assert ir.ComplexType.isinstance(element_type), "The state must have complex128 amplitudes"
+
+    return SetStateOp(out_qubits=[q.type for q in qubits], in_state=state, in_qubits=qubits).results
+
+
+@set_basis_state_p.def_abstract_eval
+def _set_basis_state_abstract_eval(basis_state, *qubits):
+    assert all(isinstance(qubit, AbstractQbit) for qubit in qubits)
+    return (AbstractQbit(),) * len(qubits)
+
+
+@set_basis_state_p.def_impl
+def _set_basis_state_def_impl(ctx, basis_state, *qubits):  # pragma: no cover
+    raise NotImplementedError()
+
+
+def _set_basis_state_lowering(
+    jax_ctx: mlir.LoweringRuleContext, basis_state: ir.Value, *qubits: tuple
+):
+    ctx = jax_ctx.module_context.context
+    ctx.allow_unregistered_dialects = True
+
+    element_type = ir.RankedTensorType(basis_state.type).element_type
+    assert ir.IntegerType(element_type).width == 1, "The basis state must be a boolean array"
+
+    return SetBasisStateOp(
+        out_qubits=[q.type for q in qubits], basis_state=basis_state, in_qubits=qubits
+    ).results
+
+
 #
 # qmeasure
 #
@@ -1154,9 +1303,15 @@ def _hamiltonian_lowering(jax_ctx: mlir.LoweringRuleContext, coeffs: ir.Value, *
 # sample measurement
 #
 @sample_p.def_abstract_eval
-def _sample_abstract_eval(obs, shots, shape):
+def _sample_abstract_eval(obs, shots, shape, packed=False):
     assert isinstance(obs, AbstractObs)
 
+    if packed:
+        # Packed samples hold the bits of each shot in a single integer.
+        assert obs.primitive is compbasis_p
+        assert shape == (shots,)
+        return core.ShapedArray(shape, jax.numpy.int64)
+
     if obs.primitive is compbasis_p:
         assert shape == (shots, obs.num_qubits)
     else:
@@ -1166,35 +1321,69 @@ def _sample_abstract_eval(obs, shots, shape):
 
 
 @sample_p.def_impl
-def _sample_def_impl(ctx, obs, shots, shape):  # pragma: no cover
+def _sample_def_impl(ctx, obs, shots, shape, packed=False):  # pragma: no cover
     raise NotImplementedError()
 
 
-def _sample_lowering(jax_ctx: mlir.LoweringRuleContext, obs: ir.Value, shots: int, shape: tuple):
+def _sample_lowering(
+    jax_ctx: mlir.LoweringRuleContext, obs: ir.Value, shots: int, shape: tuple, packed=False
+):
     ctx = jax_ctx.module_context.context
     ctx.allow_unregistered_dialects = True
 
     i64_type = ir.IntegerType.get_signless(64, ctx)
     shots_attr = ir.IntegerAttr.get(i64_type, shots)
     f64_type = ir.F64Type.get()
-    result_type = ir.RankedTensorType.get(shape, f64_type)
+    result_type = ir.RankedTensorType.get(shape, i64_type if packed else f64_type)
 
     return SampleOp(result_type, obs, shots_attr).results
 
 
+#
+# classical shadow measurement
+#
+@shadow_p.def_abstract_eval
+def _shadow_abstract_eval(obs, shots):
+    assert isinstance(obs, AbstractObs)
+    assert obs.primitive is compbasis_p
+
+    # Each shot is recorded as its packed measurement bases and its packed outcomes.
+    return core.ShapedArray((shots, 2), jax.numpy.int64)
+
+
+@shadow_p.def_impl
+def _shadow_def_impl(ctx, obs, shots):  # pragma: no cover
+    raise NotImplementedError()
+
+
+def _shadow_lowering(jax_ctx: mlir.LoweringRuleContext, obs: ir.Value, shots: int):
+    ctx = jax_ctx.module_context.context
+    ctx.allow_unregistered_dialects = True
+
+    i64_type = ir.IntegerType.get_signless(64, ctx)
+    shots_attr = ir.IntegerAttr.get(i64_type, shots)
+    result_type = ir.RankedTensorType.get((shots, 2), i64_type)
+
+    return ShadowOp(result_type, obs, shots_attr).results
+
+
 #
 # counts measurement
 #
 @counts_p.def_impl
-def _counts_def_impl(ctx, obs, shots, shape):  # pragma: no cover
+def _counts_def_impl(ctx, obs, shots, shape, sparse=False):  # pragma: no cover
     raise NotImplementedError()
 
 
 @counts_p.def_abstract_eval
-def _counts_abstract_eval(obs, shots, shape):
+def _counts_abstract_eval(obs, shots, shape, sparse=False):
     assert isinstance(obs, AbstractObs)
 
-    if obs.primitive is compbasis_p:
+    if sparse:
+        # Sparse counts hold the observed bitstrings only, padded to the number of shots.
+        assert obs.primitive is compbasis_p
+        assert shape == (shots,)
+    elif obs.primitive is compbasis_p:
         assert shape == (2**obs.num_qubits,)
     else:
         assert shape == (2,)
@@ -1202,7 +1391,9 @@ def _counts_abstract_eval(obs, shots, shape):
     return core.ShapedArray(shape, jax.numpy.float64), core.ShapedArray(shape, jax.numpy.int64)
 
 
-def _counts_lowering(jax_ctx: mlir.LoweringRuleContext, obs: ir.Value, shots: int, shape: tuple):
+def _counts_lowering(
+    jax_ctx: mlir.LoweringRuleContext, obs: ir.Value, shots: int, shape: tuple, sparse=False
+):
     ctx = jax_ctx.module_context.context
     ctx.allow_unregistered_dialects = True
 
@@ -1212,7 +1403,10 @@ def _counts_lowering(jax_ctx: mlir.LoweringRuleContext, obs: ir.Value, shots: in
     eigvals_type = ir.RankedTensorType.get(shape, f64_type)
     counts_type = ir.RankedTensorType.get(shape, i64_type)
 
-    return CountsOp(eigvals_type, counts_type, obs, shots_attr).results
+    counts_op = CountsOp(eigvals_type, counts_type, obs, shots_attr)
+    if sparse:
+        counts_op.attributes["sparse"] = ir.UnitAttr.get()
+    return counts_op.results
 
 
 #
@@ -1681,6 +1875,10 @@ def _adjoint_lowering(
 
 mlir.register_lowering(zne_p, _zne_lowering)
 mlir.register_lowering(qdevice_p, _qdevice_lowering)
+mlir.register_lowering(batch_begin_p, _batch_begin_lowering)
+mlir.register_lowering(batch_lane_p, _batch_lane_lowering)
+mlir.register_lowering(batch_execute_p, _batch_execute_lowering)
+mlir.register_lowering(batch_end_p, _batch_end_lowering)
 mlir.register_lowering(qalloc_p, _qalloc_lowering)
 mlir.register_lowering(qdealloc_p, _qdealloc_lowering)
 mlir.register_lowering(qextract_p, _qextract_lowering)
@@ -1688,6 +1886,8 @@ mlir.register_lowering(qinsert_p, _qinsert_lowering)
 mlir.register_lowering(qinst_p, _qinst_lowering)
 mlir.register_lowering(gphase_p, _gphase_lowering)
 mlir.register_lowering(qunitary_p, _qunitary_lowering)
+mlir.register_lowering(set_state_p, _set_state_lowering)
+mlir.register_lowering(set_basis_state_p, _set_basis_state_lowering)
 mlir.register_lowering(qmeasure_p, _qmeasure_lowering)
 mlir.register_lowering(compbasis_p, _compbasis_lowering)
 mlir.register_lowering(namedobs_p, _named_obs_lowering)
@@ -1695,6 +1895,7 @@ mlir.register_lowering(hermitian_p, _hermitian_lowering)
 mlir.register_lowering(tensorobs_p, _tensor__obs_lowering)
 mlir.register_lowering(hamiltonian_p, _hamiltonian_lowering)
 mlir.register_lowering(sample_p, _sample_lowering)
+mlir.register_lowering(shadow_p, _shadow_lowering)
 mlir.register_lowering(counts_p, _counts_lowering)
 mlir.register_lowering(expval_p, _expval_lowering)
 mlir.register_lowering(var_p, _var_lowering)
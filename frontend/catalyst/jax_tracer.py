@@ -73,6 +73,9 @@ from catalyst.jax_primitives import (
     qmeasure_p,
     qunitary_p,
     sample_p,
+    set_basis_state_p,
+    set_state_p,
+    shadow_p,
     state_p,
     tensorobs_p,
     var_p,
@@ -83,6 +86,7 @@ from catalyst.tracing.contexts import (
     JaxTracingContext,
 )
 from catalyst.utils.exceptions import CompileError
+from catalyst.utils.toml import get_device_capabilities
 
 
 class Function:
@@ -120,6 +124,18 @@ KNOWN_NAMED_OBS = (qml.Identity, qml.PauliX, qml.PauliY, qml.PauliZ, qml.Hadamar
 # is constrained to occur before all subsequent equations in the quantum operations trace.
 FORCED_ORDER_PRIMITIVES = {qdevice_p, gphase_p}
 
+# Counts in the computational basis are returned for the observed bitstrings only, rather than for
+# all the 2^n bitstrings, when the latter are more than this and than the number of shots.
+MAX_DENSE_COUNTS_SIZE = 2**20
+
+# Samples in the computational basis are returned by the devices supporting it as one integer per
+# shot, and unpacked into bits within the program, when there are at most this many qubits.
+MAX_PACKED_SAMPLES_QUBITS = 64
+
+# Classical shadows pack the measurement bases of each shot with 2 bits per qubit in a 64-bit
+# integer.
+MAX_SHADOW_QUBITS = 32
+
 PAULI_NAMED_MAP = {
     "I": "Identity",
     "X": "PauliX",
@@ -428,6 +444,16 @@ def trace_quantum_tape(
             )
             qrp.insert(op.wires, qubits2[: len(qubits)])
             qrp.insert(controlled_wires, qubits2[len(qubits) :])
+        elif isinstance(op, qml.StatePrep) and not controlled_wires:
+            qubits = qrp.extract(op.wires)
+            state = jnp.asarray(op.parameters[0], dtype=jnp.complex128)
+            qubits2 = set_state_p.bind(state, *qubits)
+            qrp.insert(op.wires, qubits2)
+        elif isinstance(op, qml.BasisState) and not controlled_wires:
+            qubits = qrp.extract(op.wires)
+            basis_state = jnp.asarray(op.parameters[0], dtype=bool)
+            qubits2 = set_basis_state_p.bind(basis_state, *qubits)
+            qrp.insert(op.wires, qubits2)
         elif isinstance(op, qml.GlobalPhase):
             controlled_qubits = qrp.extract(controlled_wires)
             qubits2 = gphase_p.bind(
@@ -438,12 +464,19 @@ def trace_quantum_tape(
         else:
             qubits = qrp.extract(op.wires)
             controlled_qubits = qrp.extract(controlled_wires)
+            # The Pauli word of a PauliRot is a static attribute of the gate.
+            extra_params = (
+                {"pauli_word": op.hyperparameters["pauli_word"]}
+                if isinstance(op, qml.PauliRot)
+                else {}
+            )
             qubits2 = qinst_p.bind(
                 *[*qubits, *op.parameters, *controlled_qubits, *controlled_values],
                 op=op.name,
                 qubits_len=len(qubits),
                 params_len=len(op.parameters),
                 ctrl_len=len(controlled_qubits),
+                **extra_params,
             )
             qrp.insert(op.wires, qubits2[: len(qubits)])
             qrp.insert(controlled_wires, qubits2[len(qubits) :])
@@ -598,6 +631,7 @@ def trace_quantum_measurements(
         # TODO: support shot vectors
         shots = tape.shots.total_shots
     out_classical_tracers = []
+    capabilities = get_device_capabilities(device)
 
     for i, o in enumerate(outputs):
         if isinstance(o, MeasurementProcess):
@@ -611,9 +645,21 @@ def trace_quantum_measurements(
             using_compbasis = obs_tracers.primitive == compbasis_p
 
             if o.return_type.value == "sample":
-                shape = (shots, nqubits) if using_compbasis else (shots,)
-                result = sample_p.bind(obs_tracers, shots=shots, shape=shape)
-                if using_compbasis:
+                packed = (
+                    capabilities.packed_samples_flag
+                    and using_compbasis
+                    and nqubits <= MAX_PACKED_SAMPLES_QUBITS
+                )
+                if packed:
+                    shape = (shots,)
+                else:
+                    shape = (shots, nqubits) if using_compbasis else (shots,)
+                result = sample_p.bind(obs_tracers, shots=shots, shape=shape, packed=packed)
+                if packed:
+                    # The first wire is the most significant bit of each packed sample.
+                    shifts = jnp.arange(nqubits - 1, -1, -1, dtype=jnp.int64)
+                    result = jnp.right_shift(result[:, None], shifts) & 1
+                elif using_compbasis:
                     result = jnp.astype(result, jnp.int64)
                 out_classical_tracers.append(result)
             elif o.return_type.value == "expval":
@@ -625,8 +671,14 @@ def trace_quantum_measurements(
                 shape = (2**nqubits,)
                 out_classical_tracers.append(probs_p.bind(obs_tracers, shape=shape))
             elif o.return_type.value == "counts":
-                shape = (2**nqubits,) if using_compbasis else (2,)
-                results = counts_p.bind(obs_tracers, shots=shots, shape=shape)
+                # At most `shots` distinct bitstrings can be observed, so sparse counts are padded
+                # to the number of shots instead of holding all the 2^n bitstrings.
+                sparse = using_compbasis and 2**nqubits > max(shots, MAX_DENSE_COUNTS_SIZE)
+                if sparse:
+                    shape = (shots,)
+                else:
+                    shape = (2**nqubits,) if using_compbasis else (2,)
+                results = counts_p.bind(obs_tracers, shots=shots, shape=shape, sparse=sparse)
                 if using_compbasis:
                     results = (jnp.asarray(results[0], jnp.int64), results[1])
                 out_classical_tracers.extend(results)
@@ -641,6 +693,28 @@ def trace_quantum_measurements(
                     )
                 else:
                     out_tree = counts_tree
+            elif o.return_type.value == "shadow":
+                assert using_compbasis
+                if nqubits > MAX_SHADOW_QUBITS:
+                    raise CompileError(
+                        f"Classical shadows are limited to {MAX_SHADOW_QUBITS} qubits, "
+                        f"got {nqubits}"
+                    )
+                # The bases are drawn from the random generator of the device.
+                if o.seed is not None:
+                    raise CompileError(
+                        "The seed of a classical shadow is not supported, "
+                        "seed the device instead"
+                    )
+                if "ClassicalShadow" not in capabilities.measurement_processes:
+                    raise CompileError("Classical shadows are not supported by the device")
+                records = shadow_p.bind(obs_tracers, shots=shots)
+                # The first wire is the most significant in both the packed bases, where
+                # X, Y and Z are 1, 2 and 3, and the packed outcomes of each shot.
+                shifts = jnp.arange(nqubits - 1, -1, -1, dtype=jnp.int64)
+                recipes = (jnp.right_shift(records[:, 0, None], 2 * shifts) & 3) - 1
+                bits = jnp.right_shift(records[:, 1, None], shifts) & 1
+                out_classical_tracers.append(jnp.stack([bits, recipes]))
             elif o.return_type.value == "state":
                 assert using_compbasis
                 shape = (2**nqubits,)
@@ -239,7 +239,7 @@ class QJIT:
 
         with Patcher(
             (qml.QNode, "__call__", QFunc.__call__),
-        ):
+        ), EvaluationContext.device_options(self.compile_options.device_options or {}):
             # TODO: improve PyTree handling
             jaxpr, treedef = trace_to_jaxpr(
                 self.user_function, static_argnums, abstracted_axes, full_sig, {}
@@ -462,6 +462,7 @@ def qjit(
     pipelines=None,
     static_argnums=None,
     abstracted_axes=None,
+    device_options=None,
 ):  # pylint: disable=too-many-arguments,unused-argument
     """A just-in-time decorator for PennyLane and JAX programs using Catalyst.
 
@@ -505,6 +506,9 @@ def qjit(
             Function arguments with ``abstracted_axes`` specified will be compiled to ranked tensors
             with dynamic shapes. For more details, please see the Dynamically-shaped Arrays section
             below.
+        device_options (Optional[Dict[str, Any]]): Runtime options passed to the devices of the
+            program, such as ``{"seed": 42, "num_threads": 4}`` for ``lightning.qubit``. The
+            supported options are listed in the ``[options]`` section of the device TOML file.
 
     Returns:
         QJIT object.
@@ -512,12 +512,15 @@ def change_sample_or_counts(ctx, eqn):
     assert obs_catalyst.primitive == compbasis_p
 
     if is_sample:
-        shots_result = cudaq_sample(ctx.kernel, shots_count=shots)
+        packed = params.get("packed", False)
+        shots_result = cudaq_sample(ctx.kernel, shots_count=shots, packed=packed)
         outvals = [shots_result]
         outvariables = [ctx.new_variable()]
         _map(ctx.replace, eqn.outvars, outvariables)
         _map(ctx.write, eqn.outvars, outvals)
     else:
+        if params.get("sparse", False):
+            raise NotImplementedError("Sparse counts are not supported by CUDA Quantum devices")
         shape = 2**obs_catalyst.num_qubits
         outvals = cudaq_counts(ctx.kernel, shape=shape, shots_count=shots)
         outvariables = [ctx.new_variable(), ctx.new_variable()]
@@ -374,13 +374,13 @@ cudaq_counts_p = jax.core.Primitive("cudaq_counts")
 cudaq_counts_p.multiple_results = True
 
 
-def cudaq_sample(kernel, *args, shots_count=1000):
+def cudaq_sample(kernel, *args, shots_count=1000, packed=False):
     """Convenience function for binding."""
-    return cudaq_sample_p.bind(kernel, *args, shots_count=shots_count)
+    return cudaq_sample_p.bind(kernel, *args, shots_count=shots_count, packed=packed)
 
 
 @cudaq_sample_p.def_impl
-def cudaq_sample_impl(kernel, *args, shots_count=1000):
+def cudaq_sample_impl(kernel, *args, shots_count=1000, packed=False):
     """Concrete implementation of cudaq.sample.
 
     `cudaq.sample` returns an object which is a compressed version of what
@@ -390,11 +390,14 @@ def cudaq_sample_impl(kernel, *args, shots_count=1000):
 
     In a way `qml.count` is more similar to `cudaq.sample` than `qml.sample`.
     So, let's perform a little conversion here.
+
+    With `packed`, each observed bitstring is returned as a single integer instead of
+    an array of bits, as Catalyst's packed samples are.
     """
     a_dict = cudaq.sample(kernel, *args, shots_count=shots_count)
     aggregate = []
     for bitstring, count in a_dict.items():
-        bitarray = [int(bit) for bit in bitstring]
+        bitarray = int(bitstring, 2) if packed else [int(bit) for bit in bitstring]
         for _ in range(count):
             aggregate.append(bitarray)
 
@@ -402,7 +405,7 @@ def cudaq_sample_impl(kernel, *args, shots_count=1000):
 
 
 @cudaq_sample_p.def_abstract_eval
-def cudaq_sample_abs(_kernel, *_args, shots_count=1000):  # pragma: nocover
+def cudaq_sample_abs(_kernel, *_args, shots_count=1000, packed=False):  # pragma: nocover
     """Abstract evaluation."""
     return AbsCudaSampleResult()
 
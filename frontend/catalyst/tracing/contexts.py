@@ -19,7 +19,7 @@ This module provides context classes to manage and query Catalyst's and JAX's tr
 from contextlib import contextmanager
 from dataclasses import dataclass
 from enum import Enum
-from typing import ContextManager, Dict, List, Optional, Tuple
+from typing import Any, ContextManager, Dict, List, Optional, Tuple
 
 from jax._src.core import MainTrace as JaxMainTrace
 from jax._src.core import cur_sublevel, new_base_main
@@ -81,6 +81,9 @@ class EvaluationContext:
     """
 
     _tracing_stack: List[Tuple[EvaluationMode, Optional[JaxTracingContext]]] = []
+    _decompose_state_preparations: bool = False
+    _device_options: Dict[str, Any] = {}
+    _recording_batch: bool = False
 
     def __init__(self, mode: EvaluationMode):
         """Initialise a new instance of the Evaluation context.
@@ -150,6 +153,56 @@ class EvaluationContext:
     def __exit__(self, *args, **kwargs):
         self.ctx.__exit__(*args, **kwargs)
 
+    @classmethod
+    @contextmanager
+    def decomposed_state_preparations(cls) -> ContextManager[None]:
+        """Trace the state preparations as gates rather than as native runtime state preparations,
+        so that the prepared amplitudes can be differentiated."""
+        previous = cls._decompose_state_preparations
+        cls._decompose_state_preparations = True
+        try:
+            yield
+        finally:
+            cls._decompose_state_preparations = previous
+
+    @classmethod
+    def is_decomposing_state_preparations(cls) -> bool:
+        """Returns true if the state preparations are being traced as gates."""
+        return cls._decompose_state_preparations
+
+    @classmethod
+    @contextmanager
+    def recording_batch(cls) -> ContextManager[None]:
+        """Trace the recording sweep of a batched execution. Side effects are dropped from this
+        sweep since the program runs again for each sample to collect the results."""
+        previous = cls._recording_batch
+        cls._recording_batch = True
+        try:
+            yield
+        finally:
+            cls._recording_batch = previous
+
+    @classmethod
+    def is_recording_batch(cls) -> bool:
+        """Returns true if the recording sweep of a batched execution is being traced."""
+        return cls._recording_batch
+
+    @classmethod
+    @contextmanager
+    def device_options(cls, options: Dict[str, Any]) -> ContextManager[None]:
+        """Pass the given runtime options to every device initialized while tracing."""
+        previous = cls._device_options
+        cls._device_options = dict(options)
+        try:
+            yield
+        finally:
+            cls._device_options = previous
+
+    @classmethod
+    def get_device_options(cls) -> Dict[str, Any]:
+        """Returns the runtime options passed to the devices being traced."""
+        return cls._device_options
+
     @classmethod
     def get_evaluation_mode(cls) -> Tuple[EvaluationMode, Optional[JaxTracingContext]]:
         """Return the name of the evaluation mode, paired with tracing context if applicable"""
@@ -89,6 +89,7 @@ class DeviceCapabilities:  # pylint: disable=too-many-instance-attributes
     mid_circuit_measurement_flag: bool
     runtime_code_generation_flag: bool
     dynamic_qubit_management_flag: bool
+    packed_samples_flag: bool
     options: Dict[str, bool]
 
 
@@ -427,5 +428,6 @@ def load_device_capabilities(
         mid_circuit_measurement_flag=get_compilation_flag(config, "mid_circuit_measurement"),
         runtime_code_generation_flag=get_compilation_flag(config, "runtime_code_generation"),
         dynamic_qubit_management_flag=get_compilation_flag(config, "dynamic_qubit_management"),
+        packed_samples_flag=get_compilation_flag(config, "packed_samples"),
         options=get_options(config),
     )
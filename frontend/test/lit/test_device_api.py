@@ -107,3 +107,23 @@ def test_preprocess():
 
 
 test_preprocess()
+
+
+def test_unpacked_samples():
+    """Test that samples are not packed on devices without the `packed_samples` capability."""
+
+    dev = DummyDevice(wires=2, shots=2048)
+
+    @qjit(target="mlir")
+    @qml.qnode(device=dev)
+    def circuit_sample():
+        # CHECK:   [[OBS:%.+]] = quantum.compbasis
+        # CHECK:   quantum.sample [[OBS]] {shots = 2048 : i64} : tensor<2048x2xf64>
+        # CHECK-NOT:   stablehlo.shift_right
+        qml.Hadamard(wires=0)
+        return qml.sample()
+
+    print(circuit_sample.mlir)
+
+
+test_unpacked_samples()
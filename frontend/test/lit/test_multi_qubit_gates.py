@@ -33,6 +33,8 @@ def circuit(x: float):
     # pylint: disable=line-too-long
     # CHECK: {{%.+}} = quantum.multirz({{%.+}}) {{%.+}}, {{%.+}}, {{%.+}}, {{%.+}}, {{%.+}} : !quantum.bit, !quantum.bit, !quantum.bit, !quantum.bit, !quantum.bit
     qml.MultiRZ(x, wires=[0, 1, 2, 3, 4])
+    # CHECK: {{%.+}} = quantum.paulirot "XYZ"({{%.+}}) {{%.+}}, {{%.+}}, {{%.+}} : !quantum.bit, !quantum.bit, !quantum.bit
+    qml.PauliRot(x, "XYZ", wires=[0, 2, 4])
     return measure(wires=0)
 
 
@@ -30,7 +30,13 @@ import pennylane as qml
 import pytest
 
 from catalyst import qjit
-from catalyst.compiler import DEFAULT_PIPELINES, CompileOptions, Compiler, LinkerDriver
+from catalyst.compiler import (
+    DEFAULT_PIPELINES,
+    CompileOptions,
+    Compiler,
+    LinkerDriver,
+    get_runtime_bitcode,
+)
 from catalyst.utils.exceptions import CompileError
 from catalyst.utils.filesystem import Directory
 
@@ -243,6 +249,21 @@ class TestCompilerState:
             workflow.compiler.get_output_of("None-existing-pipeline")
         workflow.workspace.cleanup()
 
+    def test_runtime_bitcode(self, backend):
+        """Test that the runtime C-API bitcode is found and linked into the program."""
+        assert get_runtime_bitcode()
+
+        @qjit(keep_intermediate=True)
+        @qml.qnode(qml.device(backend, wires=1))
+        def workflow():
+            qml.PauliX(wires=0)
+            return qml.state()
+
+        files = os.listdir(str(workflow.workspace))
+        assert any("RuntimeLinked" in f for f in files)
+        assert np.allclose(workflow(), [0, 1])
+        workflow.workspace.cleanup()
+
     def test_workspace(self):
         """Test directory has been modified with folder containing intermediate results"""
 
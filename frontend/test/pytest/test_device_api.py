@@ -16,6 +16,7 @@
 import pathlib
 import platform
 
+import numpy as np
 import pennylane as qml
 import pytest
 from pennylane.devices import Device
@@ -27,6 +28,7 @@ from catalyst import qjit
 from catalyst.compiler import get_lib_path
 from catalyst.device import QJITDeviceNewAPI, extract_backend_info
 from catalyst.tracing.contexts import EvaluationContext, EvaluationMode
+from catalyst.utils.exceptions import CompileError
 from catalyst.utils.toml import ProgramFeatures, get_device_capabilities
 
 
@@ -146,5 +148,51 @@ def test_simple_circuit():
     assert circuit.mlir
 
 
+def test_device_options():
+    """Test that the qjit device options are passed to the backend device."""
+    device = DummyDevice(wires=2)
+    capabilities = get_device_capabilities(device, ProgramFeatures(device.shots is not None))
+
+    with EvaluationContext.device_options({"option1": 42, "option2": True}):
+        backend_info = extract_backend_info(device, capabilities)
+
+    assert backend_info.kwargs["option1"] == 42
+    assert backend_info.kwargs["option2"] is True
+
+
+def test_unsupported_device_options():
+    """Test that the device options must be declared in the device TOML file."""
+    dev = DummyDevice(wires=2)
+
+    @qml.qnode(device=dev)
+    def circuit():
+        qml.Hadamard(wires=0)
+        return qml.expval(qml.PauliZ(wires=0))
+
+    with pytest.raises(CompileError, match="does not support the option 'option3'"):
+        compiled = qjit(circuit, target="mlir", device_options={"option3": 1})
+        assert compiled.mlir
+
+
+def test_seeded_lightning_samples():
+    """Test that the seed and number of threads of lightning.qubit are set through the device
+    options, and that the samples do not depend on the number of threads."""
+    dev = qml.device("lightning.qubit", wires=3, shots=1000)
+
+    def circuit():
+        for i in range(3):
+            qml.Hadamard(wires=i)
+        return qml.sample()
+
+    samples = [
+        qjit(qml.qnode(dev)(circuit), device_options={"seed": 37, "num_threads": n})()
+        for n in (1, 4)
+    ]
+    other = qjit(qml.qnode(dev)(circuit), device_options={"seed": 38})()
+
+    assert np.array_equal(samples[0], samples[1])
+    assert not np.array_equal(samples[0], other)
+
+
 if __name__ == "__main__":
     pytest.main(["-x", __file__])
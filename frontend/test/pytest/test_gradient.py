@@ -379,6 +379,31 @@ def test_adj_in_loop(inp, backend):
     assert np.allclose(compiled_grad_default(inp, 5), interpretted_grad_default(inp))
 
 
+@pytest.mark.parametrize("diff_method", ["adjoint", "parameter-shift"])
+@pytest.mark.parametrize("inp", [1.0, 2.0, 3.0, 4.0])
+def test_state_prep(inp, diff_method, backend):
+    """Test the differentiation of the amplitudes of a state preparation."""
+
+    def f(x):
+        state = jnp.array([jnp.cos(x / 2), 0, jnp.sin(x / 2), 0], dtype=jnp.complex128)
+        qml.StatePrep(state, wires=[0, 1])
+        qml.RY(x, wires=1)
+        return qml.expval(qml.PauliZ(0) @ qml.PauliZ(1))
+
+    @qjit()
+    def compiled(x: float):
+        g = qml.qnode(qml.device(backend, wires=2), diff_method=diff_method)(f)
+        h = grad(g, method="auto")
+        return h(x)
+
+    def interpreted(x):
+        device = qml.device("default.qubit", wires=2)
+        g = qml.QNode(f, device, diff_method="backprop", interface="jax")
+        return jax.grad(g)(x)
+
+    assert np.allclose(compiled(inp), interpreted(inp))
+
+
 @pytest.mark.parametrize("inp", [(1.0), (2.0), (3.0), (4.0)])
 def test_ps(inp, backend):
     """Test the ps method."""
@@ -12,12 +12,16 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
+from copy import deepcopy
+
 import numpy as np
 import pennylane as qml
 import pytest
 from jax import numpy as jnp
 
 from catalyst import qjit
+from catalyst.utils.exceptions import CompileError
+from catalyst.utils.toml import ProgramFeatures, get_device_capabilities
 
 
 class TestSample:
@@ -114,6 +118,79 @@ class TestCounts:
         observed = counts_2qbit(0, np.pi)
         assert np.array_equal(observed, expected)
 
+    def test_sparse_counts(self, backend, monkeypatch):
+        """Test that counts with more bitstrings than shots only hold the observed bitstrings."""
+        monkeypatch.setattr("catalyst.jax_tracer.MAX_DENSE_COUNTS_SIZE", 2)
+
+        @qjit
+        @qml.qnode(qml.device(backend, wires=3, shots=4))
+        def counts_3qbit(x: float):
+            qml.RX(x, wires=0)
+            qml.PauliX(wires=2)
+            return qml.counts()
+
+        expected = [np.array([1, -1, -1, -1]), np.array([4, 0, 0, 0])]
+        observed = counts_3qbit(0.0)
+        assert np.array_equal(observed, expected)
+
+        expected = [np.array([5, -1, -1, -1]), np.array([4, 0, 0, 0])]
+        observed = counts_3qbit(np.pi)
+        assert np.array_equal(observed, expected)
+
+
+class TestClassicalShadow:
+    """Test classical shadows."""
+
+    def test_classical_shadow_on_2qbits(self, backend):
+        """Test classical shadow of a Bell state."""
+        if backend != "lightning.qubit":
+            pytest.skip("classical shadows are only supported by lightning.qubit")
+
+        @qjit
+        @qml.qnode(qml.device(backend, wires=2, shots=1000))
+        def shadow_2qbits():
+            qml.Hadamard(wires=0)
+            qml.CNOT(wires=[0, 1])
+            return qml.classical_shadow(wires=[0, 1])
+
+        bits, recipes = shadow_2qbits()
+        assert bits.shape == (1000, 2)
+        assert recipes.shape == (1000, 2)
+        assert np.all((recipes >= 0) & (recipes <= 2))
+
+        # The Bell state is perfectly correlated in the X and Z bases, and anti-correlated in
+        # the Y basis.
+        for recipe, parity in [(0, 0), (1, 1), (2, 0)]:
+            same_basis = (recipes[:, 0] == recipe) & (recipes[:, 1] == recipe)
+            assert np.all((bits[same_basis, 0] ^ bits[same_basis, 1]) == parity)
+
+    def test_classical_shadow_seed(self, backend):
+        """Test that the seed of a classical shadow is rejected rather than ignored."""
+
+        @qml.qnode(qml.device(backend, wires=2, shots=1000))
+        def shadow_seeded():
+            qml.Hadamard(wires=0)
+            return qml.classical_shadow(wires=[0, 1], seed=42)
+
+        with pytest.raises(CompileError, match="seed the device instead"):
+            qjit(shadow_seeded)()
+
+    def test_classical_shadow_unsupported(self, backend):
+        """Test that classical shadows are rejected on devices that do not support them."""
+
+        dev = qml.device(backend, wires=2, shots=1000)
+        capabilities = deepcopy(get_device_capabilities(dev, ProgramFeatures(shots_present=True)))
+        capabilities.measurement_processes.discard("ClassicalShadow")
+        dev.qjit_capabilities = capabilities
+
+        @qml.qnode(dev)
+        def shadow_2qbits():
+            qml.Hadamard(wires=0)
+            return qml.classical_shadow(wires=[0, 1])
+
+        with pytest.raises(CompileError, match="Classical shadows are not supported by the device"):
+            qjit(shadow_2qbits)()
+
 
 class TestExpval:
     def test_named(self, backend):
@@ -177,6 +177,38 @@ class TestMidCircuitMeasurement:
 
         assert circuit()  # measures are different
 
+    def test_mcm_branching(self):
+        """Test that sharing the measurement branches between the executions of a program returns
+        the same results as the default path for the same seed."""
+
+        dev = qml.device("lightning.qubit", wires=3)
+
+        @qml.qnode(dev)
+        def circuit(x: float):
+            qml.RX(x, wires=0)
+            m1 = measure(wires=0)
+            qml.Hadamard(wires=1)
+            qml.CRY(m1 * x, wires=[1, 2])
+            m2 = measure(wires=2)
+            return m1, m2, qml.expval(qml.PauliZ(1))
+
+        # The executions of the same program share the pooled device, and so its branches.
+        def workflow(x: float):
+            results = [circuit(x) for _ in range(50)]
+            return tuple(jnp.stack(res) for res in zip(*results))
+
+        branching = qjit(device_options={"seed": 11, "mcm_branching": True})(workflow)
+        default = qjit(device_options={"seed": 11})(workflow)
+
+        m1, m2, expval = branching(1.2)
+        expected_m1, expected_m2, expected_expval = default(1.2)
+        assert jnp.array_equal(m1, expected_m1)
+        assert jnp.array_equal(m2, expected_m2)
+        assert jnp.allclose(expval, expected_expval)
+
+        # Both outcomes of the first measurement are reached.
+        assert 0 < jnp.sum(m1) < 50
+
 
 if __name__ == "__main__":
     pytest.main(["-x", __file__])
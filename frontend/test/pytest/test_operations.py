@@ -135,8 +135,10 @@ def test_param(backend):
 
         qml.MultiRZ(x, wires=[0, 1, 2, 3])
 
+        qml.PauliRot(x, "IXYZ", wires=[0, 1, 2, 3])
+        qml.PauliRot(y, "YZ", wires=[3, 1])
+
         # Unsupported:
-        # qml.PauliRot(x, 'IXYZ', wires=[0,1,2,3])
         # qml.U1(x, wires=0)
         # qml.U2(x, x, wires=0)
         # qml.U3(x, x, x, wires=0)
@@ -149,6 +151,53 @@ def test_param(backend):
     assert np.allclose(qjit_fn(3.14, 0.6), qml_fn(3.14, 0.6))
 
 
+def test_state_preparation(backend):
+    """Test the native state preparation of a subset of the wires."""
+
+    def circuit(x: float):
+        qml.RX(x, wires=1)
+        qml.StatePrep(np.array([0.5j, 0.5, -0.5, -0.5j]), wires=[3, 0])
+        qml.BasisState(np.array([1, 0]), wires=[2, 4])
+        qml.CNOT(wires=[0, 1])
+        return qml.state()
+
+    qjit_fn = qjit()(qml.qnode(qml.device(backend, wires=5))(circuit))
+    qml_fn = qml.qnode(qml.device("default.qubit", wires=5))(circuit)
+
+    assert np.allclose(qjit_fn(0.7), qml_fn(0.7))
+
+
+def test_controlled_state_preparation(backend):
+    """Test that controlled state preparations are decomposed into controlled gates."""
+
+    def circuit(x: float):
+        qml.Hadamard(wires=0)
+        qml.RX(x, wires=1)
+        qml.ctrl(qml.StatePrep(np.array([0.5j, 0.5, -0.5, -0.5j]), wires=[1, 2]), control=0)
+        qml.ctrl(qml.BasisState(np.array([1]), wires=[3]), control=0, control_values=[False])
+        return qml.state()
+
+    qjit_fn = qjit()(qml.qnode(qml.device(backend, wires=4))(circuit))
+    qml_fn = qml.qnode(qml.device("default.qubit", wires=4))(circuit)
+
+    assert np.allclose(qjit_fn(0.7), qml_fn(0.7))
+
+
+def test_adjoint_state_preparation(backend):
+    """Test that adjoint state preparations are decomposed into gates."""
+
+    def circuit(x: float):
+        qml.RX(x, wires=1)
+        qml.adjoint(qml.StatePrep(np.array([0.5j, 0.5, -0.5, -0.5j]), wires=[1, 2]))
+        qml.adjoint(qml.BasisState(np.array([1, 1]), wires=[0, 3]))
+        return qml.state()
+
+    qjit_fn = qjit()(qml.qnode(qml.device(backend, wires=4))(circuit))
+    qml_fn = qml.qnode(qml.device("default.qubit", wires=4))(circuit)
+
+    assert np.allclose(qjit_fn(0.7), qml_fn(0.7))
+
+
 def test_hybrid_op_repr(backend):
     """Test hybrid operation representation"""
 
@@ -711,6 +711,34 @@ class TestTransform:
         assert counts[0].shape == (8,)
         assert counts[1].shape == (8,)
 
+    def test_measurements_from_sparse_counts(self, monkeypatch):
+        """Test the transform measurements_from_counts when the device returns sparse counts,
+        i.e. the observed bitstrings padded with a bitstring of -1."""
+        monkeypatch.setattr("catalyst.jax_tracer.MAX_DENSE_COUNTS_SIZE", 2)
+        device = qml.device("lightning.qubit", wires=4, shots=10)
+
+        @qml.qjit
+        @measurements_from_counts
+        @qml.qnode(device=device)
+        def circuit(a: float):
+            qml.X(0)
+            qml.X(1)
+            qml.X(3)
+            return (
+                qml.expval(qml.PauliZ(wires=0) @ qml.PauliZ(wires=2)),
+                qml.var(qml.PauliZ(wires=1)),
+                qml.probs(wires=[2, 0]),
+                qml.counts(wires=[3, 2]),
+            )
+
+        expval, var, probs, counts = circuit(0.2)
+
+        assert np.allclose(expval, -1.0)
+        assert np.allclose(var, 0.0)
+        assert np.allclose(probs, [0, 1, 0, 0])
+        assert np.array_equal(counts[0], [0, 1, 2, 3])
+        assert np.array_equal(counts[1], [0, 0, 10, 0])
+
 
 if __name__ == "__main__":
     pytest.main(["-x", __file__])
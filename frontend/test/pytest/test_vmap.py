@@ -19,7 +19,7 @@ import jax.numpy as jnp
 import pennylane as qml
 import pytest
 
-from catalyst import qjit, vmap
+from catalyst import debug, qjit, vmap
 
 
 class TestVectorizeMap:
@@ -782,3 +782,61 @@ class TestVectorizeMap:
         expected = jnp.array([0.93005586, 0.00498127, -0.88789978])
         assert jnp.allclose(result[0], expected)
         assert jnp.allclose(result[1], expected)
+
+    def test_vmap_batched_execution(self):
+        """Test catalyst.vmap of a QNode with batched execution on lightning.qubit."""
+
+        @qjit
+        def workflow(x, coeffs):
+            @qml.qnode(qml.device("lightning.qubit", wires=3))
+            def circuit(x, coeffs):
+                qml.Hadamard(wires=0)
+                qml.RX(jnp.pi * x[0], wires=1)
+                qml.CNOT(wires=[0, 2])
+                qml.Rot(x[0], x[1], x[2], wires=2)
+                qml.CRY(x[1] ** 2, wires=[2, 1])
+                qml.IsingZZ(x[2], wires=[0, 1])
+                obs = qml.Hamiltonian(coeffs, [qml.PauliZ(1) @ qml.PauliX(2), qml.PauliY(0)])
+                return qml.expval(obs), qml.probs(wires=[1, 2]), qml.state()
+
+            res = vmap(circuit)(x, coeffs)
+            res_batched = vmap(circuit, batched_execution=True)(x, coeffs)
+            return res, res_batched
+
+        x = jnp.array([[0.1, 0.2, 0.3], [0.4, 0.5, 0.6], [0.7, 0.8, 0.9], [1.0, 1.1, 1.2]])
+        coeffs = jnp.array([[0.5, 1.0], [0.2, -1.0], [1.0, 0.3], [-0.7, 0.1]])
+
+        expected, result = workflow(x, coeffs)
+        for res, exp in zip(result, expected):
+            assert jnp.allclose(res, exp)
+
+    def test_vmap_batched_execution_callbacks(self):
+        """Test that the callbacks of a QNode with batched execution run once per sample."""
+        calls = []
+
+        @debug.callback
+        def record_call(x):
+            calls.append(x)
+
+        @qjit
+        def workflow(x):
+            @qml.qnode(qml.device("lightning.qubit", wires=1))
+            def circuit(x):
+                record_call(x)
+                qml.RX(x, wires=0)
+                return qml.expval(qml.PauliZ(0))
+
+            return vmap(circuit, batched_execution=True)(x)
+
+        x = jnp.array([0.1, 0.2, 0.3, 0.4])
+        assert jnp.allclose(workflow(x), jnp.cos(x))
+        assert jnp.allclose(jnp.array(calls), x)
+
+    def test_vmap_batched_execution_not_qnode(self):
+        """Test catalyst.vmap with batched execution of a function that is not a QNode."""
+
+        def fn(x):
+            return x + 1
+
+        with pytest.raises(ValueError, match="the mapped function must be a QNode"):
+            vmap(fn, batched_execution=True)
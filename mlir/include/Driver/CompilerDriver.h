@@ -78,6 +78,9 @@ struct CompilerOptions {
     std::vector<Pipeline> pipelinesCfg;
     /// Whether to assume that the pipelines output is a valid LLVM dialect and lower it to LLVM IR
     bool lowerToLLVM;
+    /// Path to the runtime C-API compiled to LLVM bitcode, linked into the module for inlining.
+    /// Left empty to keep the runtime calls opaque.
+    mlir::StringRef runtimeBitcode;
 
     /// Get the destination of the object file at the end of compilation.
     std::string getObjectFile() const
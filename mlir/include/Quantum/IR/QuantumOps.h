@@ -58,3 +58,17 @@ class QuantumMemory : public mlir::SideEffects::Resource::Base<QuantumMemory> {
 #include "Quantum/IR/QuantumAttributes.h.inc"
 #define GET_OP_CLASSES
 #include "Quantum/IR/QuantumOps.h.inc"
+
+//===----------------------------------------------------------------------===//
+// Quantum op utilities.
+//===----------------------------------------------------------------------===//
+
+namespace catalyst {
+namespace quantum {
+
+// Whether the operation leaves the quantum state unchanged, so that the expectation values and
+// variances around it are computed on the same state and can be reordered with it.
+bool preservesQuantumState(mlir::Operation *op);
+
+} // namespace quantum
+} // namespace catalyst
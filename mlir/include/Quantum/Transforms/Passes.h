@@ -26,6 +26,10 @@ std::unique_ptr<mlir::Pass> createEmitCatalystPyInterfacePass();
 std::unique_ptr<mlir::Pass> createCopyGlobalMemRefPass();
 std::unique_ptr<mlir::Pass> createAdjointLoweringPass();
 std::unique_ptr<mlir::Pass> createRemoveChainedSelfInversePass();
+std::unique_ptr<mlir::Pass> createRecognizeQFTPass();
+std::unique_ptr<mlir::Pass> createGroupMeasurementsPass();
+std::unique_ptr<mlir::Pass> createDeferMeasurementsPass();
+std::unique_ptr<mlir::Pass> createQubitReusePass();
 std::unique_ptr<mlir::Pass> createAnnotateFunctionPass();
 
 } // namespace catalyst
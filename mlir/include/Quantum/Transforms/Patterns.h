@@ -21,11 +21,15 @@
 namespace catalyst {
 namespace quantum {
 
+// Tags the stack slots shared by the runtime calls while converting to LLVM.
+inline constexpr llvm::StringLiteral StackSlotAttr = "catalyst.stack_slot";
+
 void populateBufferizationLegality(mlir::TypeConverter &, mlir::ConversionTarget &);
 void populateBufferizationPatterns(mlir::TypeConverter &, mlir::RewritePatternSet &);
 void populateQIRConversionPatterns(mlir::TypeConverter &, mlir::RewritePatternSet &);
 void populateAdjointPatterns(mlir::RewritePatternSet &);
 void populateSelfInversePatterns(mlir::RewritePatternSet &);
+void populateQFTPatterns(mlir::RewritePatternSet &);
 
 } // namespace quantum
 } // namespace catalyst
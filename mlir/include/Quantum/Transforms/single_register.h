@@ -0,0 +1,33 @@
+// Copyright 2024 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <optional>
+#include <utility>
+
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+
+#include "Quantum/IR/QuantumOps.h"
+
+namespace catalyst {
+namespace quantum {
+
+// The allocation and release of the single register of the function, in the same block, or
+// std::nullopt if the function allocates several registers or measures the state of every qubit
+// of the device, which the transforms changing the qubits of the device cannot preserve.
+std::optional<std::pair<AllocOp, DeallocOp>> getSingleRegister(mlir::func::FuncOp func);
+
+} // namespace quantum
+} // namespace catalyst
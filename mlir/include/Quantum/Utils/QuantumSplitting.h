@@ -19,12 +19,17 @@ namespace quantum {
 
 /// A collection of the data required to reconstruct a deterministic hybrid quantum program with
 /// classical preprocessing and arbitrary classical control flow.
+///
+/// Only values that cannot be recomputed when re-executing the program are cached (see
+/// `isRecomputable`). The vectors are null when nothing needs to be stored in them.
 struct QuantumCache {
+    mlir::Region *topLevelRegion;
     mlir::TypedValue<ArrayListType> paramVector;
     mlir::TypedValue<ArrayListType> wireVector;
     /// For every structured control flow op, store the values required for it to execute.
     /// Specifically: store the conditions for scf.if ops, the start/stop/step of scf.for ops, and
-    /// the number of iterations for scf.while ops.
+    /// the number of iterations for scf.while ops. Ops whose values are all recomputable have no
+    /// tape.
     mlir::DenseMap<mlir::Operation *, mlir::TypedValue<ArrayListType>> controlFlowTapes;
 
     /// Initialize the quantum cache to traverse and store the necessary parameters for the given
@@ -33,6 +38,15 @@ struct QuantumCache {
                                    mlir::Location loc);
 
     void emitDealloc(mlir::OpBuilder &builder, mlir::Location loc);
+
+    /// Whether `value` can be recomputed when re-executing the program instead of being cached.
+    /// This holds for values defined outside of the top-level region or at its top level, for the
+    /// induction variables of scf.for ops, and for the results of pure ops computed from such
+    /// values. Anything else, e.g. loop-carried values or results of calls, has to be cached.
+    bool isRecomputable(mlir::Value value) const;
+
+    /// Memoized results of `isRecomputable` for values defined inside the top-level region.
+    mutable mlir::DenseMap<mlir::Value, bool> recomputable;
 };
 
 class AugmentedCircuitGenerator {
@@ -65,7 +79,7 @@ class AugmentedCircuitGenerator {
     // Emit an operation to cache a dynamic wire for quantum.insert/extract ops.
     template <typename IndexingOp> void cacheDynamicWire(IndexingOp op, mlir::OpBuilder &builder)
     {
-        if (!op.getIdxAttr().has_value()) {
+        if (!op.getIdxAttr().has_value() && !cache.isRecomputable(op.getIdx())) {
             builder.create<ListPushOp>(op.getLoc(), oldToCloned.lookupOrDefault(op.getIdx()),
                                        cache.wireVector);
         }
@@ -39,6 +39,10 @@ void catalyst::registerAllCatalystPasses()
     mlir::registerPass(catalyst::createAddExceptionHandlingPass);
     mlir::registerPass(catalyst::createGEPInboundsPass);
     mlir::registerPass(catalyst::createRemoveChainedSelfInversePass);
+    mlir::registerPass(catalyst::createRecognizeQFTPass);
+    mlir::registerPass(catalyst::createGroupMeasurementsPass);
+    mlir::registerPass(catalyst::createDeferMeasurementsPass);
+    mlir::registerPass(catalyst::createQubitReusePass);
     mlir::registerPass(catalyst::createAnnotateFunctionPass);
     mlir::registerPass(catalyst::createRegisterInactiveCallbackPass);
 }
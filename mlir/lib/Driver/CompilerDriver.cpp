@@ -36,7 +36,9 @@
 #include "stablehlo/dialect/Register.h"
 #include "llvm/Analysis/CGSCCPassManager.h"
 #include "llvm/Analysis/LoopAnalysisManager.h"
+#include "llvm/IR/InstIterator.h"
 #include "llvm/IRReader/IRReader.h"
+#include "llvm/Linker/Linker.h"
 #include "llvm/Passes/PassBuilder.h"
 #include "llvm/Support/SourceMgr.h"
 
@@ -277,6 +279,58 @@ void registerAllCatalystDialects(DialectRegistry &registry)
     registry.insert<gradient::GradientDialect>();
     registry.insert<mitigation::MitigationDialect>();
 }
+
+/// Whether the constants and instructions of `fn` only reference global values that can be copied
+/// into the user module. Mutable globals with internal linkage (e.g. the execution context of the
+/// runtime) cannot: a copy would be distinct from the state of the runtime library.
+bool isImportableRuntimeFunction(llvm::Function &fn, llvm::DenseMap<llvm::Function *, bool> &cache)
+{
+    // Assume recursive functions are importable until proven otherwise.
+    auto [entry, inserted] = cache.try_emplace(&fn, true);
+    if (!inserted) {
+        return entry->second;
+    }
+
+    auto isImportableGlobal = [&](llvm::GlobalValue *gv) {
+        if (auto *var = dyn_cast<llvm::GlobalVariable>(gv)) {
+            return var->isConstant() || !(var->hasLocalLinkage() || var->isThreadLocal());
+        }
+        if (auto *callee = dyn_cast<llvm::Function>(gv)) {
+            // Other external functions remain calls into the runtime library.
+            if (callee->isDeclaration() || callee->hasExternalLinkage()) {
+                return true;
+            }
+            return isImportableRuntimeFunction(*callee, cache);
+        }
+        return false;
+    };
+
+    SmallVector<llvm::Constant *> worklist;
+    llvm::SmallPtrSet<llvm::Constant *, 16> visited;
+    for (llvm::Instruction &inst : llvm::instructions(fn)) {
+        for (llvm::Value *operand : inst.operands()) {
+            if (auto *constant = dyn_cast<llvm::Constant>(operand)) {
+                worklist.push_back(constant);
+            }
+        }
+    }
+    while (!worklist.empty()) {
+        llvm::Constant *constant = worklist.pop_back_val();
+        if (!visited.insert(constant).second) {
+            continue;
+        }
+        if (auto *gv = dyn_cast<llvm::GlobalValue>(constant)) {
+            if (!isImportableGlobal(gv)) {
+                return cache[&fn] = false;
+            }
+            continue;
+        }
+        for (llvm::Value *operand : constant->operands()) {
+            worklist.push_back(cast<llvm::Constant>(operand));
+        }
+    }
+    return cache[&fn] = true;
+}
 } // namespace
 
 FailureOr<llvm::Function *> getJITFunction(MLIRContext *ctx, llvm::Module &llvmModule)
@@ -353,6 +407,88 @@ LogicalResult inferMLIRReturnTypes(MLIRContext *ctx, llvm::Type *returnType,
     return failure();
 }
 
+/// Link the runtime C-API, shipped as LLVM bitcode, into the module so that the O2 pipeline can
+/// inline the runtime entry points down to the device calls.
+///
+/// The entry points are imported as `available_externally` definitions: they are only used for
+/// inlining, and the calls left after optimization still resolve to the runtime library. Entry
+/// points touching the internal state of the runtime are not imported.
+LogicalResult linkRuntimeBitcode(const CompilerOptions &options,
+                                 std::shared_ptr<llvm::Module> llvmModule, CompilerOutput &output)
+{
+    if (options.runtimeBitcode.empty()) {
+        return success();
+    }
+
+    llvm::SMDiagnostic err;
+    std::unique_ptr<llvm::Module> runtime =
+        llvm::parseIRFile(options.runtimeBitcode, err, llvmModule->getContext());
+    if (!runtime) {
+        // The runtime calls stay opaque, e.g. if the bitcode was produced by a newer LLVM.
+        CO_MSG(options, Verbosity::Debug,
+               "Unable to load the runtime bitcode: " << err.getMessage() << "\n");
+        return success();
+    }
+
+    // Static initializers would set up a second copy of the runtime state.
+    for (StringRef name :
+         {"llvm.global_ctors", "llvm.global_dtors", "llvm.used", "llvm.compiler.used"}) {
+        if (llvm::GlobalVariable *gv = runtime->getNamedGlobal(name)) {
+            gv->eraseFromParent();
+        }
+    }
+
+    llvm::DenseMap<llvm::Function *, bool> importable;
+    for (llvm::Function &fn : *runtime) {
+        if (fn.isDeclaration()) {
+            continue;
+        }
+
+        // The generated functions carry no target attributes, and the inliner only accepts
+        // callees whose target attributes match the caller's.
+        fn.removeFnAttr("target-cpu");
+        fn.removeFnAttr("target-features");
+        fn.removeFnAttr("tune-cpu");
+        if (fn.hasFnAttribute(llvm::Attribute::OptimizeNone)) {
+            fn.removeFnAttr(llvm::Attribute::OptimizeNone);
+            fn.removeFnAttr(llvm::Attribute::NoInline);
+        }
+
+        if (!fn.hasExternalLinkage()) {
+            continue;
+        }
+        if (fn.getName().starts_with("__catalyst__") &&
+            isImportableRuntimeFunction(fn, importable)) {
+            fn.setLinkage(llvm::GlobalValue::AvailableExternallyLinkage);
+        }
+        else {
+            fn.deleteBody();
+        }
+        fn.setComdat(nullptr);
+    }
+
+    // The mutable globals of the runtime library are referenced, never copied.
+    for (llvm::GlobalVariable &gv : runtime->globals()) {
+        if (!gv.isDeclaration() && !gv.isConstant() && !gv.hasLocalLinkage()) {
+            gv.setInitializer(nullptr);
+            gv.setLinkage(llvm::GlobalValue::ExternalLinkage);
+            gv.setComdat(nullptr);
+        }
+    }
+
+    if (llvm::Linker::linkModules(*llvmModule, std::move(runtime),
+                                  llvm::Linker::Flags::LinkOnlyNeeded)) {
+        CO_MSG(options, Verbosity::Urgent, "Failed to link the runtime bitcode\n");
+        return failure();
+    }
+
+    if (options.keepIntermediate) {
+        dumpToFile(options, output.nextPipelineDumpFilename("RuntimeLinked", ".ll"), *llvmModule);
+    }
+
+    return success();
+}
+
 LogicalResult runLLVMPasses(const CompilerOptions &options,
                             std::shared_ptr<llvm::Module> llvmModule, CompilerOutput &output)
 {
@@ -608,6 +744,11 @@ LogicalResult QuantumDriverMain(const CompilerOptions &options, CompilerOutput &
     }
 
     if (llvmModule) {
+        if (failed(timer::timer(linkRuntimeBitcode, "linkRuntimeBitcode", /* add_endl */ false,
+                                options, llvmModule, output))) {
+            return failure();
+        }
+
         if (failed(timer::timer(runLLVMPasses, "runLLVMPasses", /* add_endl */ false, options,
                                 llvmModule, output))) {
             return failure();
@@ -96,11 +96,12 @@ struct AdjointOpPattern : public ConvertOpToLLVMPattern<AdjointOp> {
         assert(callee && callee.getNumResults() == 1 && "invalid qfunc symbol in adjoint op");
 
         StringRef cacheFnName = "__catalyst__rt__toggle_recorder";
-        StringRef gradFnName = "__catalyst__qis__Gradient";
+        StringRef gradFnName = "__catalyst__qis__Gradient_array";
+        Type ptrType = LLVM::LLVMPointerType::get(ctx);
         Type cacheFnSignature =
             LLVM::LLVMFunctionType::get(LLVM::LLVMVoidType::get(ctx), IntegerType::get(ctx, 1));
-        Type gradFnSignature = LLVM::LLVMFunctionType::get(
-            LLVM::LLVMVoidType::get(ctx), IntegerType::get(ctx, 64), /*isVarArg=*/true);
+        Type gradFnSignature = LLVM::LLVMFunctionType::get(LLVM::LLVMVoidType::get(ctx),
+                                                           {IntegerType::get(ctx, 64), ptrType});
 
         LLVM::LLVMFuncOp cacheFnDecl =
             ensureFunctionDeclaration(rewriter, op, cacheFnName, cacheFnSignature);
@@ -119,20 +120,34 @@ struct AdjointOpPattern : public ConvertOpToLLVMPattern<AdjointOp> {
         rewriter.create<LLVM::CallOp>(loc, cacheFnDecl, c_false);
 
         // We follow the C ABI convention of passing result memrefs as struct pointers in the
-        // arguments to the C function, although in this case as a variadic argument list to allow
-        // for a varying number of results in a single signature.
-        Value c1 = rewriter.create<LLVM::ConstantOp>(loc, rewriter.getI64IntegerAttr(1));
-        Value numResults = rewriter.create<LLVM::ConstantOp>(
-            loc, rewriter.getI64IntegerAttr(op.getDataIn().size()));
-        SmallVector<Value> args = {numResults};
-        for (Value memref : adaptor.getDataIn()) {
-            Value newArg = rewriter.create<LLVM::AllocaOp>(
-                loc, LLVM::LLVMPointerType::get(rewriter.getContext()), vectorType, c1);
+        // arguments to the C function, although in this case as an array of pointers to allow
+        // for a varying number of results in a single signature. The structs and the array are
+        // allocated in the entry block of the enclosing function, so that adjoint ops in loops do
+        // not grow the stack.
+        const int64_t numDataIn = op.getDataIn().size();
+        Value memrefs, results;
+        {
+            PatternRewriter::InsertionGuard insertGuard(rewriter);
+            Operation *scope = op->getParentWithTrait<OpTrait::AutomaticAllocationScope>();
+            assert(scope && "expected an allocation scope for the adjoint op");
+            rewriter.setInsertionPointToStart(&scope->getRegion(0).front());
+            Value numSlots =
+                rewriter.create<LLVM::ConstantOp>(loc, rewriter.getI64IntegerAttr(numDataIn));
+            memrefs = rewriter.create<LLVM::AllocaOp>(loc, ptrType, vectorType, numSlots);
+            results = rewriter.create<LLVM::AllocaOp>(loc, ptrType, ptrType, numSlots);
+        }
+        Value numResults =
+            rewriter.create<LLVM::ConstantOp>(loc, rewriter.getI64IntegerAttr(numDataIn));
+        for (auto [i, memref] : llvm::enumerate(adaptor.getDataIn())) {
+            Value newArg = rewriter.create<LLVM::GEPOp>(loc, ptrType, vectorType, memrefs,
+                                                        llvm::ArrayRef<LLVM::GEPArg>{i}, true);
             rewriter.create<LLVM::StoreOp>(loc, memref, newArg);
-            args.push_back(newArg);
+            Value itemPtr = rewriter.create<LLVM::GEPOp>(loc, ptrType, ptrType, results,
+                                                         llvm::ArrayRef<LLVM::GEPArg>{i}, true);
+            rewriter.create<LLVM::StoreOp>(loc, newArg, itemPtr);
         }
 
-        rewriter.create<LLVM::CallOp>(loc, gradFnDecl, args);
+        rewriter.create<LLVM::CallOp>(loc, gradFnDecl, ValueRange{numResults, results});
         rewriter.create<catalyst::quantum::DeallocOp>(loc, qreg);
         rewriter.create<catalyst::quantum::DeviceReleaseOp>(loc);
 
@@ -27,14 +27,11 @@
 namespace catalyst {
 namespace gradient {
 
-static Value genSelectiveShift(PatternRewriter &rewriter, Location loc, Value param, Value shift,
+/// Generate the condition under which gates in the current loop nest are shifted, that is when
+/// all active iteration variables match the selectors.
+static Value genShiftCondition(PatternRewriter &rewriter, Location loc,
                                const std::vector<std::pair<Value, Value>> &selectors)
 {
-    if (selectors.empty()) {
-        return rewriter.create<arith::AddFOp>(loc, shift, param);
-    }
-
-    // Make sure all active iteration variables match the selectors.
     Value shiftCondition = rewriter.create<arith::ConstantIntOp>(loc, true, 1);
     for (auto &[iteration, selector] : selectors) {
         Value iterationMatch =
@@ -42,6 +39,16 @@ static Value genSelectiveShift(PatternRewriter &rewriter, Location loc, Value pa
         shiftCondition = rewriter.create<arith::AndIOp>(loc, shiftCondition, iterationMatch);
     }
 
+    return shiftCondition;
+}
+
+static Value genSelectiveShift(PatternRewriter &rewriter, Location loc, Value param, Value shift,
+                               Value shiftCondition)
+{
+    if (!shiftCondition) {
+        return rewriter.create<arith::AddFOp>(loc, shift, param);
+    }
+
     scf::IfOp ifOp = rewriter.create<scf::IfOp>(
         loc, shiftCondition,
         [&](OpBuilder &builder, Location loc) { // then
@@ -89,6 +96,14 @@ func::FuncOp ParameterShiftLowering::genShiftFunction(PatternRewriter &rewriter,
         std::vector<std::pair<Value, Value>> selectors;
         selectors.reserve(loopDepth);
 
+        Value zero;
+        {
+            PatternRewriter::InsertionGuard insertGuard(rewriter);
+            rewriter.setInsertionPointToStart(&shiftedFn.getBody().front());
+            zero = rewriter.create<arith::ConstantFloatOp>(loc, APFloat(0.0),
+                                                           rewriter.getF64Type());
+        }
+
         int shiftsProcessed = 0;
         shiftedFn.walk<WalkOrder::PreOrder>([&](Operation *op) {
             // TODO: Add support for other SCF (and Affine?) loops in the future.
@@ -116,13 +131,31 @@ func::FuncOp ParameterShiftLowering::genShiftFunction(PatternRewriter &rewriter,
                 std::vector<Value> shiftedParams;
                 shiftedParams.reserve(params.size());
 
+                Value shiftCondition =
+                    selectors.empty() ? nullptr : genShiftCondition(rewriter, loc, selectors);
+                Value diverges;
+
                 for (size_t i = 0; i < params.size(); i++) {
                     Value idx = rewriter.create<index::ConstantOp>(loc, shiftsProcessed++);
                     Value shift = rewriter.create<tensor::ExtractOp>(loc, shiftVector, idx);
                     Value shiftedParam =
-                        genSelectiveShift(rewriter, loc, params[i], shift, selectors);
+                        genSelectiveShift(rewriter, loc, params[i], shift, shiftCondition);
                     shiftedParams.push_back(shiftedParam);
+
+                    Value isShifted = rewriter.create<arith::CmpFOp>(
+                        loc, arith::CmpFPredicate::ONE, shift, zero);
+                    diverges =
+                        i ? rewriter.create<arith::OrIOp>(loc, diverges, isShifted).getResult()
+                          : isShifted;
+                }
+
+                // All the shifted executions share the circuit up to the shifted gate. Mark the
+                // gate so that the device can snapshot the state prepared by the common prefix
+                // once, and restore it in the next executions instead of simulating it again.
+                if (shiftCondition) {
+                    diverges = rewriter.create<arith::AndIOp>(loc, shiftCondition, diverges);
                 }
+                rewriter.create<quantum::CheckpointOp>(loc, diverges);
 
                 gate->setOperands(gate.getDiffOperandIdx(), shiftedParams.size(), shiftedParams);
             }
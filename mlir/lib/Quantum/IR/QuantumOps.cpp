@@ -14,6 +14,7 @@
 
 #include "mlir/IR/Builders.h"
 #include "mlir/IR/OpImplementation.h"
+#include "mlir/Interfaces/CallInterfaces.h"
 #include "llvm/ADT/TypeSwitch.h"
 #include <optional>
 
@@ -31,10 +32,35 @@ using namespace catalyst::quantum;
 #define GET_OP_CLASSES
 #include "Quantum/IR/QuantumOps.cpp.inc"
 
+//===----------------------------------------------------------------------===//
+// Quantum op utilities.
+//===----------------------------------------------------------------------===//
+
+// Gates and mid-circuit measurements are free of memory effects in the value semantics of the
+// dialect, but they still change the state of the device when executed, and so may the calls and
+// the operations with regions.
+bool catalyst::quantum::preservesQuantumState(Operation *op)
+{
+    if (op->getNumRegions() || isa<QuantumGate, MeasureOp, CallOpInterface>(op)) {
+        return false;
+    }
+    return isa<MeasurementProcess>(op) || isMemoryEffectFree(op);
+}
+
 //===----------------------------------------------------------------------===//
 // Quantum op canonicalizers.
 //===----------------------------------------------------------------------===//
 
+LogicalResult AllocOp::canonicalize(AllocOp alloc, mlir::PatternRewriter &rewriter)
+{
+    if (alloc->use_empty()) {
+        rewriter.eraseOp(alloc);
+        return success();
+    }
+
+    return failure();
+}
+
 LogicalResult DeallocOp::canonicalize(DeallocOp dealloc, mlir::PatternRewriter &rewriter)
 {
     if (auto alloc = dyn_cast_if_present<AllocOp>(dealloc.getQreg().getDefiningOp())) {
@@ -101,6 +127,37 @@ OpFoldResult InsertOp::fold(FoldAdaptor adaptor)
     return nullptr;
 }
 
+LogicalResult VarianceOp::canonicalize(VarianceOp var, mlir::PatternRewriter &rewriter)
+{
+    // Merge the variance with an expectation value of the same observable, computed on the same
+    // state, so that the observable is applied to the state only once.
+    for (Operation *user : var.getObs().getUsers()) {
+        auto expval = dyn_cast<ExpvalOp>(user);
+        if (!expval || expval->getBlock() != var->getBlock() ||
+            expval.getShotsAttr() != var.getShotsAttr()) {
+            continue;
+        }
+
+        bool expvalFirst = expval->isBeforeInBlock(var);
+        Operation *first = expvalFirst ? expval.getOperation() : var.getOperation();
+        Operation *last = expvalFirst ? var.getOperation() : expval.getOperation();
+        if (!std::all_of(std::next(first->getIterator()), last->getIterator(),
+                         [](Operation &op) { return preservesQuantumState(&op); })) {
+            continue;
+        }
+
+        rewriter.setInsertionPoint(first);
+        auto fused = rewriter.create<ExpvalVarOp>(first->getLoc(), rewriter.getF64Type(),
+                                                  rewriter.getF64Type(), var.getObs(),
+                                                  var.getShotsAttr());
+        rewriter.replaceOp(expval, fused.getExpval());
+        rewriter.replaceOp(var, fused.getVariance());
+        return success();
+    }
+
+    return failure();
+}
+
 //===----------------------------------------------------------------------===//
 // Quantum op verifiers.
 //===----------------------------------------------------------------------===//
@@ -159,6 +216,20 @@ static LogicalResult verifyTensorResult(Type ty, int64_t length0, int64_t length
 
 // ----- gates
 
+LogicalResult PauliRotOp::verify()
+{
+    StringRef word = getPauliWord();
+    if (word.size() != getInQubits().size()) {
+        return emitOpError() << "expected a Pauli word of length " << getInQubits().size()
+                             << ", got \"" << word << "\"";
+    }
+    if (word.find_first_not_of("IXYZ") != StringRef::npos) {
+        return emitOpError() << "invalid Pauli word \"" << word << "\"";
+    }
+
+    return success();
+}
+
 LogicalResult QubitUnitaryOp::verify()
 {
     size_t dim = std::pow(2, getInQubits().size());
@@ -169,6 +240,37 @@ LogicalResult QubitUnitaryOp::verify()
     return success();
 }
 
+// ----- state preparation
+
+LogicalResult SetStateOp::verify()
+{
+    if (getInQubits().size() != getOutQubits().size()) {
+        return emitOpError() << "number of qubits in input (" << getInQubits().size() << ") "
+                             << "and output (" << getOutQubits().size() << ") must be the same";
+    }
+
+    size_t dim = std::pow(2, getInQubits().size());
+    if (failed(verifyTensorResult(getInState().getType(), dim))) {
+        return emitOpError("The state must be of size 2^(num_qubits)");
+    }
+
+    return success();
+}
+
+LogicalResult SetBasisStateOp::verify()
+{
+    if (getInQubits().size() != getOutQubits().size()) {
+        return emitOpError() << "number of qubits in input (" << getInQubits().size() << ") "
+                             << "and output (" << getOutQubits().size() << ") must be the same";
+    }
+
+    if (failed(verifyTensorResult(getBasisState().getType(), getInQubits().size()))) {
+        return emitOpError("The basis state must have one bit per qubit");
+    }
+
+    return success();
+}
+
 // ----- measurements
 
 LogicalResult HermitianOp::verify()
@@ -192,8 +294,21 @@ LogicalResult SampleOp::verify()
     }
 
     Type toVerify = getSamples() ? getSamples().getType() : getInData().getType();
-    if (getObs().getDefiningOp<ComputationalBasisOp>() &&
-        failed(verifyTensorResult(toVerify, getShots(), numQubits))) {
+    if (isPacked()) {
+        // Bit-packed samples hold the index of each sampled basis state in a 64-bit integer.
+        if (!getObs().getDefiningOp<ComputationalBasisOp>()) {
+            return emitOpError("bit-packed samples are only supported in the computational basis");
+        }
+        if (numQubits > 64) {
+            return emitOpError("bit-packed samples are limited to 64 qubits");
+        }
+        if (failed(verifyTensorResult(toVerify, getShots()))) {
+            return emitOpError("bit-packed samples must have 1D static shape equal to "
+                               "(number of shots)");
+        }
+    }
+    else if (getObs().getDefiningOp<ComputationalBasisOp>() &&
+             failed(verifyTensorResult(toVerify, getShots(), numQubits))) {
         // In the computational basis, Pennylane adds a second dimension for the number of qubits.
         return emitOpError("return tensor must have 2D static shape equal to "
                            "(number of shots, number of qubits in observable)");
@@ -207,6 +322,33 @@ LogicalResult SampleOp::verify()
     return success();
 }
 
+LogicalResult ShadowOp::verify()
+{
+    size_t numQubits;
+    if (failed(verifyObservable(getObs(), &numQubits))) {
+        return emitOpError("observable must be locally defined");
+    }
+
+    if (!((bool)getRecords() ^ (bool)getInData())) {
+        return emitOpError("either tensors must be returned or memrefs must be used as inputs");
+    }
+
+    if (!getObs().getDefiningOp<ComputationalBasisOp>()) {
+        return emitOpError("classical shadows must be measured in the computational basis");
+    }
+    if (numQubits > 32) {
+        // The bases of each shot are packed with 2 bits per qubit in a 64-bit integer.
+        return emitOpError("classical shadows are limited to 32 qubits");
+    }
+
+    Type toVerify = getRecords() ? getRecords().getType() : getInData().getType();
+    if (failed(verifyTensorResult(toVerify, getShots(), 2))) {
+        return emitOpError("return tensor must have 2D static shape equal to (number of shots, 2)");
+    }
+
+    return success();
+}
+
 LogicalResult CountsOp::verify()
 {
     size_t numQubits = 0;
@@ -227,6 +369,15 @@ LogicalResult CountsOp::verify()
         return emitOpError("cannot determine the number of eigenvalues for general observable");
     }
 
+    if (getSparse()) {
+        if (!getObs().getDefiningOp<ComputationalBasisOp>()) {
+            return emitOpError("sparse counts are only supported in the computational basis");
+        }
+        // Sparse counts only hold the measured bitstrings, of which there are at most as many as
+        // shots.
+        numEigvals = getShots();
+    }
+
     bool xor_eigvals = (bool)getEigvals() ^ (bool)getInEigvals();
     bool xor_counts = (bool)getCounts() ^ (bool)getInCounts();
     bool is_valid = xor_eigvals && xor_counts;
@@ -58,8 +58,9 @@ Value cloneAdjointRegion(AdjointOp op, OpBuilder &builder, IRMapping &mapping)
     return mapping.lookupOrDefault(yieldOp.getOperand(0));
 }
 
-/// A class that generates the quantum "backwards pass" of the adjoint operation using the stored
-/// gate parameters and cached control flow.
+/// A class that generates the quantum "backwards pass" of the adjoint operation. Classical values
+/// are recomputed where possible, otherwise they are read from the stored gate parameters and
+/// cached control flow.
 class AdjointGenerator {
   public:
     AdjointGenerator(IRMapping &remappedValues, QuantumCache &cache)
@@ -71,7 +72,9 @@ class AdjointGenerator {
     /// quantum gates.
     LogicalResult generate(Region &region, OpBuilder &builder)
     {
+        recomputedScopes.emplace_back();
         generateImpl(region, builder);
+        recomputedScopes.pop_back();
         return failure(generationFailed);
     }
 
@@ -135,11 +138,41 @@ class AdjointGenerator {
     {
         Value dynamicWire;
         if (!op.getIdxAttr().has_value()) {
-            dynamicWire = builder.create<ListPopOp>(op.getLoc(), cache.wireVector);
+            dynamicWire = cache.isRecomputable(op.getIdx())
+                              ? recompute(op.getIdx(), builder)
+                              : (Value)builder.create<ListPopOp>(op.getLoc(), cache.wireVector);
         }
         return dynamicWire;
     }
 
+    /// Emit the computation of the recomputable classical `value` at the current insertion point,
+    /// reusing the values already recomputed in the enclosing regions.
+    Value recompute(Value value, OpBuilder &builder)
+    {
+        if (!cache.topLevelRegion->isAncestor(value.getParentRegion())) {
+            return value;
+        }
+        for (IRMapping &scope : llvm::reverse(recomputedScopes)) {
+            if (Value recomputed = scope.lookupOrNull(value)) {
+                return recomputed;
+            }
+        }
+
+        Operation *op = value.getDefiningOp();
+        assert(op && "expected the induction variables of reversed loops to be mapped");
+        if (op->getParentRegion() == cache.topLevelRegion) {
+            return remappedValues.lookup(value);
+        }
+
+        IRMapping operandMapping;
+        for (Value operand : op->getOperands()) {
+            operandMapping.map(operand, recompute(operand, builder));
+        }
+        Operation *clone = builder.clone(*op, operandMapping);
+        recomputedScopes.back().map(op->getResults(), clone->getResults());
+        return recomputedScopes.back().lookup(value);
+    }
+
     std::optional<Value> getQuantumReg(ValueRange values)
     {
         for (Value value : values) {
@@ -160,7 +193,7 @@ class AdjointGenerator {
         auto clone = cast<QuantumGate>(builder.clone(*gate, remappedValues));
         clone.setAdjointFlag(!gate.getAdjointFlag());
 
-        // Read cached parameters from the recorded parameter vector.
+        // Recompute the parameters, or read them from the recorded parameter vector.
         mlir::Operation *operation = gate;
         if (auto parametrizedGate = dyn_cast<quantum::ParametrizedGate>(operation)) {
             OpBuilder::InsertionGuard insertionGuard(builder);
@@ -170,6 +203,11 @@ class AdjointGenerator {
             SmallVector<Value> cachedParams(numParams);
             // popping gives the parameters in reverse
             for (auto [idx, param] : llvm::enumerate(llvm::reverse(params))) {
+                if (cache.isRecomputable(param)) {
+                    cachedParams[numParams - 1 - idx] = recompute(param, builder);
+                    continue;
+                }
+
                 Type paramType = param.getType();
                 verifyTypeIsCacheable(paramType, operation);
                 if (paramType.isF64()) {
@@ -376,12 +414,33 @@ class AdjointGenerator {
             return;
         }
 
-        Value tape = cache.controlFlowTapes.at(forOp);
-        // Popping the start, stop, and step implies that these are backwards relative to
-        // the order they were pushed.
-        Value step = builder.create<ListPopOp>(forOp.getLoc(), tape);
-        Value stop = builder.create<ListPopOp>(forOp.getLoc(), tape);
-        Value start = builder.create<ListPopOp>(forOp.getLoc(), tape);
+        Value start, stop, step;
+        if (Value tape = cache.controlFlowTapes.lookup(forOp)) {
+            // Popping the start, stop, and step implies that these are backwards relative to
+            // the order they were pushed.
+            step = builder.create<ListPopOp>(forOp.getLoc(), tape);
+            stop = builder.create<ListPopOp>(forOp.getLoc(), tape);
+            start = builder.create<ListPopOp>(forOp.getLoc(), tape);
+        }
+        else {
+            start = recompute(forOp.getLowerBound(), builder);
+            stop = recompute(forOp.getUpperBound(), builder);
+            step = recompute(forOp.getStep(), builder);
+        }
+
+        // Values recomputed from the induction variable need to see the iterations in reverse,
+        // i.e. `iv` maps to `start + last - iv` where `last` is the final induction variable.
+        Value ivReflection;
+        if (!forOp.getInductionVar().use_empty()) {
+            Location loc = forOp.getLoc();
+            Value c1 = builder.create<index::ConstantOp>(loc, 1);
+            Value span = builder.create<index::SubOp>(loc, stop, start);
+            span = builder.create<index::SubOp>(loc, span, c1);
+            Value lastIteration = builder.create<index::DivSOp>(loc, span, step);
+            Value last = builder.create<index::MulOp>(loc, lastIteration, step);
+            last = builder.create<index::AddOp>(loc, start, last);
+            ivReflection = builder.create<index::AddOp>(loc, start, last);
+        }
 
         Value reversedResult = remappedValues.lookup(getQuantumReg(forOp.getResults()).value());
         auto replacedFor = builder.create<scf::ForOp>(
@@ -390,10 +449,16 @@ class AdjointGenerator {
                 OpBuilder::InsertionGuard insertionGuard(builder);
                 builder.restoreInsertionPoint(bodyBuilder.saveInsertionPoint());
 
+                recomputedScopes.emplace_back();
+                if (ivReflection) {
+                    Value reversedIv = builder.create<index::SubOp>(loc, ivReflection, iv);
+                    recomputedScopes.back().map(forOp.getInductionVar(), reversedIv);
+                }
                 remappedValues.map(yieldedQureg.value(), iterArgs[0]);
                 generateImpl(forOp.getBodyRegion(), builder);
                 builder.create<scf::YieldOp>(
                     loc, remappedValues.lookup(getQuantumReg(forOp.getRegionIterArgs()).value()));
+                recomputedScopes.pop_back();
             });
         remappedValues.map(getQuantumReg(forOp.getInitArgs()).value(), replacedFor.getResult(0));
     }
@@ -406,9 +471,15 @@ class AdjointGenerator {
             return;
         }
 
-        Value tape = cache.controlFlowTapes.at(ifOp);
-        Value condition = builder.create<ListPopOp>(ifOp.getLoc(), tape);
-        condition = builder.create<index::CastSOp>(ifOp.getLoc(), builder.getI1Type(), condition);
+        Value condition;
+        if (Value tape = cache.controlFlowTapes.lookup(ifOp)) {
+            condition = builder.create<ListPopOp>(ifOp.getLoc(), tape);
+            condition =
+                builder.create<index::CastSOp>(ifOp.getLoc(), builder.getI1Type(), condition);
+        }
+        else {
+            condition = recompute(ifOp.getCondition(), builder);
+        }
         Value reversedResult = remappedValues.lookup(getQuantumReg(ifOp.getResults()).value());
 
         // The quantum register is captured from outside rather than passed in through a
@@ -431,7 +502,9 @@ class AdjointGenerator {
                 std::optional<Value> yieldedQureg =
                     getQuantumReg(oldRegion.front().getTerminator()->getOperands());
                 remappedValues.map(yieldedQureg.value(), reversedResult);
+                recomputedScopes.emplace_back();
                 generateImpl(oldRegion, builder);
+                recomputedScopes.pop_back();
                 builder.create<scf::YieldOp>(
                     loc, remappedValues.lookup(findOldestQuregInRegion(oldRegion)));
             };
@@ -469,7 +542,9 @@ class AdjointGenerator {
                 builder.restoreInsertionPoint(bodyBuilder.saveInsertionPoint());
 
                 remappedValues.map(yieldedQureg.value(), iterArgs[0]);
+                recomputedScopes.emplace_back();
                 generateImpl(whileOp.getAfter(), builder);
+                recomputedScopes.pop_back();
                 builder.create<scf::YieldOp>(
                     loc, remappedValues.lookup(
                              getQuantumReg(whileOp.getAfter().front().getArguments()).value()));
@@ -480,6 +555,8 @@ class AdjointGenerator {
   private:
     IRMapping &remappedValues;
     QuantumCache &cache;
+    /// Values recomputed in each of the regions being generated, innermost last.
+    SmallVector<IRMapping> recomputedScopes;
     bool generationFailed = false;
 };
 
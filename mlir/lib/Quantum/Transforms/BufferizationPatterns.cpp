@@ -37,6 +37,31 @@ struct BufferizeQubitUnitaryOp : public OpConversionPattern<QubitUnitaryOp> {
     }
 };
 
+struct BufferizeSetStateOp : public OpConversionPattern<SetStateOp> {
+    using OpConversionPattern::OpConversionPattern;
+
+    LogicalResult matchAndRewrite(SetStateOp op, OpAdaptor adaptor,
+                                  ConversionPatternRewriter &rewriter) const override
+    {
+        rewriter.replaceOpWithNewOp<SetStateOp>(op, op.getOutQubits().getTypes(),
+                                                adaptor.getInState(), adaptor.getInQubits());
+        return success();
+    }
+};
+
+struct BufferizeSetBasisStateOp : public OpConversionPattern<SetBasisStateOp> {
+    using OpConversionPattern::OpConversionPattern;
+
+    LogicalResult matchAndRewrite(SetBasisStateOp op, OpAdaptor adaptor,
+                                  ConversionPatternRewriter &rewriter) const override
+    {
+        rewriter.replaceOpWithNewOp<SetBasisStateOp>(op, op.getOutQubits().getTypes(),
+                                                     adaptor.getBasisState(),
+                                                     adaptor.getInQubits());
+        return success();
+    }
+};
+
 struct BufferizeHermitianOp : public OpConversionPattern<HermitianOp> {
     using OpConversionPattern::OpConversionPattern;
 
@@ -77,6 +102,22 @@ struct BufferizeSampleOp : public OpConversionPattern<SampleOp> {
     }
 };
 
+struct BufferizeShadowOp : public OpConversionPattern<ShadowOp> {
+    using OpConversionPattern::OpConversionPattern;
+
+    LogicalResult matchAndRewrite(ShadowOp op, OpAdaptor adaptor,
+                                  ConversionPatternRewriter &rewriter) const override
+    {
+        Type tensorType = op.getType(0);
+        MemRefType resultType = getTypeConverter()->convertType(tensorType).cast<MemRefType>();
+        Location loc = op.getLoc();
+        Value allocVal = rewriter.replaceOpWithNewOp<memref::AllocOp>(op, resultType);
+        rewriter.create<ShadowOp>(loc, TypeRange{}, ValueRange{adaptor.getObs(), allocVal},
+                                  op->getAttrs());
+        return success();
+    }
+};
+
 struct BufferizeStateOp : public OpConversionPattern<StateOp> {
     using OpConversionPattern::OpConversionPattern;
 
@@ -122,7 +163,7 @@ struct BufferizeCountsOp : public OpConversionPattern<CountsOp> {
         Value allocVal1 = rewriter.create<memref::AllocOp>(loc, resultType1);
         rewriter.replaceOp(op, ValueRange{allocVal0, allocVal1});
         rewriter.create<CountsOp>(loc, nullptr, nullptr, adaptor.getObs(), allocVal0, allocVal1,
-                                  adaptor.getShotsAttr());
+                                  adaptor.getShotsAttr(), adaptor.getSparseAttr());
         return success();
     }
 };
@@ -139,11 +180,16 @@ void populateBufferizationLegality(TypeConverter &typeConverter, ConversionTarge
     // Quantum ops which return arrays need to be marked illegal when the type is a tensor.
     target.addDynamicallyLegalOp<QubitUnitaryOp>(
         [&](QubitUnitaryOp op) { return typeConverter.isLegal(op.getMatrix().getType()); });
+    target.addDynamicallyLegalOp<SetStateOp>(
+        [&](SetStateOp op) { return typeConverter.isLegal(op.getInState().getType()); });
+    target.addDynamicallyLegalOp<SetBasisStateOp>(
+        [&](SetBasisStateOp op) { return typeConverter.isLegal(op.getBasisState().getType()); });
     target.addDynamicallyLegalOp<HermitianOp>(
         [&](HermitianOp op) { return typeConverter.isLegal(op.getMatrix().getType()); });
     target.addDynamicallyLegalOp<HamiltonianOp>(
         [&](HamiltonianOp op) { return typeConverter.isLegal(op.getCoeffs().getType()); });
     target.addDynamicallyLegalOp<SampleOp>([&](SampleOp op) { return op.isBufferized(); });
+    target.addDynamicallyLegalOp<ShadowOp>([&](ShadowOp op) { return op.isBufferized(); });
     target.addDynamicallyLegalOp<StateOp>([&](StateOp op) { return op.isBufferized(); });
     target.addDynamicallyLegalOp<ProbsOp>([&](ProbsOp op) { return op.isBufferized(); });
     target.addDynamicallyLegalOp<CountsOp>([&](CountsOp op) { return op.isBufferized(); });
@@ -152,9 +198,12 @@ void populateBufferizationLegality(TypeConverter &typeConverter, ConversionTarge
 void populateBufferizationPatterns(TypeConverter &typeConverter, RewritePatternSet &patterns)
 {
     patterns.add<BufferizeQubitUnitaryOp>(typeConverter, patterns.getContext());
+    patterns.add<BufferizeSetStateOp>(typeConverter, patterns.getContext());
+    patterns.add<BufferizeSetBasisStateOp>(typeConverter, patterns.getContext());
     patterns.add<BufferizeHermitianOp>(typeConverter, patterns.getContext());
     patterns.add<BufferizeHamiltonianOp>(typeConverter, patterns.getContext());
     patterns.add<BufferizeSampleOp>(typeConverter, patterns.getContext());
+    patterns.add<BufferizeShadowOp>(typeConverter, patterns.getContext());
     patterns.add<BufferizeStateOp>(typeConverter, patterns.getContext());
     patterns.add<BufferizeProbsOp>(typeConverter, patterns.getContext());
     patterns.add<BufferizeCountsOp>(typeConverter, patterns.getContext());
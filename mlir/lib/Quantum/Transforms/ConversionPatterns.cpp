@@ -15,6 +15,7 @@
 #include <string>
 
 #include "mlir/Dialect/LLVMIR/LLVMDialect.h"
+#include "mlir/IR/Matchers.h"
 #include "mlir/Transforms/DialectConversion.h"
 
 #include "Quantum/IR/QuantumOps.h"
@@ -64,41 +65,161 @@ Value getGlobalString(Location loc, OpBuilder &rewriter, StringRef key, StringRe
 }
 
 /**
- * @brief Initialize and fill the  `struct Modifiers` on stack return a pointer to it.
+ * @brief Get a stack slot of `size` elements of `elemType` for the runtime call lowering `op`.
+ *
+ * The slot is allocated once in the entry block of the enclosing allocation scope, and is shared
+ * by all the operations of that scope requesting the same `slot`. The slots are only live between
+ * the stores preceding a runtime call and the call itself, so sharing them is safe, and calls in
+ * loops do not grow the stack. The allocas are tagged with `StackSlotAttr` (stripped once the
+ * conversion is done) and kept at the start of the entry block, so the lookup only visits the
+ * slots.
+ */
+Value getStackSlot(Location loc, OpBuilder &rewriter, Operation *op, Type elemType, size_t size,
+                   StringRef slot)
+{
+    Operation *scope = op->getParentWithTrait<OpTrait::AutomaticAllocationScope>();
+    assert(scope && !scope->getRegion(0).empty() && "expected an allocation scope for the op");
+    Block &entry = scope->getRegion(0).front();
+
+    // Each slot is a pair of (size constant, tagged alloca) at the start of the entry block.
+    std::string slotName = (slot + Twine(size)).str();
+    for (auto it = entry.begin(); it != entry.end() && std::next(it) != entry.end();
+         std::advance(it, 2)) {
+        auto tag = std::next(it)->getAttrOfType<StringAttr>(StackSlotAttr);
+        if (!isa<LLVM::ConstantOp>(*it) || !tag) {
+            break;
+        }
+        if (tag.getValue() == slotName) {
+            return std::next(it)->getResult(0);
+        }
+    }
+
+    OpBuilder::InsertionGuard insertGuard(rewriter);
+    rewriter.setInsertionPointToStart(&entry);
+    Type ptrType = LLVM::LLVMPointerType::get(rewriter.getContext());
+    Value numElems = rewriter.create<LLVM::ConstantOp>(loc, rewriter.getI64IntegerAttr(size));
+    auto alloca = rewriter.create<LLVM::AllocaOp>(loc, ptrType, elemType, numElems);
+    alloca->setAttr(StackSlotAttr, rewriter.getStringAttr(slotName));
+    return alloca.getResult();
+}
+
+/**
+ * @brief Get a pointer to the constant `struct Modifiers` of an adjoint gate without controls.
+ *
+ * @param loc MLIR Location object
+ * @param rewriter MLIR OpBuilder object
+ * @param mod The module in which to insert the global
+ */
+Value getAdjointModifiersPtr(Location loc, OpBuilder &rewriter, ModuleOp mod)
+{
+    MLIRContext *ctx = rewriter.getContext();
+    StringRef key = "__catalyst__modifiers_adjoint";
+
+    auto boolType = IntegerType::get(ctx, 1);
+    auto sizeType = IntegerType::get(ctx, 64);
+    auto ptrType = LLVM::LLVMPointerType::get(ctx);
+    auto structType = LLVM::LLVMStructType::getLiteral(ctx, {boolType, sizeType, ptrType, ptrType});
+
+    LLVM::GlobalOp glb = mod.lookupSymbol<LLVM::GlobalOp>(key);
+    if (!glb) {
+        OpBuilder::InsertionGuard guard(rewriter);
+        rewriter.setInsertionPointToStart(mod.getBody());
+        glb = rewriter.create<LLVM::GlobalOp>(loc, structType, true, LLVM::Linkage::Internal, key,
+                                              Attribute());
+
+        rewriter.createBlock(&glb.getInitializerRegion());
+        Value nullPtr = rewriter.create<LLVM::ZeroOp>(loc, ptrType);
+        Value modifiers = rewriter.create<LLVM::UndefOp>(loc, structType);
+        modifiers = rewriter.create<LLVM::InsertValueOp>(
+            loc, modifiers, rewriter.create<LLVM::ConstantOp>(loc, rewriter.getBoolAttr(true)), 0);
+        modifiers = rewriter.create<LLVM::InsertValueOp>(
+            loc, modifiers,
+            rewriter.create<LLVM::ConstantOp>(loc, rewriter.getI64IntegerAttr(0)), 1);
+        modifiers = rewriter.create<LLVM::InsertValueOp>(loc, modifiers, nullPtr, 2);
+        modifiers = rewriter.create<LLVM::InsertValueOp>(loc, modifiers, nullPtr, 3);
+        rewriter.create<LLVM::ReturnOp>(loc, modifiers);
+    }
+
+    return rewriter.create<LLVM::AddressOfOp>(loc, glb);
+}
+
+/**
+ * @brief Initialize and fill the `struct Modifiers` of `op` and return a pointer to it.
+ *
+ * Gates without modifiers get a null pointer, and adjoint gates without controls share a constant
+ * global. Otherwise, the structure and the controlled wires live in stack slots hoisted to the
+ * entry block (see `getStackSlot`), and constant controlled values are read from a global.
  *
  * @param loc MLIR Location object
  * @param rewriter MLIR OpBuilder object
- * @param conv MLIR TypeConverter object
+ * @param op The gate operation being converted
  * @param adjoint The value of adjoint flag of the resulting structure
  * @param controlledQubits list of controlled qubits
  * @param controlledValues list of controlled values
  */
-Value getModifiersPtr(Location loc, OpBuilder &rewriter, const TypeConverter *conv, bool adjoint,
+Value getModifiersPtr(Location loc, OpBuilder &rewriter, Operation *op, bool adjoint,
                       ValueRange controlledQubits, ValueRange controlledValues)
 {
     assert(controlledQubits.size() == controlledValues.size() &&
            "controlled qubits and controlled values have different lengths");
 
     MLIRContext *ctx = rewriter.getContext();
+    ModuleOp mod = op->getParentOfType<ModuleOp>();
 
     auto boolType = IntegerType::get(ctx, 1);
     auto sizeType = IntegerType::get(ctx, 64);
 
     auto ptrType = LLVM::LLVMPointerType::get(ctx);
 
-    Value c1 = rewriter.create<LLVM::ConstantOp>(loc, rewriter.getI64IntegerAttr(1));
-    Value nullPtr = rewriter.create<LLVM::ZeroOp>(loc, ptrType);
+    if (controlledQubits.empty()) {
+        if (!adjoint) {
+            return rewriter.create<LLVM::ZeroOp>(loc, ptrType);
+        }
+        return getAdjointModifiersPtr(loc, rewriter, mod);
+    }
+
+    const size_t numControlled = controlledQubits.size();
+    auto structType = LLVM::LLVMStructType::getLiteral(ctx, {boolType, sizeType, ptrType, ptrType});
+    Value modifiersPtr = getStackSlot(loc, rewriter, op, structType, 1, "modifiers");
 
-    if (!adjoint && controlledQubits.empty() && controlledValues.empty()) {
-        return nullPtr;
+    Value ctrlPtr = getStackSlot(loc, rewriter, op, ptrType, numControlled, "ctrl_wires");
+    for (size_t i = 0; i < numControlled; i++) {
+        auto itemPtr = rewriter.create<LLVM::GEPOp>(loc, ptrType, ptrType, ctrlPtr,
+                                                    llvm::ArrayRef<LLVM::GEPArg>{i}, true);
+        rewriter.create<LLVM::StoreOp>(loc, controlledQubits[i], itemPtr);
+    }
+
+    // Constant controlled values (the common case) are emitted once as a global byte string.
+    std::string constantValues;
+    for (Value value : controlledValues) {
+        BoolAttr valueAttr;
+        if (!matchPattern(value, m_Constant(&valueAttr))) {
+            constantValues.clear();
+            break;
+        }
+        constantValues.push_back(valueAttr.getValue() ? '\x01' : '\x00');
+    }
+
+    Value valuePtr;
+    if (!constantValues.empty()) {
+        std::string key = "__catalyst__ctrl_values_";
+        for (char value : constantValues) {
+            key.push_back(value ? '1' : '0');
+        }
+        valuePtr = getGlobalString(loc, rewriter, key, constantValues, mod);
+    }
+    else {
+        valuePtr = getStackSlot(loc, rewriter, op, boolType, numControlled, "ctrl_values");
+        for (size_t i = 0; i < numControlled; i++) {
+            auto itemPtr = rewriter.create<LLVM::GEPOp>(loc, ptrType, boolType, valuePtr,
+                                                        llvm::ArrayRef<LLVM::GEPArg>{i}, true);
+            rewriter.create<LLVM::StoreOp>(loc, controlledValues[i], itemPtr);
+        }
     }
 
     auto adjointVal = rewriter.create<LLVM::ConstantOp>(loc, rewriter.getBoolAttr(adjoint));
     auto numControlledVal =
-        rewriter.create<LLVM::ConstantOp>(loc, rewriter.getI64IntegerAttr(controlledQubits.size()))
-            .getResult();
-    auto structType = LLVM::LLVMStructType::getLiteral(ctx, {boolType, sizeType, ptrType, ptrType});
-    auto modifiersPtr = rewriter.create<LLVM::AllocaOp>(loc, ptrType, structType, c1).getResult();
+        rewriter.create<LLVM::ConstantOp>(loc, rewriter.getI64IntegerAttr(numControlled));
     auto adjointPtr = rewriter.create<LLVM::GEPOp>(loc, ptrType, structType, modifiersPtr,
                                                    llvm::ArrayRef<LLVM::GEPArg>{0, 0}, true);
     auto numControlledPtr = rewriter.create<LLVM::GEPOp>(loc, ptrType, structType, modifiersPtr,
@@ -108,29 +229,6 @@ Value getModifiersPtr(Location loc, OpBuilder &rewriter, const TypeConverter *co
     auto controlledValuesPtr = rewriter.create<LLVM::GEPOp>(
         loc, ptrType, structType, modifiersPtr, llvm::ArrayRef<LLVM::GEPArg>{0, 3}, true);
 
-    Value ctrlPtr = nullPtr;
-    Value valuePtr = nullPtr;
-    if (!controlledQubits.empty()) {
-        ctrlPtr =
-            rewriter.create<LLVM::AllocaOp>(loc, ptrType, ptrType, numControlledVal).getResult();
-        valuePtr =
-            rewriter.create<LLVM::AllocaOp>(loc, ptrType, boolType, numControlledVal).getResult();
-        for (size_t i = 0; i < controlledQubits.size(); i++) {
-            {
-                auto itemPtr = rewriter.create<LLVM::GEPOp>(loc, ptrType, ptrType, ctrlPtr,
-                                                            llvm::ArrayRef<LLVM::GEPArg>{i}, true);
-                auto qubit = controlledQubits[i];
-                rewriter.create<LLVM::StoreOp>(loc, qubit, itemPtr);
-            }
-            {
-                auto itemPtr = rewriter.create<LLVM::GEPOp>(loc, ptrType, boolType, valuePtr,
-                                                            llvm::ArrayRef<LLVM::GEPArg>{i}, true);
-                auto value = controlledValues[i];
-                rewriter.create<LLVM::StoreOp>(loc, value, itemPtr);
-            }
-        }
-    }
-
     rewriter.create<LLVM::StoreOp>(loc, adjointVal, adjointPtr);
     rewriter.create<LLVM::StoreOp>(loc, numControlledVal, numControlledPtr);
     rewriter.create<LLVM::StoreOp>(loc, ctrlPtr, controlledWiresPtr);
@@ -139,6 +237,34 @@ Value getModifiersPtr(Location loc, OpBuilder &rewriter, const TypeConverter *co
     return modifiersPtr;
 }
 
+/**
+ * @brief Store `values` into a stack array and return a pointer to it, to be passed along with
+ * its length to the array-based runtime functions (e.g. `__catalyst__qis__MultiRZ_array`).
+ *
+ * @param loc MLIR Location object
+ * @param rewriter MLIR OpBuilder object
+ * @param op The operation being converted
+ * @param values The values of the array, which must all have the same type
+ * @param slot The name of the stack slot (see `getStackSlot`)
+ */
+Value getArrayPtr(Location loc, OpBuilder &rewriter, Operation *op, ValueRange values,
+                  StringRef slot)
+{
+    Type ptrType = LLVM::LLVMPointerType::get(rewriter.getContext());
+    if (values.empty()) {
+        return rewriter.create<LLVM::ZeroOp>(loc, ptrType);
+    }
+
+    Type elemType = values.front().getType();
+    Value arrayPtr = getStackSlot(loc, rewriter, op, elemType, values.size(), slot);
+    for (size_t i = 0; i < values.size(); i++) {
+        auto itemPtr = rewriter.create<LLVM::GEPOp>(loc, ptrType, elemType, arrayPtr,
+                                                    llvm::ArrayRef<LLVM::GEPArg>{i}, true);
+        rewriter.create<LLVM::StoreOp>(loc, values[i], itemPtr);
+    }
+    return arrayPtr;
+}
+
 ////////////////////////
 // Runtime Management //
 ////////////////////////
@@ -229,6 +355,60 @@ struct DeviceReleaseOpPattern : public OpConversionPattern<DeviceReleaseOp> {
     }
 };
 
+template <typename T> struct BatchBasedPattern : public OpConversionPattern<T> {
+    using OpConversionPattern<T>::OpConversionPattern;
+
+    LogicalResult matchAndRewrite(T op, typename T::Adaptor adaptor,
+                                  ConversionPatternRewriter &rewriter) const override
+    {
+        MLIRContext *ctx = this->getContext();
+
+        StringRef qirName;
+        if constexpr (std::is_same_v<T, BatchBeginOp>) {
+            qirName = "__catalyst__rt__batch_begin";
+        }
+        else if constexpr (std::is_same_v<T, BatchLaneOp>) {
+            qirName = "__catalyst__rt__batch_lane";
+        }
+        else if constexpr (std::is_same_v<T, BatchExecuteOp>) {
+            qirName = "__catalyst__rt__batch_execute";
+        }
+        else {
+            qirName = "__catalyst__rt__batch_end";
+        }
+
+        ValueRange operands = adaptor.getOperands();
+        SmallVector<Type> argTypes(operands.getTypes());
+        Type qirSignature = LLVM::LLVMFunctionType::get(LLVM::LLVMVoidType::get(ctx), argTypes);
+
+        LLVM::LLVMFuncOp fnDecl = ensureFunctionDeclaration(rewriter, op, qirName, qirSignature);
+
+        rewriter.replaceOpWithNewOp<LLVM::CallOp>(op, fnDecl, operands);
+
+        return success();
+    }
+};
+
+struct CheckpointOpPattern : public OpConversionPattern<CheckpointOp> {
+    using OpConversionPattern::OpConversionPattern;
+
+    LogicalResult matchAndRewrite(CheckpointOp op, CheckpointOpAdaptor adaptor,
+                                  ConversionPatternRewriter &rewriter) const override
+    {
+        MLIRContext *ctx = getContext();
+
+        StringRef qirName = "__catalyst__rt__checkpoint";
+        Type qirSignature =
+            LLVM::LLVMFunctionType::get(LLVM::LLVMVoidType::get(ctx), IntegerType::get(ctx, 1));
+
+        LLVM::LLVMFuncOp fnDecl = ensureFunctionDeclaration(rewriter, op, qirName, qirSignature);
+
+        rewriter.replaceOpWithNewOp<LLVM::CallOp>(op, fnDecl, adaptor.getDiverges());
+
+        return success();
+    }
+};
+
 ///////////////////////
 // Memory Management //
 ///////////////////////
@@ -290,23 +470,21 @@ struct ExtractOpPattern : public OpConversionPattern<ExtractOp> {
         Location loc = op.getLoc();
         MLIRContext *ctx = getContext();
         const TypeConverter *conv = getTypeConverter();
-
-        StringRef qirName = "__catalyst__rt__array_get_element_ptr_1d";
-        Type qirSignature = LLVM::LLVMFunctionType::get(
-            LLVM::LLVMPointerType::get(rewriter.getContext()),
-            {conv->convertType(QuregType::get(ctx)), IntegerType::get(ctx, 64)});
-
-        LLVM::LLVMFuncOp fnDecl = ensureFunctionDeclaration(rewriter, op, qirName, qirSignature);
+        Type ptrType = LLVM::LLVMPointerType::get(ctx);
+        Type qubitType = conv->convertType(QubitType::get(ctx));
 
         Value index = adaptor.getIdx();
         if (!index) {
             index = rewriter.create<LLVM::ConstantOp>(loc, op.getIdxAttrAttr());
         }
-        SmallVector<Value> operands = {adaptor.getQreg(), index};
 
-        Value elemPtr = rewriter.create<LLVM::CallOp>(loc, fnDecl, operands).getResult();
-        rewriter.replaceOpWithNewOp<LLVM::LoadOp>(op, conv->convertType(QubitType::get(ctx)),
-                                                  elemPtr);
+        // The qubit register points to a `QirQubitArray` (see runtime/include/Types.h) whose
+        // first field is the array of qubit ids. Index it directly instead of calling
+        // `__catalyst__rt__array_get_element_ptr_1d`, so that LLVM can hoist and CSE the loads.
+        Value data = rewriter.create<LLVM::LoadOp>(loc, ptrType, adaptor.getQreg());
+        Value elemPtr =
+            rewriter.create<LLVM::GEPOp>(loc, ptrType, qubitType, data, ValueRange{index}, true);
+        rewriter.replaceOpWithNewOp<LLVM::LoadOp>(op, qubitType, elemPtr);
 
         return success();
     }
@@ -336,9 +514,7 @@ struct CustomOpPattern : public OpConversionPattern<CustomOp> {
     {
         Location loc = op.getLoc();
         MLIRContext *ctx = getContext();
-
-        const TypeConverter *conv = getTypeConverter();
-        auto modifiersPtr = getModifiersPtr(loc, rewriter, conv, op.getAdjointFlag(),
+        auto modifiersPtr = getModifiersPtr(loc, rewriter, op, op.getAdjointFlag(),
                                             adaptor.getInCtrlQubits(), adaptor.getInCtrlValues());
 
         std::string qirName = "__catalyst__qis__" + op.getGateName().str();
@@ -375,8 +551,7 @@ struct GlobalPhaseOpPattern : public OpConversionPattern<GlobalPhaseOp> {
     {
         Location loc = op.getLoc();
         MLIRContext *ctx = getContext();
-        const TypeConverter *conv = getTypeConverter();
-        auto modifiersPtr = getModifiersPtr(loc, rewriter, conv, op.getAdjointFlag(),
+        auto modifiersPtr = getModifiersPtr(loc, rewriter, op, op.getAdjointFlag(),
                                             adaptor.getInCtrlQubits(), adaptor.getInCtrlValues());
 
         std::string qirName = "__catalyst__qis__GlobalPhase";
@@ -404,15 +579,14 @@ struct MultiRZOpPattern : public OpConversionPattern<MultiRZOp> {
     {
         Location loc = op.getLoc();
         MLIRContext *ctx = getContext();
-        const TypeConverter *conv = getTypeConverter();
-        auto modifiersPtr = getModifiersPtr(loc, rewriter, conv, op.getAdjointFlag(),
+        auto modifiersPtr = getModifiersPtr(loc, rewriter, op, op.getAdjointFlag(),
                                             adaptor.getInCtrlQubits(), adaptor.getInCtrlValues());
 
-        std::string qirName = "__catalyst__qis__MultiRZ";
+        Type ptrType = LLVM::LLVMPointerType::get(ctx);
+        std::string qirName = "__catalyst__qis__MultiRZ_array";
         Type qirSignature = LLVM::LLVMFunctionType::get(
             LLVM::LLVMVoidType::get(ctx),
-            {Float64Type::get(ctx), modifiersPtr.getType(), IntegerType::get(ctx, 64)},
-            /*isVarArg=*/true);
+            {Float64Type::get(ctx), modifiersPtr.getType(), IntegerType::get(ctx, 64), ptrType});
 
         LLVM::LLVMFuncOp fnDecl = ensureFunctionDeclaration(rewriter, op, qirName, qirSignature);
 
@@ -422,7 +596,91 @@ struct MultiRZOpPattern : public OpConversionPattern<MultiRZOp> {
         args.insert(args.end(), modifiersPtr);
         args.insert(args.end(),
                     rewriter.create<LLVM::ConstantOp>(loc, rewriter.getI64IntegerAttr(numQubits)));
-        args.insert(args.end(), adaptor.getInQubits().begin(), adaptor.getInQubits().end());
+        args.insert(args.end(), getArrayPtr(loc, rewriter, op, adaptor.getInQubits(), "qubits"));
+        rewriter.create<LLVM::CallOp>(loc, fnDecl, args);
+
+        SmallVector<Value> values;
+        values.insert(values.end(), adaptor.getInQubits().begin(), adaptor.getInQubits().end());
+        values.insert(values.end(), adaptor.getInCtrlQubits().begin(),
+                      adaptor.getInCtrlQubits().end());
+        rewriter.replaceOp(op, values);
+
+        return success();
+    }
+};
+
+struct PauliRotOpPattern : public OpConversionPattern<PauliRotOp> {
+    using OpConversionPattern::OpConversionPattern;
+
+    LogicalResult matchAndRewrite(PauliRotOp op, PauliRotOpAdaptor adaptor,
+                                  ConversionPatternRewriter &rewriter) const override
+    {
+        Location loc = op.getLoc();
+        MLIRContext *ctx = getContext();
+        ModuleOp mod = op->getParentOfType<ModuleOp>();
+        auto modifiersPtr = getModifiersPtr(loc, rewriter, op, op.getAdjointFlag(),
+                                            adaptor.getInCtrlQubits(), adaptor.getInCtrlValues());
+
+        Type ptrType = LLVM::LLVMPointerType::get(ctx);
+        std::string qirName = "__catalyst__qis__PauliRot";
+        Type qirSignature = LLVM::LLVMFunctionType::get(
+            LLVM::LLVMVoidType::get(ctx),
+            {Float64Type::get(ctx), ptrType, modifiersPtr.getType(), IntegerType::get(ctx, 64),
+             ptrType});
+
+        LLVM::LLVMFuncOp fnDecl = ensureFunctionDeclaration(rewriter, op, qirName, qirSignature);
+
+        // The Pauli words are stored as null-terminated global strings, shared by all the
+        // rotations about the same word.
+        std::string word = op.getPauliWord().str();
+        Value wordPtr = getGlobalString(loc, rewriter, "__catalyst__pauli_word_" + word,
+                                        StringRef(word.c_str(), word.length() + 1), mod);
+
+        int64_t numQubits = op.getOutQubits().size();
+        SmallVector<Value> args;
+        args.insert(args.end(), adaptor.getTheta());
+        args.insert(args.end(), wordPtr);
+        args.insert(args.end(), modifiersPtr);
+        args.insert(args.end(),
+                    rewriter.create<LLVM::ConstantOp>(loc, rewriter.getI64IntegerAttr(numQubits)));
+        args.insert(args.end(), getArrayPtr(loc, rewriter, op, adaptor.getInQubits(), "qubits"));
+        rewriter.create<LLVM::CallOp>(loc, fnDecl, args);
+
+        SmallVector<Value> values;
+        values.insert(values.end(), adaptor.getInQubits().begin(), adaptor.getInQubits().end());
+        values.insert(values.end(), adaptor.getInCtrlQubits().begin(),
+                      adaptor.getInCtrlQubits().end());
+        rewriter.replaceOp(op, values);
+
+        return success();
+    }
+};
+
+struct QFTOpPattern : public OpConversionPattern<QFTOp> {
+    using OpConversionPattern::OpConversionPattern;
+
+    LogicalResult matchAndRewrite(QFTOp op, QFTOpAdaptor adaptor,
+                                  ConversionPatternRewriter &rewriter) const override
+    {
+        Location loc = op.getLoc();
+        MLIRContext *ctx = getContext();
+        auto modifiersPtr = getModifiersPtr(loc, rewriter, op, op.getAdjointFlag(),
+                                            adaptor.getInCtrlQubits(), adaptor.getInCtrlValues());
+
+        Type ptrType = LLVM::LLVMPointerType::get(ctx);
+        std::string qirName = "__catalyst__qis__QFT";
+        Type qirSignature = LLVM::LLVMFunctionType::get(
+            LLVM::LLVMVoidType::get(ctx),
+            {modifiersPtr.getType(), IntegerType::get(ctx, 64), ptrType});
+
+        LLVM::LLVMFuncOp fnDecl = ensureFunctionDeclaration(rewriter, op, qirName, qirSignature);
+
+        int64_t numQubits = op.getOutQubits().size();
+        SmallVector<Value> args;
+        args.insert(args.end(), modifiersPtr);
+        args.insert(args.end(),
+                    rewriter.create<LLVM::ConstantOp>(loc, rewriter.getI64IntegerAttr(numQubits)));
+        args.insert(args.end(), getArrayPtr(loc, rewriter, op, adaptor.getInQubits(), "qubits"));
         rewriter.create<LLVM::CallOp>(loc, fnDecl, args);
 
         SmallVector<Value> values;
@@ -444,7 +702,7 @@ struct QubitUnitaryOpPattern : public OpConversionPattern<QubitUnitaryOp> {
         Location loc = op.getLoc();
         MLIRContext *ctx = getContext();
         const TypeConverter *conv = getTypeConverter();
-        auto modifiersPtr = getModifiersPtr(loc, rewriter, conv, op.getAdjointFlag(),
+        auto modifiersPtr = getModifiersPtr(loc, rewriter, op, op.getAdjointFlag(),
                                             adaptor.getInCtrlQubits(), adaptor.getInCtrlValues());
 
         assert(op.getMatrix().getType().isa<MemRefType>() &&
@@ -453,25 +711,24 @@ struct QubitUnitaryOpPattern : public OpConversionPattern<QubitUnitaryOp> {
         Type matrixType = conv->convertType(
             MemRefType::get({UNKNOWN, UNKNOWN}, ComplexType::get(Float64Type::get(ctx))));
 
-        std::string qirName = "__catalyst__qis__QubitUnitary";
-        Type qirSignature =
-            LLVM::LLVMFunctionType::get(LLVM::LLVMVoidType::get(ctx),
-                                        {LLVM::LLVMPointerType::get(rewriter.getContext()),
-                                         modifiersPtr.getType(), IntegerType::get(ctx, 64)},
-                                        /*isVarArg=*/true);
+        Type ptrType = LLVM::LLVMPointerType::get(ctx);
+        std::string qirName = "__catalyst__qis__QubitUnitary_array";
+        Type qirSignature = LLVM::LLVMFunctionType::get(
+            LLVM::LLVMVoidType::get(ctx),
+            {ptrType, modifiersPtr.getType(), IntegerType::get(ctx, 64), ptrType});
 
         LLVM::LLVMFuncOp fnDecl = ensureFunctionDeclaration(rewriter, op, qirName, qirSignature);
 
         int64_t numQubits = adaptor.getInQubits().size();
-        SmallVector<Value> args = adaptor.getOperands();
-        args.insert(args.begin() + 1,
-                    rewriter.create<LLVM::ConstantOp>(loc, rewriter.getI64IntegerAttr(numQubits)));
-        args.insert(args.begin() + 1, modifiersPtr);
-        // Replace the memref argument (LLVM struct) with a pointer to memref.
+        Value numQubitsVal =
+            rewriter.create<LLVM::ConstantOp>(loc, rewriter.getI64IntegerAttr(numQubits));
+        // Pass the memref argument (LLVM struct) as a pointer to memref.
         Value c1 = rewriter.create<LLVM::ConstantOp>(loc, rewriter.getI64IntegerAttr(1));
-        args[0] = rewriter.create<LLVM::AllocaOp>(
-            loc, LLVM::LLVMPointerType::get(rewriter.getContext()), matrixType, c1);
-        rewriter.create<LLVM::StoreOp>(loc, adaptor.getMatrix(), args[0]);
+        Value matrixPtr = rewriter.create<LLVM::AllocaOp>(loc, ptrType, matrixType, c1);
+        rewriter.create<LLVM::StoreOp>(loc, adaptor.getMatrix(), matrixPtr);
+
+        SmallVector<Value> args = {matrixPtr, modifiersPtr, numQubitsVal,
+                                   getArrayPtr(loc, rewriter, op, adaptor.getInQubits(), "qubits")};
 
         rewriter.create<LLVM::CallOp>(loc, fnDecl, args);
 
@@ -485,6 +742,59 @@ struct QubitUnitaryOpPattern : public OpConversionPattern<QubitUnitaryOp> {
     }
 };
 
+template <typename T> struct SetStateBasedPattern : public OpConversionPattern<T> {
+    using OpConversionPattern<T>::OpConversionPattern;
+
+    LogicalResult matchAndRewrite(T op, typename T::Adaptor adaptor,
+                                  ConversionPatternRewriter &rewriter) const override
+    {
+        Location loc = op.getLoc();
+        MLIRContext *ctx = this->getContext();
+        const TypeConverter *conv = this->getTypeConverter();
+
+        Value state;
+        Type stateType;
+        StringRef qirName;
+        if constexpr (std::is_same_v<T, SetStateOp>) {
+            assert(isa<MemRefType>(op.getInState().getType()) &&
+                   "state must take in memref before lowering");
+            state = adaptor.getInState();
+            stateType = conv->convertType(
+                MemRefType::get({UNKNOWN}, ComplexType::get(Float64Type::get(ctx))));
+            qirName = "__catalyst__qis__SetState";
+        }
+        else {
+            assert(isa<MemRefType>(op.getBasisState().getType()) &&
+                   "basis state must take in memref before lowering");
+            state = adaptor.getBasisState();
+            stateType = conv->convertType(MemRefType::get({UNKNOWN}, IntegerType::get(ctx, 1)));
+            qirName = "__catalyst__qis__SetBasisState";
+        }
+
+        Type ptrType = LLVM::LLVMPointerType::get(ctx);
+        Type qirSignature = LLVM::LLVMFunctionType::get(
+            LLVM::LLVMVoidType::get(ctx), {ptrType, IntegerType::get(ctx, 64), ptrType});
+
+        LLVM::LLVMFuncOp fnDecl = ensureFunctionDeclaration(rewriter, op, qirName, qirSignature);
+
+        int64_t numQubits = adaptor.getInQubits().size();
+        Value numQubitsVal =
+            rewriter.create<LLVM::ConstantOp>(loc, rewriter.getI64IntegerAttr(numQubits));
+        // Pass the memref argument (LLVM struct) as a pointer to memref.
+        Value c1 = rewriter.create<LLVM::ConstantOp>(loc, rewriter.getI64IntegerAttr(1));
+        Value statePtr = rewriter.create<LLVM::AllocaOp>(loc, ptrType, stateType, c1);
+        rewriter.create<LLVM::StoreOp>(loc, state, statePtr);
+
+        SmallVector<Value> args = {statePtr, numQubitsVal,
+                                   getArrayPtr(loc, rewriter, op, adaptor.getInQubits(), "qubits")};
+
+        rewriter.create<LLVM::CallOp>(loc, fnDecl, args);
+        rewriter.replaceOp(op, adaptor.getInQubits());
+
+        return success();
+    }
+};
+
 /////////////////
 // Observables //
 /////////////////
@@ -549,23 +859,24 @@ struct HermitianOpPattern : public OpConversionPattern<HermitianOp> {
         Type matrixType = conv->convertType(
             MemRefType::get({UNKNOWN, UNKNOWN}, ComplexType::get(Float64Type::get(ctx))));
 
-        StringRef qirName = "__catalyst__qis__HermitianObs";
-        Type qirSignature = LLVM::LLVMFunctionType::get(
-            conv->convertType(ObservableType::get(ctx)),
-            {LLVM::LLVMPointerType::get(rewriter.getContext()), IntegerType::get(ctx, 64)},
-            /*isVarArg=*/true);
+        Type ptrType = LLVM::LLVMPointerType::get(ctx);
+        StringRef qirName = "__catalyst__qis__HermitianObs_array";
+        Type qirSignature =
+            LLVM::LLVMFunctionType::get(conv->convertType(ObservableType::get(ctx)),
+                                        {ptrType, IntegerType::get(ctx, 64), ptrType});
 
         LLVM::LLVMFuncOp fnDecl = ensureFunctionDeclaration(rewriter, op, qirName, qirSignature);
 
         int64_t numQubits = op.getQubits().size();
-        SmallVector<Value> args = adaptor.getOperands();
-        args.insert(args.begin() + 1,
-                    rewriter.create<LLVM::ConstantOp>(loc, rewriter.getI64IntegerAttr(numQubits)));
-        // Replace the memref argument (LLVM struct) with a pointer to memref.
+        Value numQubitsVal =
+            rewriter.create<LLVM::ConstantOp>(loc, rewriter.getI64IntegerAttr(numQubits));
+        // Pass the memref argument (LLVM struct) as a pointer to memref.
         Value c1 = rewriter.create<LLVM::ConstantOp>(loc, rewriter.getI64IntegerAttr(1));
-        args[0] = rewriter.create<LLVM::AllocaOp>(
-            loc, LLVM::LLVMPointerType::get(rewriter.getContext()), matrixType, c1);
-        rewriter.create<LLVM::StoreOp>(loc, adaptor.getMatrix(), args[0]);
+        Value matrixPtr = rewriter.create<LLVM::AllocaOp>(loc, ptrType, matrixType, c1);
+        rewriter.create<LLVM::StoreOp>(loc, adaptor.getMatrix(), matrixPtr);
+
+        SmallVector<Value> args = {matrixPtr, numQubitsVal,
+                                   getArrayPtr(loc, rewriter, op, adaptor.getQubits(), "qubits")};
 
         rewriter.replaceOpWithNewOp<LLVM::CallOp>(op, fnDecl, args);
 
@@ -583,17 +894,17 @@ struct TensorOpPattern : public OpConversionPattern<TensorOp> {
         MLIRContext *ctx = getContext();
         const TypeConverter *conv = getTypeConverter();
 
-        StringRef qirName = "__catalyst__qis__TensorObs";
-        Type qirSignature =
-            LLVM::LLVMFunctionType::get(conv->convertType(ObservableType::get(ctx)),
-                                        IntegerType::get(ctx, 64), /*isVarArg=*/true);
+        StringRef qirName = "__catalyst__qis__TensorObs_array";
+        Type qirSignature = LLVM::LLVMFunctionType::get(
+            conv->convertType(ObservableType::get(ctx)),
+            {IntegerType::get(ctx, 64), LLVM::LLVMPointerType::get(ctx)});
 
         LLVM::LLVMFuncOp fnDecl = ensureFunctionDeclaration(rewriter, op, qirName, qirSignature);
 
         int64_t numTerms = op.getTerms().size();
-        SmallVector<Value> args = adaptor.getOperands();
-        args.insert(args.begin(),
-                    rewriter.create<LLVM::ConstantOp>(loc, rewriter.getI64IntegerAttr(numTerms)));
+        SmallVector<Value> args = {
+            rewriter.create<LLVM::ConstantOp>(loc, rewriter.getI64IntegerAttr(numTerms)),
+            getArrayPtr(loc, rewriter, op, adaptor.getTerms(), "obs")};
 
         rewriter.replaceOpWithNewOp<LLVM::CallOp>(op, fnDecl, args);
 
@@ -616,23 +927,24 @@ struct HamiltonianOpPattern : public OpConversionPattern<HamiltonianOp> {
 
         Type vectorType = conv->convertType(MemRefType::get({UNKNOWN}, Float64Type::get(ctx)));
 
-        StringRef qirName = "__catalyst__qis__HamiltonianObs";
-        Type qirSignature = LLVM::LLVMFunctionType::get(
-            conv->convertType(ObservableType::get(ctx)),
-            {LLVM::LLVMPointerType::get(rewriter.getContext()), IntegerType::get(ctx, 64)},
-            /*isVarArg=*/true);
+        Type ptrType = LLVM::LLVMPointerType::get(ctx);
+        StringRef qirName = "__catalyst__qis__HamiltonianObs_array";
+        Type qirSignature =
+            LLVM::LLVMFunctionType::get(conv->convertType(ObservableType::get(ctx)),
+                                        {ptrType, IntegerType::get(ctx, 64), ptrType});
 
         LLVM::LLVMFuncOp fnDecl = ensureFunctionDeclaration(rewriter, op, qirName, qirSignature);
 
         int64_t numTerms = op.getTerms().size();
-        SmallVector<Value> args = adaptor.getOperands();
-        args.insert(args.begin() + 1,
-                    rewriter.create<LLVM::ConstantOp>(loc, rewriter.getI64IntegerAttr(numTerms)));
-        // Replace the memref argument (LLVM struct) with a pointer to memref.
+        Value numTermsVal =
+            rewriter.create<LLVM::ConstantOp>(loc, rewriter.getI64IntegerAttr(numTerms));
+        // Pass the memref argument (LLVM struct) as a pointer to memref.
         Value c1 = rewriter.create<LLVM::ConstantOp>(loc, rewriter.getI64IntegerAttr(1));
-        args[0] = rewriter.create<LLVM::AllocaOp>(
-            loc, LLVM::LLVMPointerType::get(rewriter.getContext()), vectorType, c1);
-        rewriter.create<LLVM::StoreOp>(loc, adaptor.getCoeffs(), args[0]);
+        Value coeffsPtr = rewriter.create<LLVM::AllocaOp>(loc, ptrType, vectorType, c1);
+        rewriter.create<LLVM::StoreOp>(loc, adaptor.getCoeffs(), coeffsPtr);
+
+        SmallVector<Value> args = {coeffsPtr, numTermsVal,
+                                   getArrayPtr(loc, rewriter, op, adaptor.getTerms(), "obs")};
 
         rewriter.replaceOpWithNewOp<LLVM::CallOp>(op, fnDecl, args);
 
@@ -691,11 +1003,10 @@ template <typename T> class SampleBasedPattern : public OpConversionPattern<T> {
         Location loc = op.getLoc();
         MLIRContext *ctx = this->getContext();
 
-        Type qirSignature =
-            LLVM::LLVMFunctionType::get(LLVM::LLVMVoidType::get(ctx),
-                                        {LLVM::LLVMPointerType::get(rewriter.getContext()),
-                                         IntegerType::get(ctx, 64), IntegerType::get(ctx, 64)},
-                                        /*isVarArg=*/true);
+        Type ptrType = LLVM::LLVMPointerType::get(ctx);
+        Type qirSignature = LLVM::LLVMFunctionType::get(
+            LLVM::LLVMVoidType::get(ctx),
+            {ptrType, IntegerType::get(ctx, 64), IntegerType::get(ctx, 64), ptrType});
 
         LLVM::LLVMFuncOp fnDecl = ensureFunctionDeclaration(rewriter, op, qirName, qirSignature);
 
@@ -714,10 +1025,10 @@ template <typename T> class SampleBasedPattern : public OpConversionPattern<T> {
         Value numShots = rewriter.create<LLVM::ConstantOp>(loc, op.getShotsAttr());
         Value numQubits =
             rewriter.create<LLVM::ConstantOp>(loc, rewriter.getI64IntegerAttr(qubits.size()));
-        SmallVector<Value> args = {structPtr, numShots, numQubits};
-        args.insert(args.end(), qubits.begin(), qubits.end());
+        SmallVector<Value> args = {structPtr, numShots, numQubits,
+                                   getArrayPtr(loc, rewriter, op, qubits, "qubits")};
 
-        if constexpr (std::is_same_v<T, SampleOp>) {
+        if constexpr (std::is_same_v<T, SampleOp> || std::is_same_v<T, ShadowOp>) {
             rewriter.create<LLVM::StoreOp>(loc, adaptor.getInData(), structPtr);
         }
         else if constexpr (std::is_same_v<T, CountsOp>) {
@@ -750,7 +1061,11 @@ struct SampleOpPattern : public SampleBasedPattern<SampleOp> {
         Type matrixType =
             conv->convertType(MemRefType::get({UNKNOWN, UNKNOWN}, Float64Type::get(ctx)));
 
-        StringRef qirName = "__catalyst__qis__Sample";
+        StringRef qirName = "__catalyst__qis__Sample_array";
+        if (op.isPacked()) {
+            matrixType = conv->convertType(MemRefType::get({UNKNOWN}, IntegerType::get(ctx, 64)));
+            qirName = "__catalyst__qis__PackedSample_array";
+        }
         performRewrite(rewriter, matrixType, qirName, op, adaptor);
         rewriter.eraseOp(op);
 
@@ -758,6 +1073,28 @@ struct SampleOpPattern : public SampleBasedPattern<SampleOp> {
     }
 };
 
+struct ShadowOpPattern : public SampleBasedPattern<ShadowOp> {
+    using SampleBasedPattern::SampleBasedPattern;
+
+    LogicalResult matchAndRewrite(ShadowOp op, ShadowOpAdaptor adaptor,
+                                  ConversionPatternRewriter &rewriter) const override
+    {
+        MLIRContext *ctx = getContext();
+        const TypeConverter *conv = getTypeConverter();
+
+        if (!op.isBufferized())
+            return op.emitOpError("op must be bufferized before lowering to LLVM");
+
+        Type matrixType =
+            conv->convertType(MemRefType::get({UNKNOWN, UNKNOWN}, IntegerType::get(ctx, 64)));
+
+        performRewrite(rewriter, matrixType, "__catalyst__qis__Shadow_array", op, adaptor);
+        rewriter.eraseOp(op);
+
+        return success();
+    }
+};
+
 struct CountsOpPattern : public SampleBasedPattern<CountsOp> {
     using SampleBasedPattern::SampleBasedPattern;
 
@@ -774,7 +1111,10 @@ struct CountsOpPattern : public SampleBasedPattern<CountsOp> {
         Type vector2Type = conv->convertType(MemRefType::get({UNKNOWN}, IntegerType::get(ctx, 64)));
         Type structType = LLVM::LLVMStructType::getLiteral(ctx, {vector1Type, vector2Type});
 
-        StringRef qirName = "__catalyst__qis__Counts";
+        StringRef qirName = "__catalyst__qis__Counts_array";
+        if (op.getSparse()) {
+            qirName = "__catalyst__qis__SparseCounts_array";
+        }
         performRewrite(rewriter, structType, qirName, op, adaptor);
         rewriter.eraseOp(op);
 
@@ -810,6 +1150,68 @@ template <typename T> struct StatsBasedPattern : public OpConversionPattern<T> {
     }
 };
 
+struct ExpvalVarOpPattern : public OpConversionPattern<ExpvalVarOp> {
+    using OpConversionPattern::OpConversionPattern;
+
+    LogicalResult matchAndRewrite(ExpvalVarOp op, ExpvalVarOpAdaptor adaptor,
+                                  ConversionPatternRewriter &rewriter) const override
+    {
+        Location loc = op.getLoc();
+        MLIRContext *ctx = getContext();
+        const TypeConverter *conv = getTypeConverter();
+
+        Type ptrType = LLVM::LLVMPointerType::get(ctx);
+        Type f64Type = Float64Type::get(ctx);
+
+        StringRef qirName = "__catalyst__qis__ExpvalVar";
+        Type qirSignature =
+            LLVM::LLVMFunctionType::get(LLVM::LLVMVoidType::get(ctx),
+                                        {ptrType, conv->convertType(ObservableType::get(ctx))});
+
+        LLVM::LLVMFuncOp fnDecl = ensureFunctionDeclaration(rewriter, op, qirName, qirSignature);
+
+        // The runtime writes the expectation value and the variance into a stack slot, which is
+        // read right after the call.
+        Value resultsPtr = getStackSlot(loc, rewriter, op, f64Type, 2, "moments");
+        rewriter.create<LLVM::CallOp>(loc, fnDecl, ValueRange{resultsPtr, adaptor.getObs()});
+
+        Value varPtr = rewriter.create<LLVM::GEPOp>(loc, ptrType, f64Type, resultsPtr,
+                                                    llvm::ArrayRef<LLVM::GEPArg>{1}, true);
+        Value expval = rewriter.create<LLVM::LoadOp>(loc, f64Type, resultsPtr);
+        Value var = rewriter.create<LLVM::LoadOp>(loc, f64Type, varPtr);
+        rewriter.replaceOp(op, {expval, var});
+
+        return success();
+    }
+};
+
+struct MeasurementGroupOpPattern : public OpConversionPattern<MeasurementGroupOp> {
+    using OpConversionPattern::OpConversionPattern;
+
+    LogicalResult matchAndRewrite(MeasurementGroupOp op, MeasurementGroupOpAdaptor adaptor,
+                                  ConversionPatternRewriter &rewriter) const override
+    {
+        Location loc = op.getLoc();
+        MLIRContext *ctx = getContext();
+
+        StringRef qirName = "__catalyst__qis__MeasurementGroup_array";
+        Type qirSignature = LLVM::LLVMFunctionType::get(
+            LLVM::LLVMVoidType::get(ctx),
+            {IntegerType::get(ctx, 64), LLVM::LLVMPointerType::get(ctx)});
+
+        LLVM::LLVMFuncOp fnDecl = ensureFunctionDeclaration(rewriter, op, qirName, qirSignature);
+
+        int64_t numObs = op.getObs().size();
+        SmallVector<Value> args = {
+            rewriter.create<LLVM::ConstantOp>(loc, rewriter.getI64IntegerAttr(numObs)),
+            getArrayPtr(loc, rewriter, op, adaptor.getObs(), "obs")};
+
+        rewriter.replaceOpWithNewOp<LLVM::CallOp>(op, fnDecl, args);
+
+        return success();
+    }
+};
+
 template <typename T> struct StateBasedPattern : public OpConversionPattern<T> {
     using OpConversionPattern<T>::OpConversionPattern;
 
@@ -827,18 +1229,17 @@ template <typename T> struct StateBasedPattern : public OpConversionPattern<T> {
         StringRef qirName;
         if constexpr (std::is_same_v<T, ProbsOp>) {
             vectorType = conv->convertType(MemRefType::get({UNKNOWN}, Float64Type::get(ctx)));
-            qirName = "__catalyst__qis__Probs";
+            qirName = "__catalyst__qis__Probs_array";
         }
         else {
             vectorType = conv->convertType(
                 MemRefType::get({UNKNOWN}, ComplexType::get(Float64Type::get(ctx))));
-            qirName = "__catalyst__qis__State";
+            qirName = "__catalyst__qis__State_array";
         }
 
+        Type ptrType = LLVM::LLVMPointerType::get(ctx);
         Type qirSignature = LLVM::LLVMFunctionType::get(
-            LLVM::LLVMVoidType::get(ctx),
-            {LLVM::LLVMPointerType::get(rewriter.getContext()), IntegerType::get(ctx, 64)},
-            /*isVarArg=*/true);
+            LLVM::LLVMVoidType::get(ctx), {ptrType, IntegerType::get(ctx, 64), ptrType});
 
         LLVM::LLVMFuncOp fnDecl = ensureFunctionDeclaration(rewriter, op, qirName, qirSignature);
 
@@ -860,13 +1261,14 @@ template <typename T> struct StateBasedPattern : public OpConversionPattern<T> {
             Value numQubits =
                 rewriter.create<LLVM::ConstantOp>(loc, rewriter.getI64IntegerAttr(qubits.size()));
             args.push_back(numQubits);
-            args.insert(args.end(), qubits.begin(), qubits.end());
+            args.push_back(getArrayPtr(loc, rewriter, op, qubits, "qubits"));
         }
         else {
             // __catalyst__qis__State does not support individual qubit measurements yet, so it must
             // be invoked without specific specific qubits (i.e. measure the whole register).
             Value numQubits = rewriter.create<LLVM::ConstantOp>(loc, rewriter.getI64IntegerAttr(0));
             args.push_back(numQubits);
+            args.push_back(rewriter.create<LLVM::ZeroOp>(loc, ptrType));
         }
 
         rewriter.create<LLVM::CallOp>(loc, fnDecl, args);
@@ -887,14 +1289,23 @@ void populateQIRConversionPatterns(TypeConverter &typeConverter, RewritePatternS
     patterns.add<RTBasedPattern<FinalizeOp>>(typeConverter, patterns.getContext());
     patterns.add<DeviceInitOpPattern>(typeConverter, patterns.getContext());
     patterns.add<DeviceReleaseOpPattern>(typeConverter, patterns.getContext());
+    patterns.add<BatchBasedPattern<BatchBeginOp>>(typeConverter, patterns.getContext());
+    patterns.add<BatchBasedPattern<BatchLaneOp>>(typeConverter, patterns.getContext());
+    patterns.add<BatchBasedPattern<BatchExecuteOp>>(typeConverter, patterns.getContext());
+    patterns.add<BatchBasedPattern<BatchEndOp>>(typeConverter, patterns.getContext());
+    patterns.add<CheckpointOpPattern>(typeConverter, patterns.getContext());
     patterns.add<AllocOpPattern>(typeConverter, patterns.getContext());
     patterns.add<DeallocOpPattern>(typeConverter, patterns.getContext());
     patterns.add<ExtractOpPattern>(typeConverter, patterns.getContext());
     patterns.add<InsertOpPattern>(typeConverter, patterns.getContext());
     patterns.add<CustomOpPattern>(typeConverter, patterns.getContext());
     patterns.add<MultiRZOpPattern>(typeConverter, patterns.getContext());
+    patterns.add<PauliRotOpPattern>(typeConverter, patterns.getContext());
+    patterns.add<QFTOpPattern>(typeConverter, patterns.getContext());
     patterns.add<GlobalPhaseOpPattern>(typeConverter, patterns.getContext());
     patterns.add<QubitUnitaryOpPattern>(typeConverter, patterns.getContext());
+    patterns.add<SetStateBasedPattern<SetStateOp>>(typeConverter, patterns.getContext());
+    patterns.add<SetStateBasedPattern<SetBasisStateOp>>(typeConverter, patterns.getContext());
     patterns.add<MeasureOpPattern>(typeConverter, patterns.getContext());
     patterns.add<ComputationalBasisOpPattern>(typeConverter, patterns.getContext());
     patterns.add<NamedObsOpPattern>(typeConverter, patterns.getContext());
@@ -902,9 +1313,12 @@ void populateQIRConversionPatterns(TypeConverter &typeConverter, RewritePatternS
     patterns.add<TensorOpPattern>(typeConverter, patterns.getContext());
     patterns.add<HamiltonianOpPattern>(typeConverter, patterns.getContext());
     patterns.add<SampleOpPattern>(typeConverter, patterns.getContext());
+    patterns.add<ShadowOpPattern>(typeConverter, patterns.getContext());
     patterns.add<CountsOpPattern>(typeConverter, patterns.getContext());
     patterns.add<StatsBasedPattern<ExpvalOp>>(typeConverter, patterns.getContext());
     patterns.add<StatsBasedPattern<VarianceOp>>(typeConverter, patterns.getContext());
+    patterns.add<ExpvalVarOpPattern>(typeConverter, patterns.getContext());
+    patterns.add<MeasurementGroupOpPattern>(typeConverter, patterns.getContext());
     patterns.add<StateBasedPattern<ProbsOp>>(typeConverter, patterns.getContext());
     patterns.add<StateBasedPattern<StateOp>>(typeConverter, patterns.getContext());
 }
@@ -0,0 +1,195 @@
+// Copyright 2024 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#define DEBUG_TYPE "recognize-qft"
+
+#include <cmath>
+
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/Support/Debug.h"
+#include "llvm/Support/MathExtras.h"
+
+#include "mlir/IR/Matchers.h"
+
+#include "Quantum/IR/QuantumOps.h"
+#include "Quantum/Transforms/Patterns.h"
+
+using llvm::dbgs;
+using namespace mlir;
+using namespace catalyst;
+using namespace catalyst::quantum;
+
+namespace {
+
+/// Return the gate consuming the given qubit value if it is a plain (neither controlled nor
+/// adjoint) custom gate with the given name, and the value has no other use.
+CustomOp getPlainGateUser(Value qubit, StringRef gateName, size_t numQubits)
+{
+    if (!qubit.hasOneUse())
+        return nullptr;
+
+    auto gate = dyn_cast<CustomOp>(*qubit.getUsers().begin());
+    if (!gate || gate.getGateName() != gateName || gate.getInQubits().size() != numQubits ||
+        !gate.getInCtrlQubits().empty() || gate.getAdjointFlag())
+        return nullptr;
+
+    return gate;
+}
+
+/// Return the controlled phase shift consuming the given target qubit if its angle is the
+/// constant pi / 2^k.
+CustomOp getPhaseShiftUser(Value target, int64_t k)
+{
+    CustomOp gate = getPlainGateUser(target, "ControlledPhaseShift", 2);
+    if (!gate || gate.getInQubits()[1] != target || gate.getParams().size() != 1)
+        return nullptr;
+
+    FloatAttr angle;
+    if (!matchPattern(gate.getParams()[0], m_Constant(&angle)))
+        return nullptr;
+
+    double expected = std::ldexp(llvm::numbers::pi, -k);
+    if (std::abs(angle.getValueAsDouble() - expected) > 1e-12 * expected)
+        return nullptr;
+
+    return gate;
+}
+
+/// Replace the gate decomposition of the quantum Fourier transform, as emitted by PennyLane for
+/// `qml.QFT`, with a single `quantum.qft` operation:
+///
+///   for i in range(n):
+///       Hadamard(wires[i])
+///       for j in range(i + 1, n):
+///           ControlledPhaseShift(pi / 2**(j - i), wires=[wires[j], wires[i]])
+///   for i in range(n // 2):
+///       SWAP(wires=[wires[i], wires[n - 1 - i]])
+///
+/// The match starts from the first Hadamard gate and follows the qubit values through the
+/// decomposition, so that every intermediate value must be consumed by the next gate of the
+/// pattern and nothing else.
+struct QFTDecompositionRewritePattern : public mlir::OpRewritePattern<CustomOp> {
+    using mlir::OpRewritePattern<CustomOp>::OpRewritePattern;
+
+    mlir::LogicalResult matchAndRewrite(CustomOp op, mlir::PatternRewriter &rewriter) const override
+    {
+        if (op.getGateName() != "Hadamard" || op.getInQubits().size() != 1 ||
+            !op.getInCtrlQubits().empty() || op.getAdjointFlag())
+            return failure();
+
+        // Input value and current value of each wire of the transform.
+        SmallVector<Value> inputs = {op.getInQubits()[0]};
+        SmallVector<Value> current = {op.getOutQubits()[0]};
+        SmallVector<Operation *> gates = {op};
+
+        // The phase shifts applied to the first wire determine the number of wires.
+        while (CustomOp gate = getPhaseShiftUser(current[0], inputs.size())) {
+            Value control = gate.getInQubits()[0];
+            if (llvm::is_contained(current, control))
+                break;
+            inputs.push_back(control);
+            current.push_back(gate.getOutQubits()[0]);
+            current[0] = gate.getOutQubits()[1];
+            gates.push_back(gate);
+        }
+
+        size_t numWires = inputs.size();
+        if (numWires < 2)
+            return failure();
+
+        for (size_t i = 1; i < numWires; i++) {
+            CustomOp hadamard = getPlainGateUser(current[i], "Hadamard", 1);
+            if (!hadamard)
+                return failure();
+            current[i] = hadamard.getOutQubits()[0];
+            gates.push_back(hadamard);
+
+            for (size_t j = i + 1; j < numWires; j++) {
+                CustomOp gate = getPhaseShiftUser(current[i], j - i);
+                if (!gate || gate.getInQubits()[0] != current[j] || !current[j].hasOneUse())
+                    return failure();
+                current[j] = gate.getOutQubits()[0];
+                current[i] = gate.getOutQubits()[1];
+                gates.push_back(gate);
+            }
+        }
+
+        for (size_t i = 0; i < numWires / 2; i++) {
+            size_t k = numWires - 1 - i;
+            CustomOp swap = getPlainGateUser(current[i], "SWAP", 2);
+            if (!swap || !current[k].hasOneUse())
+                return failure();
+
+            ValueRange in = swap.getInQubits();
+            ValueRange out = swap.getOutQubits();
+            if (in[0] == current[i] && in[1] == current[k]) {
+                current[i] = out[0];
+                current[k] = out[1];
+            }
+            else if (in[0] == current[k] && in[1] == current[i]) {
+                current[i] = out[1];
+                current[k] = out[0];
+            }
+            else {
+                return failure();
+            }
+            gates.push_back(swap);
+        }
+
+        // The transform is inserted after the last gate of the decomposition, which must then
+        // precede every user of the transformed qubits.
+        Block *block = op->getBlock();
+        Operation *last = op;
+        for (Operation *gate : gates) {
+            if (gate->getBlock() != block)
+                return failure();
+            if (last->isBeforeInBlock(gate))
+                last = gate;
+        }
+        for (Value qubit : current) {
+            for (Operation *user : qubit.getUsers()) {
+                Operation *ancestor = block->findAncestorOpInBlock(*user);
+                if (!ancestor || !last->isBeforeInBlock(ancestor))
+                    return failure();
+            }
+        }
+
+        LLVM_DEBUG(dbgs() << "Recognized a quantum Fourier transform on " << numWires
+                          << " wires starting at:\n"
+                          << op << "\n");
+
+        rewriter.setInsertionPointAfter(last);
+        auto qft = rewriter.create<QFTOp>(op.getLoc(), TypeRange(ValueRange(inputs)), TypeRange(),
+                                          inputs, UnitAttr(), ValueRange(), ValueRange());
+        for (auto [qubit, result] : llvm::zip(current, qft.getOutQubits()))
+            rewriter.replaceAllUsesWith(qubit, result);
+        for (Operation *gate : llvm::reverse(gates))
+            rewriter.eraseOp(gate);
+
+        return success();
+    }
+};
+
+} // namespace
+
+namespace catalyst {
+namespace quantum {
+
+void populateQFTPatterns(RewritePatternSet &patterns)
+{
+    patterns.add<QFTDecompositionRewritePattern>(patterns.getContext(), 1);
+}
+
+} // namespace quantum
+} // namespace catalyst
@@ -0,0 +1,407 @@
+// Copyright 2024 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#define DEBUG_TYPE "defer-measurements"
+
+#include <memory>
+#include <optional>
+
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/TypeSwitch.h"
+#include "llvm/Support/Debug.h"
+
+#include "mlir/Dialect/Arith/IR/Arith.h"
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/Dialect/SCF/IR/SCF.h"
+#include "mlir/Dialect/Tensor/IR/Tensor.h"
+#include "mlir/IR/Builders.h"
+#include "mlir/IR/BuiltinOps.h"
+#include "mlir/IR/IRMapping.h"
+#include "mlir/Interfaces/SideEffectInterfaces.h"
+#include "mlir/Pass/Pass.h"
+
+#include "Quantum/IR/QuantumInterfaces.h"
+#include "Quantum/IR/QuantumOps.h"
+#include "Quantum/Transforms/single_register.h"
+
+using namespace llvm;
+using namespace mlir;
+using namespace catalyst::quantum;
+
+namespace catalyst {
+namespace quantum {
+
+#define GEN_PASS_DEF_DEFERMEASUREMENTSPASS
+#include "Quantum/Transforms/Passes.h.inc"
+
+namespace {
+
+bool isQuantumType(Type type) { return isa<QubitType, QuregType>(type); }
+
+// The value defined above the branch that `value`, defined in the branch, is a later version of,
+// following the gates and the register insertions, or nullptr if there is none.
+Value getOrigin(Value value, Region &branch)
+{
+    while (branch.isAncestor(value.getParentRegion())) {
+        Operation *def = value.getDefiningOp();
+        if (auto insert = dyn_cast<InsertOp>(def)) {
+            value = insert.getInQreg();
+        }
+        else if (auto gate = dyn_cast<QuantumGate>(def)) {
+            value = gate.getQubitOperands()[cast<OpResult>(value).getResultNumber()];
+        }
+        else {
+            return nullptr;
+        }
+    }
+    return value;
+}
+
+// Whether the branch only holds gates, register accesses, and classical operations free of side
+// effects, which can all be applied unconditionally once the gates are controlled.
+bool isDeferrable(Region &branch)
+{
+    if (branch.empty()) {
+        return true;
+    }
+    for (Operation &op : branch.front()) {
+        if (isa<CustomOp, MultiRZOp, PauliRotOp, QubitUnitaryOp, QFTOp, GlobalPhaseOp, ExtractOp,
+                InsertOp, scf::YieldOp>(op)) {
+            continue;
+        }
+        if (op.getNumRegions() || !isMemoryEffectFree(&op) ||
+            any_of(op.getOperandTypes(), isQuantumType) ||
+            any_of(op.getResultTypes(), isQuantumType)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// A mid-circuit measurement whose outcome is only used as the condition of conditionals.
+struct FeedForward {
+    MeasureOp measure;
+    SmallVector<scf::IfOp> conditionals;
+    // The operations that turn the outcome into the conditions, users first
+    SmallVector<Operation *> conditions;
+
+    bool addConditional(Operation *user, Value condition)
+    {
+        auto ifOp = dyn_cast<scf::IfOp>(user);
+        if (!ifOp || ifOp.getCondition() != condition || ifOp->getBlock() != measure->getBlock() ||
+            !all_of(ifOp.getResultTypes(), isQuantumType) || !isDeferrable(ifOp.getThenRegion()) ||
+            !isDeferrable(ifOp.getElseRegion())) {
+            return false;
+        }
+
+        // Both branches must yield the later versions of the same values, which the rewritten
+        // branches then update in turn.
+        if (ifOp.getNumResults()) {
+            for (auto [thenValue, elseValue] :
+                 zip(ifOp.thenYield().getOperands(), ifOp.elseYield().getOperands())) {
+                Value origin = getOrigin(thenValue, ifOp.getThenRegion());
+                if (!origin || origin != getOrigin(elseValue, ifOp.getElseRegion())) {
+                    return false;
+                }
+            }
+        }
+
+        conditionals.push_back(ifOp);
+        return true;
+    }
+};
+
+// Match the measurements whose outcome only conditions quantum operations, directly or through
+// the 0-d tensor the frontend wraps it in.
+std::optional<FeedForward> matchFeedForward(MeasureOp measure)
+{
+    if (measure.getPostselect() || measure.getMres().use_empty()) {
+        return std::nullopt;
+    }
+
+    FeedForward feedForward{measure, {}, {}};
+    for (Operation *user : measure.getMres().getUsers()) {
+        auto fromElements = dyn_cast<tensor::FromElementsOp>(user);
+        if (!fromElements) {
+            if (!feedForward.addConditional(user, measure.getMres())) {
+                return std::nullopt;
+            }
+            continue;
+        }
+
+        for (Operation *tensorUser : fromElements->getUsers()) {
+            auto extract = dyn_cast<tensor::ExtractOp>(tensorUser);
+            if (!extract) {
+                return std::nullopt;
+            }
+            for (Operation *extractUser : extract->getUsers()) {
+                if (!feedForward.addConditional(extractUser, extract.getResult())) {
+                    return std::nullopt;
+                }
+            }
+            feedForward.conditions.push_back(extract);
+        }
+        feedForward.conditions.push_back(fromElements);
+    }
+    if (feedForward.conditionals.empty()) {
+        return std::nullopt;
+    }
+
+    llvm::sort(feedForward.conditionals,
+               [](scf::IfOp a, scf::IfOp b) { return a->isBeforeInBlock(b); });
+    return feedForward;
+}
+
+// Create the gate on the remapped operands, with the ancilla as an additional control qubit.
+Operation *createControlledGate(OpBuilder &builder, Operation *gate, const IRMapping &operands,
+                                Value ancilla, Value ctrlValue)
+{
+    auto remap = [&](ValueRange values) {
+        SmallVector<Value> remapped;
+        for (Value value : values) {
+            remapped.push_back(operands.lookup(value));
+        }
+        return remapped;
+    };
+    auto ctrlQubits = [&](auto op) {
+        SmallVector<Value> values = remap(op.getInCtrlQubits());
+        values.push_back(ancilla);
+        return values;
+    };
+    auto ctrlValues = [&](auto op) {
+        SmallVector<Value> values = remap(op.getInCtrlValues());
+        values.push_back(ctrlValue);
+        return values;
+    };
+    auto ctrlTypes = [&](auto op) {
+        TypeRange outCtrlTypes = op.getOutCtrlQubits().getTypes();
+        SmallVector<Type> types(outCtrlTypes.begin(), outCtrlTypes.end());
+        types.push_back(ancilla.getType());
+        return types;
+    };
+
+    Location loc = gate->getLoc();
+    return TypeSwitch<Operation *, Operation *>(gate)
+        .Case([&](CustomOp op) {
+            return builder
+                .create<CustomOp>(loc, op.getOutQubits().getTypes(), ctrlTypes(op),
+                                  remap(op.getParams()), remap(op.getInQubits()),
+                                  op.getGateNameAttr(), op.getAdjointAttr(), ctrlQubits(op),
+                                  ctrlValues(op))
+                .getOperation();
+        })
+        .Case([&](MultiRZOp op) {
+            return builder
+                .create<MultiRZOp>(loc, op.getOutQubits().getTypes(), ctrlTypes(op),
+                                   operands.lookup(op.getTheta()), remap(op.getInQubits()),
+                                   op.getAdjointAttr(), ctrlQubits(op), ctrlValues(op))
+                .getOperation();
+        })
+        .Case([&](PauliRotOp op) {
+            return builder
+                .create<PauliRotOp>(loc, op.getOutQubits().getTypes(), ctrlTypes(op),
+                                    operands.lookup(op.getTheta()), op.getPauliWordAttr(),
+                                    remap(op.getInQubits()), op.getAdjointAttr(), ctrlQubits(op),
+                                    ctrlValues(op))
+                .getOperation();
+        })
+        .Case([&](QubitUnitaryOp op) {
+            return builder
+                .create<QubitUnitaryOp>(loc, op.getOutQubits().getTypes(), ctrlTypes(op),
+                                        operands.lookup(op.getMatrix()), remap(op.getInQubits()),
+                                        op.getAdjointAttr(), ctrlQubits(op), ctrlValues(op))
+                .getOperation();
+        })
+        .Case([&](QFTOp op) {
+            return builder
+                .create<QFTOp>(loc, op.getOutQubits().getTypes(), ctrlTypes(op),
+                               remap(op.getInQubits()), op.getAdjointAttr(), ctrlQubits(op),
+                               ctrlValues(op))
+                .getOperation();
+        })
+        .Case([&](GlobalPhaseOp op) {
+            // The global phase of a branch is a relative phase once controlled
+            return builder
+                .create<GlobalPhaseOp>(loc, ctrlTypes(op), operands.lookup(op.getParams()),
+                                       op.getAdjointAttr(), ctrlQubits(op), ctrlValues(op))
+                .getOperation();
+        })
+        .Default([](Operation *) -> Operation * { llvm_unreachable("unexpected deferred gate"); });
+}
+
+// Apply the operations of the branch at the insertion point, with the gates controlled on the
+// ancilla holding the outcome `outcome`, and record the latest versions of the values defined
+// above the conditional.
+void deferBranch(OpBuilder &builder, Region &branch, bool outcome, Value &ancilla,
+                 DenseMap<Value, Value> &latest)
+{
+    if (branch.empty()) {
+        return;
+    }
+
+    IRMapping mapping;
+    auto lookup = [&](Value value) {
+        if (mapping.contains(value)) {
+            return mapping.lookup(value);
+        }
+        Value next = latest.lookup(value);
+        return next ? next : value;
+    };
+
+    Value ctrlValue;
+    for (Operation &op : branch.front().without_terminator()) {
+        IRMapping operands;
+        for (Value operand : op.getOperands()) {
+            operands.map(operand, lookup(operand));
+        }
+
+        Operation *clone;
+        if (isa<QuantumGate>(op)) {
+            if (!ctrlValue) {
+                ctrlValue = builder.create<arith::ConstantIntOp>(op.getLoc(), outcome, 1);
+            }
+            clone = createControlledGate(builder, &op, operands, ancilla, ctrlValue);
+            ancilla = clone->getResults().back();
+        }
+        else {
+            clone = builder.clone(op, operands);
+        }
+
+        // The ancilla is the last control qubit, after the results of the original operation.
+        for (auto [result, cloneResult] : zip(op.getResults(), clone->getResults())) {
+            mapping.map(result, cloneResult);
+            if (Value origin = getOrigin(result, branch)) {
+                latest[origin] = cloneResult;
+            }
+        }
+    }
+}
+
+// Replace the measurement by a CNOT onto the ancilla, and its conditionals by the operations of
+// both branches controlled on the ancilla. Returns the latest version of the ancilla.
+Value deferMeasurement(FeedForward &feedForward, Value ancilla)
+{
+    MeasureOp measure = feedForward.measure;
+    OpBuilder builder(measure);
+    Type qubitType = measure.getInQubit().getType();
+    auto cnot = builder.create<CustomOp>(
+        measure.getLoc(), TypeRange{qubitType, qubitType}, TypeRange{}, ValueRange{},
+        ValueRange{measure.getInQubit(), ancilla}, builder.getStringAttr("CNOT"), UnitAttr(),
+        ValueRange{}, ValueRange{});
+    measure.getOutQubit().replaceAllUsesWith(cnot.getOutQubits()[0]);
+    ancilla = cnot.getOutQubits()[1];
+
+    for (scf::IfOp ifOp : feedForward.conditionals) {
+        builder.setInsertionPoint(ifOp);
+        DenseMap<Value, Value> latest;
+        deferBranch(builder, ifOp.getThenRegion(), true, ancilla, latest);
+        deferBranch(builder, ifOp.getElseRegion(), false, ancilla, latest);
+
+        if (ifOp.getNumResults()) {
+            for (auto [result, yielded] : zip(ifOp.getResults(), ifOp.thenYield().getOperands())) {
+                Value origin = getOrigin(yielded, ifOp.getThenRegion());
+                Value next = latest.lookup(origin);
+                result.replaceAllUsesWith(next ? next : origin);
+            }
+        }
+        ifOp.erase();
+    }
+
+    for (Operation *op : feedForward.conditions) {
+        op->erase();
+    }
+    measure.erase();
+    return ancilla;
+}
+
+// Defer the measurements of a function that allocates a single register, with the ancillas
+// allocated along with it and released before it.
+void deferMeasurements(func::FuncOp func, unsigned maxAncillas)
+{
+    // The state of the device would include the ancillas, whose partial trace is not supported
+    std::optional<std::pair<AllocOp, DeallocOp>> reg = getSingleRegister(func);
+    if (!reg) {
+        return;
+    }
+
+    AllocOp alloc = reg->first;
+    DeallocOp dealloc = reg->second;
+    SmallVector<FeedForward> deferred;
+    for (MeasureOp measure : alloc->getBlock()->getOps<MeasureOp>()) {
+        if (deferred.size() == maxAncillas) {
+            break;
+        }
+        if (!alloc->isBeforeInBlock(measure) || !measure->isBeforeInBlock(dealloc)) {
+            continue;
+        }
+        if (std::optional<FeedForward> feedForward = matchFeedForward(measure)) {
+            deferred.push_back(std::move(*feedForward));
+        }
+    }
+    if (deferred.empty()) {
+        return;
+    }
+
+    Location loc = alloc.getLoc();
+    Type qregType = alloc.getQreg().getType();
+    Type qubitType = QubitType::get(func.getContext());
+    OpBuilder builder(alloc->getContext());
+    builder.setInsertionPointAfter(alloc);
+    Value ancillaReg = builder.create<AllocOp>(loc, qregType, Value(),
+                                               builder.getI64IntegerAttr(deferred.size()));
+    SmallVector<Value> ancillas;
+    for (size_t i = 0; i < deferred.size(); i++) {
+        ancillas.push_back(builder.create<ExtractOp>(loc, qubitType, ancillaReg, Value(),
+                                                     builder.getI64IntegerAttr(i)));
+    }
+
+    for (auto [feedForward, ancilla] : zip(deferred, ancillas)) {
+        ancilla = deferMeasurement(feedForward, ancilla);
+    }
+
+    // Releasing a register releases every qubit of the device, so the ancillas are only released
+    // right before the register, once the measurements of the register are done.
+    builder.setInsertionPoint(dealloc);
+    for (auto [i, ancilla] : enumerate(ancillas)) {
+        ancillaReg = builder.create<InsertOp>(loc, qregType, ancillaReg, Value(),
+                                              builder.getI64IntegerAttr(i), ancilla);
+    }
+    builder.create<DeallocOp>(loc, ancillaReg);
+}
+
+} // namespace
+
+struct DeferMeasurementsPass : impl::DeferMeasurementsPassBase<DeferMeasurementsPass> {
+    using DeferMeasurementsPassBase::DeferMeasurementsPassBase;
+
+    void runOnOperation() final
+    {
+        LLVM_DEBUG(dbgs() << "defer measurements pass"
+                          << "\n");
+
+        if (!maxAncillas) {
+            return;
+        }
+        getOperation()->walk([&](func::FuncOp func) { deferMeasurements(func, maxAncillas); });
+    }
+};
+
+} // namespace quantum
+
+std::unique_ptr<Pass> createDeferMeasurementsPass()
+{
+    return std::make_unique<quantum::DeferMeasurementsPass>();
+}
+
+} // namespace catalyst
@@ -0,0 +1,139 @@
+// Copyright 2024 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#define DEBUG_TYPE "group-measurements"
+
+#include <memory>
+
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SetVector.h"
+#include "llvm/Support/Debug.h"
+
+#include "mlir/IR/Builders.h"
+#include "mlir/IR/BuiltinOps.h"
+#include "mlir/Pass/Pass.h"
+
+#include "Quantum/IR/QuantumInterfaces.h"
+#include "Quantum/IR/QuantumOps.h"
+
+using namespace llvm;
+using namespace mlir;
+using namespace catalyst::quantum;
+
+namespace catalyst {
+namespace quantum {
+
+#define GEN_PASS_DEF_GROUPMEASUREMENTSPASS
+#include "Quantum/Transforms/Passes.h.inc"
+
+namespace {
+
+// The consecutive expectation values and variances of a block, with the operations that define
+// their observables after the first of them.
+struct MeasurementGroup {
+    SmallVector<Operation *> measurements;
+    SetVector<Operation *> definitions;
+
+    // Add the measurement to the group, unless its observable depends on another measurement
+    // of the group.
+    bool add(Operation *measurement)
+    {
+        if (measurements.empty()) {
+            measurements.push_back(measurement);
+            return true;
+        }
+
+        Operation *first = measurements.front();
+        SetVector<Operation *> slice;
+        SmallVector<Value> worklist = {measurement->getOperand(0)};
+        while (!worklist.empty()) {
+            Operation *def = worklist.pop_back_val().getDefiningOp();
+            if (!def || def->getBlock() != first->getBlock() || def->isBeforeInBlock(first) ||
+                definitions.contains(def) || !slice.insert(def)) {
+                continue;
+            }
+            if (isa<MeasurementProcess>(def)) {
+                return false;
+            }
+            worklist.append(def->operand_begin(), def->operand_end());
+        }
+
+        measurements.push_back(measurement);
+        definitions.insert(slice.begin(), slice.end());
+        return true;
+    }
+
+    // Hoist the definitions of the observables, which are free of side effects, above the first
+    // measurement, and announce the measurements to the device there.
+    void emit()
+    {
+        if (measurements.size() >= 2) {
+            Operation *first = measurements.front();
+            SmallVector<Operation *> hoisted(definitions.begin(), definitions.end());
+            llvm::sort(hoisted, [](Operation *a, Operation *b) { return a->isBeforeInBlock(b); });
+            for (Operation *op : hoisted) {
+                op->moveBefore(first);
+            }
+
+            SmallVector<Value> observables;
+            for (Operation *op : measurements) {
+                observables.push_back(op->getOperand(0));
+            }
+            OpBuilder builder(first);
+            builder.create<MeasurementGroupOp>(first->getLoc(), observables);
+        }
+        measurements.clear();
+        definitions.clear();
+    }
+};
+
+} // namespace
+
+struct GroupMeasurementsPass : impl::GroupMeasurementsPassBase<GroupMeasurementsPass> {
+    using GroupMeasurementsPassBase::GroupMeasurementsPassBase;
+
+    void runOnOperation() final
+    {
+        LLVM_DEBUG(dbgs() << "group measurements pass"
+                          << "\n");
+
+        getOperation()->walk([](Block *block) {
+            if (!block->getOps<MeasurementGroupOp>().empty()) {
+                return;
+            }
+
+            MeasurementGroup group;
+            for (Operation &op : llvm::make_early_inc_range(*block)) {
+                // The operations that may change the quantum state end a group of measurements.
+                if (!preservesQuantumState(&op)) {
+                    group.emit();
+                }
+                else if (isa<ExpvalOp, VarianceOp, ExpvalVarOp>(op) && !group.add(&op)) {
+                    group.emit();
+                    group.add(&op);
+                }
+            }
+            group.emit();
+        });
+    }
+};
+
+} // namespace quantum
+
+std::unique_ptr<Pass> createGroupMeasurementsPass()
+{
+    return std::make_unique<quantum::GroupMeasurementsPass>();
+}
+
+} // namespace catalyst
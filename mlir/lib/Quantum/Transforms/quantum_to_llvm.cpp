@@ -87,7 +87,11 @@ struct QuantumConversionPass : impl::QuantumConversionPassBase<QuantumConversion
 
         if (failed(applyFullConversion(getOperation(), target, std::move(patterns)))) {
             signalPassFailure();
+            return;
         }
+
+        // The tags are only needed to share the stack slots during the conversion.
+        getOperation()->walk([](LLVM::AllocaOp alloca) { alloca->removeAttr(StackSlotAttr); });
     }
 };
 
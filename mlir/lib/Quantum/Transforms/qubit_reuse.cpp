@@ -0,0 +1,305 @@
+// Copyright 2024 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#define DEBUG_TYPE "qubit-reuse"
+
+#include <limits>
+#include <memory>
+
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/Support/Debug.h"
+
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/Dialect/SCF/IR/SCF.h"
+#include "mlir/IR/Builders.h"
+#include "mlir/IR/BuiltinOps.h"
+#include "mlir/Pass/Pass.h"
+
+#include "Quantum/IR/QuantumInterfaces.h"
+#include "Quantum/IR/QuantumOps.h"
+#include "Quantum/Transforms/single_register.h"
+
+using namespace llvm;
+using namespace mlir;
+using namespace catalyst::quantum;
+
+namespace catalyst {
+namespace quantum {
+
+#define GEN_PASS_DEF_QUBITREUSEPASS
+#include "Quantum/Transforms/Passes.h.inc"
+
+namespace {
+
+constexpr size_t neverFree = std::numeric_limits<size_t>::max();
+
+// The accesses to a wire of the register, in terms of the versions of the register, which are
+// numbered in the order of the insertions that update it.
+struct Wire {
+    SmallVector<ExtractOp> extracts;
+    SmallVector<InsertOp> inserts;
+    // The first and last versions the wire is extracted from
+    size_t begin = std::numeric_limits<size_t>::max();
+    size_t lastExtract = 0;
+    // Whether some qubit value of the wire is used by an observable, or not inserted back, which
+    // keeps the wire live until the release
+    bool pinned = false;
+};
+
+// Follow the qubit values extracted from the wire to the operations that use them, up to their
+// insertion back into the wire. Returns false for the uses this pass does not handle.
+bool traceWire(ExtractOp extract, Wire &wire)
+{
+    Block *block = extract->getBlock();
+    uint64_t idx = *extract.getIdxAttr();
+    SmallVector<Value> worklist{extract.getQubit()};
+    while (!worklist.empty()) {
+        Value qubit = worklist.pop_back_val();
+        wire.pinned |= qubit.use_empty();
+        for (OpOperand &use : qubit.getUses()) {
+            Operation *user = use.getOwner();
+            if (user->getBlock() != block) {
+                return false;
+            }
+            if (auto insert = dyn_cast<InsertOp>(user)) {
+                if (!insert.getIdxAttr() || *insert.getIdxAttr() != idx) {
+                    return false;
+                }
+                wire.inserts.push_back(insert);
+            }
+            else if (auto gate = dyn_cast<QuantumGate>(user)) {
+                for (auto [operand, result] :
+                     zip(gate.getQubitOperands(), gate.getQubitResults())) {
+                    if (operand == qubit) {
+                        worklist.push_back(result);
+                    }
+                }
+            }
+            else if (auto measure = dyn_cast<MeasureOp>(user)) {
+                worklist.push_back(measure.getOutQubit());
+            }
+            else if (isa<ComputationalBasisOp, NamedObsOp, HermitianOp>(user)) {
+                wire.pinned = true;
+            }
+            else {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Reset the measured qubit to the zero state before it is inserted back, flipping it when the
+// outcome is one.
+void resetQubit(MeasureOp measure)
+{
+    Location loc = measure.getLoc();
+    Value qubit = measure.getOutQubit();
+    InsertOp insert = cast<InsertOp>(*qubit.getUsers().begin());
+    std::optional<uint32_t> postselect = measure.getPostselect();
+    if (postselect && *postselect == 0) {
+        return;
+    }
+
+    OpBuilder builder(measure);
+    builder.setInsertionPointAfter(measure);
+    auto createFlip = [&](OpBuilder &builder, Location loc) {
+        return builder
+            .create<CustomOp>(loc, TypeRange{qubit.getType()}, TypeRange{}, ValueRange{},
+                              ValueRange{qubit}, builder.getStringAttr("PauliX"), UnitAttr(),
+                              ValueRange{}, ValueRange{})
+            .getOutQubits()[0];
+    };
+
+    Value reset;
+    if (postselect) {
+        reset = createFlip(builder, loc);
+    }
+    else {
+        auto ifOp = builder.create<scf::IfOp>(
+            loc, measure.getMres(),
+            [&](OpBuilder &builder, Location loc) { // then
+                builder.create<scf::YieldOp>(loc, createFlip(builder, loc));
+            },
+            [&](OpBuilder &builder, Location loc) { // else
+                builder.create<scf::YieldOp>(loc, qubit);
+            });
+        reset = ifOp.getResult(0);
+    }
+    insert.getQubitMutable().assign(reset);
+}
+
+// Map the wires of the single register allocated by the function onto as few slots as possible.
+void reuseQubits(func::FuncOp func)
+{
+    // The state of the device would cover the slots rather than the wires
+    std::optional<std::pair<AllocOp, DeallocOp>> reg = getSingleRegister(func);
+    if (!reg) {
+        return;
+    }
+
+    AllocOp alloc = reg->first;
+    DeallocOp dealloc = reg->second;
+    Block *block = alloc->getBlock();
+    std::optional<uint64_t> numQubits = alloc.getNqubitsAttr();
+    if (!numQubits) {
+        return;
+    }
+
+    // Number the versions of the register, which must be updated by a chain of insertions ending
+    // with the release, and collect the extractions of each wire.
+    DenseMap<Value, size_t> versions;
+    SmallVector<Wire> wires(*numQubits);
+    size_t numInserts = 0;
+    for (Value qreg = alloc.getQreg(); qreg;) {
+        size_t version = versions.size();
+        versions[qreg] = version;
+
+        Operation *successor = nullptr;
+        for (Operation *user : qreg.getUsers()) {
+            if (user->getBlock() != block) {
+                return;
+            }
+            if (auto extract = dyn_cast<ExtractOp>(user)) {
+                if (!extract.getIdxAttr() || *extract.getIdxAttr() >= *numQubits) {
+                    return;
+                }
+                Wire &wire = wires[*extract.getIdxAttr()];
+                wire.extracts.push_back(extract);
+                wire.begin = std::min(wire.begin, version);
+                wire.lastExtract = std::max(wire.lastExtract, version);
+            }
+            else if (!successor && (isa<InsertOp>(user) || user == dealloc)) {
+                successor = user;
+            }
+            else {
+                return;
+            }
+        }
+        if (!successor) {
+            return;
+        }
+
+        auto insert = dyn_cast<InsertOp>(successor);
+        numInserts += static_cast<bool>(insert);
+        qreg = insert ? insert.getOutQreg() : Value();
+    }
+
+    // Every insertion must put back a qubit extracted from the same wire.
+    size_t numTraced = 0;
+    for (Wire &wire : wires) {
+        for (ExtractOp extract : wire.extracts) {
+            if (!traceWire(extract, wire)) {
+                return;
+            }
+        }
+        numTraced += wire.inserts.size();
+    }
+    if (numTraced != numInserts) {
+        return;
+    }
+
+    // The slot of a wire is free from the version produced by its last insertion, if the wire is
+    // not extracted from that version on and is inserted back from a measurement, which the slot
+    // is then reset after.
+    auto getFreeFrom = [&](Wire &wire, MeasureOp &measure) -> size_t {
+        if (wire.pinned || wire.inserts.empty()) {
+            return neverFree;
+        }
+        InsertOp last = *max_element(wire.inserts, [&](InsertOp a, InsertOp b) {
+            return versions.lookup(a.getOutQreg()) < versions.lookup(b.getOutQreg());
+        });
+        size_t end = versions.lookup(last.getOutQreg());
+        measure = last.getQubit().getDefiningOp<MeasureOp>();
+        if (!measure || !last.getQubit().hasOneUse() || wire.lastExtract >= end) {
+            return neverFree;
+        }
+        return end;
+    };
+
+    // Assigning the wires in the order they are first extracted uses the fewest slots, as their
+    // lifetimes are intervals of versions.
+    SmallVector<size_t> order;
+    for (size_t idx = 0; idx < wires.size(); idx++) {
+        if (!wires[idx].extracts.empty()) {
+            order.push_back(idx);
+        }
+    }
+    llvm::stable_sort(order, [&](size_t a, size_t b) { return wires[a].begin < wires[b].begin; });
+
+    SmallVector<size_t> slots(*numQubits);
+    // The version from which each slot is free, and the measurement of the wire that frees it
+    SmallVector<size_t> freeFrom;
+    SmallVector<MeasureOp> freedBy;
+    SmallVector<MeasureOp> resets;
+    for (size_t idx : order) {
+        Wire &wire = wires[idx];
+        auto slot = find_if(freeFrom, [&](size_t from) { return from <= wire.begin; });
+        if (slot == freeFrom.end()) {
+            slots[idx] = freeFrom.size();
+            freeFrom.push_back(neverFree);
+            freedBy.push_back(nullptr);
+        }
+        else {
+            slots[idx] = slot - freeFrom.begin();
+            resets.push_back(freedBy[slots[idx]]);
+        }
+
+        MeasureOp measure;
+        freeFrom[slots[idx]] = getFreeFrom(wire, measure);
+        freedBy[slots[idx]] = measure;
+    }
+    if (freeFrom.size() >= *numQubits) {
+        return;
+    }
+
+    LLVM_DEBUG(dbgs() << "reusing qubits in " << func.getName() << ": " << *numQubits << " -> "
+                      << freeFrom.size() << "\n");
+
+    for (MeasureOp measure : resets) {
+        resetQubit(measure);
+    }
+    for (size_t idx : order) {
+        for (ExtractOp extract : wires[idx].extracts) {
+            extract.setIdxAttr(slots[idx]);
+        }
+        for (InsertOp insert : wires[idx].inserts) {
+            insert.setIdxAttr(slots[idx]);
+        }
+    }
+    alloc.setNqubitsAttr(freeFrom.size());
+}
+
+} // namespace
+
+struct QubitReusePass : impl::QubitReusePassBase<QubitReusePass> {
+    using QubitReusePassBase::QubitReusePassBase;
+
+    void runOnOperation() final
+    {
+        LLVM_DEBUG(dbgs() << "qubit reuse pass"
+                          << "\n");
+
+        getOperation()->walk([&](func::FuncOp func) { reuseQubits(func); });
+    }
+};
+
+} // namespace quantum
+
+std::unique_ptr<Pass> createQubitReusePass()
+{
+    return std::make_unique<quantum::QubitReusePass>();
+}
+
+} // namespace catalyst
@@ -0,0 +1,51 @@
+// Copyright 2024 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "llvm/ADT/SmallVector.h"
+
+#include "Quantum/Transforms/single_register.h"
+
+using namespace llvm;
+using namespace mlir;
+
+namespace catalyst {
+namespace quantum {
+
+std::optional<std::pair<AllocOp, DeallocOp>> getSingleRegister(func::FuncOp func)
+{
+    SmallVector<AllocOp> allocs;
+    SmallVector<DeallocOp> deallocs;
+    bool hasState = false;
+    func.walk([&](Operation *op) {
+        if (auto alloc = dyn_cast<AllocOp>(op)) {
+            allocs.push_back(alloc);
+        }
+        else if (auto dealloc = dyn_cast<DeallocOp>(op)) {
+            deallocs.push_back(dealloc);
+        }
+        // The state covers every qubit, and so does a basis without qubits
+        else if (auto compbasis = dyn_cast<ComputationalBasisOp>(op)) {
+            hasState |= compbasis.getQubits().empty();
+        }
+        hasState |= isa<StateOp>(op);
+    });
+    if (allocs.size() != 1 || deallocs.size() != 1 || hasState ||
+        allocs.front()->getBlock() != deallocs.front()->getBlock()) {
+        return std::nullopt;
+    }
+    return std::make_pair(allocs.front(), deallocs.front());
+}
+
+} // namespace quantum
+} // namespace catalyst
@@ -19,6 +19,7 @@
 #include "mlir/Dialect/SCF/IR/SCF.h"
 #include "mlir/Dialect/Tensor/IR/Tensor.h"
 #include "mlir/IR/IRMapping.h"
+#include "mlir/Interfaces/SideEffectInterfaces.h"
 #include "mlir/Transforms/DialectConversion.h"
 
 #include "Catalyst/IR/CatalystOps.h"
@@ -84,38 +85,114 @@ void verifyTypeIsCacheable(Type ty, mlir::Operation *op)
 QuantumCache QuantumCache::initialize(Region &region, OpBuilder &builder, Location loc)
 {
     MLIRContext *ctx = builder.getContext();
-    auto paramVectorType = ArrayListType::get(ctx, builder.getF64Type());
-    auto wireVectorType = ArrayListType::get(ctx, builder.getI64Type());
-    auto controlFlowTapeType = ArrayListType::get(ctx, builder.getIndexType());
-    auto paramVector = builder.create<ListInitOp>(loc, paramVectorType);
-    auto wireVector = builder.create<ListInitOp>(loc, wireVectorType);
+    QuantumCache cache{.topLevelRegion = &region};
+    auto isCached = [&cache](Value value) { return !cache.isRecomputable(value); };
 
-    // Initialize the tapes that store the structure of control flow.
-    DenseMap<Operation *, TypedValue<ArrayListType>> controlFlowTapes;
+    // Only allocate the vectors and tapes that will be pushed to.
+    bool cacheParams = false;
+    bool cacheWires = false;
+    SmallVector<Operation *> cachedControlFlow;
     region.walk([&](Operation *op) {
-        if (isa<scf::ForOp, scf::IfOp, scf::WhileOp>(op)) {
-            auto tape = builder.create<catalyst::ListInitOp>(loc, controlFlowTapeType);
-            controlFlowTapes.insert({op, tape});
+        if (auto gate = dyn_cast<quantum::ParametrizedGate>(op)) {
+            cacheParams |= llvm::any_of(gate.getAllParams(), isCached);
+        }
+        else if (auto extractOp = dyn_cast<quantum::ExtractOp>(op)) {
+            cacheWires |= !extractOp.getIdxAttr().has_value() && isCached(extractOp.getIdx());
+        }
+        else if (auto insertOp = dyn_cast<quantum::InsertOp>(op)) {
+            cacheWires |= !insertOp.getIdxAttr().has_value() && isCached(insertOp.getIdx());
+        }
+        else if (auto forOp = dyn_cast<scf::ForOp>(op)) {
+            Value bounds[] = {forOp.getLowerBound(), forOp.getUpperBound(), forOp.getStep()};
+            if (llvm::any_of(bounds, isCached)) {
+                cachedControlFlow.push_back(op);
+            }
+        }
+        else if (auto ifOp = dyn_cast<scf::IfOp>(op)) {
+            if (isCached(ifOp.getCondition())) {
+                cachedControlFlow.push_back(op);
+            }
+        }
+        else if (isa<scf::WhileOp>(op)) {
+            cachedControlFlow.push_back(op);
         }
     });
-    return quantum::QuantumCache{
-        .paramVector = paramVector, .wireVector = wireVector, .controlFlowTapes = controlFlowTapes};
+
+    if (cacheParams) {
+        auto paramVectorType = ArrayListType::get(ctx, builder.getF64Type());
+        cache.paramVector = builder.create<ListInitOp>(loc, paramVectorType);
+    }
+    if (cacheWires) {
+        auto wireVectorType = ArrayListType::get(ctx, builder.getI64Type());
+        cache.wireVector = builder.create<ListInitOp>(loc, wireVectorType);
+    }
+
+    // Initialize the tapes that store the structure of control flow.
+    auto controlFlowTapeType = ArrayListType::get(ctx, builder.getIndexType());
+    for (Operation *op : cachedControlFlow) {
+        auto tape = builder.create<catalyst::ListInitOp>(loc, controlFlowTapeType);
+        cache.controlFlowTapes.insert({op, tape});
+    }
+    return cache;
 }
 
 void QuantumCache::emitDealloc(OpBuilder &builder, Location loc)
 {
-    builder.create<ListDeallocOp>(loc, paramVector);
-    builder.create<ListDeallocOp>(loc, wireVector);
+    if (paramVector) {
+        builder.create<ListDeallocOp>(loc, paramVector);
+    }
+    if (wireVector) {
+        builder.create<ListDeallocOp>(loc, wireVector);
+    }
     for (const auto &[_key, controlFlowTape] : controlFlowTapes) {
         builder.create<ListDeallocOp>(loc, controlFlowTape);
     }
 }
 
+bool QuantumCache::isRecomputable(Value value) const
+{
+    if (!topLevelRegion->isAncestor(value.getParentRegion())) {
+        return true;
+    }
+    if (isQuantumType(value.getType())) {
+        return false;
+    }
+
+    // The adjoint loops iterate over the same induction variables in reverse.
+    if (auto arg = dyn_cast<BlockArgument>(value)) {
+        auto forOp = dyn_cast<scf::ForOp>(arg.getOwner()->getParentOp());
+        return forOp && value == forOp.getInductionVar();
+    }
+
+    // Top-level classical values are computed once before the quantum program is re-executed.
+    Operation *op = value.getDefiningOp();
+    if (isa<QuantumDialect>(op->getDialect())) {
+        return false;
+    }
+    if (op->getParentRegion() == topLevelRegion) {
+        return true;
+    }
+
+    auto it = recomputable.find(value);
+    if (it != recomputable.end()) {
+        return it->second;
+    }
+    bool result =
+        isPure(op) && op->getNumRegions() == 0 &&
+        llvm::all_of(op->getOperands(), [&](Value operand) { return isRecomputable(operand); });
+    recomputable[value] = result;
+    return result;
+}
+
 void AugmentedCircuitGenerator::cacheGate(quantum::ParametrizedGate gate, OpBuilder &builder)
 {
     ValueRange params = gate.getAllParams();
 
     for (Value param : params) {
+        if (cache.isRecomputable(param)) {
+            continue;
+        }
+
         Location loc = gate.getLoc();
         Value clonedParam = oldToCloned.lookupOrDefault(param);
         Type paramType = clonedParam.getType();
@@ -254,10 +331,12 @@ void AugmentedCircuitGenerator::visitOperation(scf::ForOp forOp, OpBuilder &buil
         }
     }
 
-    // Store the start, stop, and step to this op's control flow tape.
-    Value tape = cache.controlFlowTapes.at(forOp);
-    for (Value param : {forOp.getLowerBound(), forOp.getUpperBound(), forOp.getStep()}) {
-        builder.create<ListPushOp>(forOp.getLoc(), oldToCloned.lookupOrDefault(param), tape);
+    // Store the start, stop, and step to this op's control flow tape, unless they can be
+    // recomputed.
+    if (Value tape = cache.controlFlowTapes.lookup(forOp)) {
+        for (Value param : {forOp.getLowerBound(), forOp.getUpperBound(), forOp.getStep()}) {
+            builder.create<ListPushOp>(forOp.getLoc(), oldToCloned.lookupOrDefault(param), tape);
+        }
     }
 
     auto newForOp = builder.create<scf::ForOp>(
@@ -344,12 +423,13 @@ void AugmentedCircuitGenerator::visitOperation(scf::IfOp ifOp, OpBuilder &builde
     DenseMap<unsigned, unsigned> argIdxMapping;
     populateArgIdxMapping(ifOp.getResultTypes(), argIdxMapping);
 
-    // Store the condition to this op's control flow tape
+    // Store the condition to this op's control flow tape, unless it can be recomputed.
     Value condition = oldToCloned.lookupOrDefault(ifOp.getCondition());
-    Value tape = cache.controlFlowTapes.at(ifOp);
-    Value castedCondition =
-        builder.create<index::CastSOp>(ifOp.getLoc(), builder.getIndexType(), condition);
-    builder.create<ListPushOp>(ifOp.getLoc(), castedCondition, tape);
+    if (Value tape = cache.controlFlowTapes.lookup(ifOp)) {
+        Value castedCondition =
+            builder.create<index::CastSOp>(ifOp.getLoc(), builder.getIndexType(), condition);
+        builder.create<ListPushOp>(ifOp.getLoc(), castedCondition, tape);
+    }
 
     auto newIfOp =
         builder.create<scf::IfOp>(ifOp.getLoc(), condition, getRegionBuilder(ifOp.getThenRegion()),
@@ -21,10 +21,15 @@
 func.func private @circuit.nodealloc(%arg0: f32) -> (!quantum.reg)
 
 // CHECK-DAG:   llvm.func @__catalyst__rt__toggle_recorder(i1)
-// CHECK-DAG:   llvm.func @__catalyst__qis__Gradient(i64, ...)
+// CHECK-DAG:   llvm.func @__catalyst__qis__Gradient_array(i64, !llvm.ptr)
 
 // CHECK-LABEL: func.func @adjoint(%arg0: f32, %arg1: index) {{.+}} {
 func.func @adjoint(%arg0: f32, %arg1 : index) -> (memref<?xf64>, memref<?xf64>) {
+    // The result memrefs are passed through stack slots allocated in the entry block.
+    // CHECK:       [[NSLOTS:%.+]] = llvm.mlir.constant(2 : i64) : i64
+    // CHECK:       [[MEMREFS:%.+]] = llvm.alloca [[NSLOTS]] x !llvm.struct<(ptr, ptr, i64, array<1 x i64>, array<1 x i64>)>
+    // CHECK:       [[GRADS:%.+]] = llvm.alloca [[NSLOTS]] x !llvm.ptr
+
     // CHECK-DAG:   [[T:%.+]] = llvm.mlir.constant(true) : i1
     // CHECK-DAG:   [[F:%.+]] = llvm.mlir.constant(false) : i1
 
@@ -32,12 +37,17 @@ func.func @adjoint(%arg0: f32, %arg1 : index) -> (memref<?xf64>, memref<?xf64>)
     // CHECK:       [[QREG:%.+]] = call @circuit.nodealloc(%arg0)
     // CHECK:       llvm.call @__catalyst__rt__toggle_recorder([[F]])
 
-    // CHECK-DAG:   [[C1:%.+]] = llvm.mlir.constant(1 : i64) : i64
-    // CHECK-DAG:   [[C2:%.+]] = llvm.mlir.constant(2 : i64) : i64
-    // CHECK:       [[GRAD1:%.+]] = llvm.alloca [[C1]] x !llvm.struct<(ptr, ptr, i64, array<1 x i64>, array<1 x i64>)>
-    // CHECK:       [[GRAD2:%.+]] = llvm.alloca [[C1]] x !llvm.struct<(ptr, ptr, i64, array<1 x i64>, array<1 x i64>)>
+    // CHECK:       [[C2:%.+]] = llvm.mlir.constant(2 : i64) : i64
+    // CHECK:       [[GRAD1:%.+]] = llvm.getelementptr inbounds [[MEMREFS]][0]
+    // CHECK:       llvm.store {{%.+}}, [[GRAD1]]
+    // CHECK:       [[PGRAD1:%.+]] = llvm.getelementptr inbounds [[GRADS]][0]
+    // CHECK:       llvm.store [[GRAD1]], [[PGRAD1]]
+    // CHECK:       [[GRAD2:%.+]] = llvm.getelementptr inbounds [[MEMREFS]][1]
+    // CHECK:       llvm.store {{%.+}}, [[GRAD2]]
+    // CHECK:       [[PGRAD2:%.+]] = llvm.getelementptr inbounds [[GRADS]][1]
+    // CHECK:       llvm.store [[GRAD2]], [[PGRAD2]]
 
-    // CHECK:       llvm.call @__catalyst__qis__Gradient([[C2]], [[GRAD1]], [[GRAD2]])
+    // CHECK:       llvm.call @__catalyst__qis__Gradient_array([[C2]], [[GRADS]])
     // CHECK:       quantum.dealloc [[QREG]]
     %alloc0 = memref.alloc(%arg1) : memref<?xf64>
     %alloc1 = memref.alloc(%arg1) : memref<?xf64>
@@ -45,3 +55,22 @@ func.func @adjoint(%arg0: f32, %arg1 : index) -> (memref<?xf64>, memref<?xf64>)
 
     return %alloc0, %alloc1 : memref<?xf64>, memref<?xf64>
 }
+
+// -----
+
+func.func private @circuit.nodealloc(%arg0: f32) -> (!quantum.reg)
+
+// CHECK-LABEL: func.func @adjoint_loop
+func.func @adjoint_loop(%arg0: f32, %arg1 : index, %arg2 : memref<?xf64>) {
+    // CHECK:       [[MEMREFS:%.+]] = llvm.alloca {{%.+}} x !llvm.struct
+    // CHECK:       [[GRADS:%.+]] = llvm.alloca {{%.+}} x !llvm.ptr
+    // CHECK:       scf.for
+    // CHECK-NOT:   llvm.alloca
+    // CHECK:       llvm.call @__catalyst__qis__Gradient_array({{%.+}}, [[GRADS]])
+    %c0 = arith.constant 0 : index
+    %c1 = arith.constant 1 : index
+    scf.for %i = %c0 to %arg1 step %c1 {
+        gradient.adjoint @circuit.nodealloc(%arg0) size(%arg1) in(%arg2 : memref<?xf64>) : (f32) -> ()
+    }
+    return
+}
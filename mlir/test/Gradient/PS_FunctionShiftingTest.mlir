@@ -16,6 +16,7 @@
 
 // CHECK-LABEL: @simple_circuit.shifted(%arg0: tensor<3xf64>, %arg1: tensor<4xf64>, %arg2: tensor<0xindex>) -> f64
 func.func @simple_circuit(%arg0: tensor<3xf64>) -> f64 attributes {qnode, diff_method = "parameter-shift"} {
+    // CHECK-DAG: [[zero:%.+]] = arith.constant 0.000000e+00 : f64
     %c0 = arith.constant 0 : index
     %c1 = arith.constant 1 : index
     %c2 = arith.constant 2 : index
@@ -33,14 +34,22 @@ func.func @simple_circuit(%arg0: tensor<3xf64>) -> f64 attributes {qnode, diff_m
     %q_1 = quantum.custom "h"() %q_0 : !quantum.bit
     // CHECK-NEXT: [[s0:%.+]] = tensor.extract %arg1
     // CHECK-NEXT: [[r0:%.+]] = arith.addf [[s0]], [[a0]] : f64
+    // CHECK-NEXT: [[d0:%.+]] = arith.cmpf one, [[s0]], [[zero]] : f64
+    // CHECK-NEXT: quantum.checkpoint([[d0]])
     // CHECK-NEXT: [[q1:%.+]] = quantum.custom "rz"([[r0]]) [[q0]]
     %q_2 = quantum.custom "rz"(%f0) %q_1 : !quantum.bit
     // CHECK-NEXT: [[s1:%.+]] = tensor.extract %arg1
     // CHECK-NEXT: [[r1:%.+]] = arith.addf [[s1]], [[a0]] : f64
+    // CHECK-NEXT: [[d1:%.+]] = arith.cmpf one, [[s1]], [[zero]] : f64
     // CHECK-NEXT: [[s2:%.+]] = tensor.extract %arg1
     // CHECK-NEXT: [[r2:%.+]] = arith.addf [[s2]], [[a1]] : f64
+    // CHECK-NEXT: [[d2:%.+]] = arith.cmpf one, [[s2]], [[zero]] : f64
+    // CHECK-NEXT: [[d12:%.+]] = arith.ori [[d1]], [[d2]] : i1
     // CHECK-NEXT: [[s3:%.+]] = tensor.extract %arg1
     // CHECK-NEXT: [[r3:%.+]] = arith.addf [[s3]], [[a2]] : f64
+    // CHECK-NEXT: [[d3:%.+]] = arith.cmpf one, [[s3]], [[zero]] : f64
+    // CHECK-NEXT: [[d123:%.+]] = arith.ori [[d12]], [[d3]] : i1
+    // CHECK-NEXT: quantum.checkpoint([[d123]])
     // CHECK-NEXT: {{%.+}} = quantum.custom "u3"([[r1]], [[r2]], [[r3]]) [[q1]]
     %q_3 = quantum.custom "u3"(%f0, %f1, %f2) %q_2 : !quantum.bit
 
@@ -58,6 +67,7 @@ func.func @gradCall0(%arg0: tensor<3xf64>) -> tensor<3xf64> {
 
 // CHECK-LABEL: @structured_circuit.shifted(%arg0: tensor<1xf64>, %arg1: i1, %arg2: i1, %arg3: tensor<6xf64>, %arg4: tensor<0xindex>) -> f64
 func.func @structured_circuit(%arg0: tensor<1xf64>, %arg1: i1, %arg2: i1) -> f64 attributes {qnode, diff_method = "parameter-shift"} {
+    // CHECK-DAG: [[zero:%.+]] = arith.constant 0.000000e+00 : f64
     %c0 = arith.constant 0 : index
     // CHECK: [[e0:%.+]] = tensor.extract %arg0[%c0] : tensor<1xf64>
     %f0 = tensor.extract %arg0[%c0] : tensor<1xf64>
@@ -69,6 +79,8 @@ func.func @structured_circuit(%arg0: tensor<1xf64>, %arg1: i1, %arg2: i1) -> f64
 
     // CHECK-NEXT: [[s0:%.+]] = tensor.extract %arg3
     // CHECK-NEXT: [[r0:%.+]] = arith.addf [[s0]], [[e0]] : f64
+    // CHECK-NEXT: [[d0:%.+]] = arith.cmpf one, [[s0]], [[zero]] : f64
+    // CHECK-NEXT: quantum.checkpoint([[d0]])
     // CHECK-NEXT: [[q1:%.+]] = quantum.custom "rx"([[r0]]) [[q0]]
     %q_1 = quantum.custom "rx"(%f0) %q_0 : !quantum.bit
 
@@ -76,6 +88,8 @@ func.func @structured_circuit(%arg0: tensor<1xf64>, %arg1: i1, %arg2: i1) -> f64
     %q_2 = scf.if %arg1 -> !quantum.bit {
         // CHECK-NEXT: [[s1:%.+]] = tensor.extract %arg3
         // CHECK-NEXT: [[r1:%.+]] = arith.addf [[s1]], [[e0]] : f64
+        // CHECK-NEXT: [[d1:%.+]] = arith.cmpf one, [[s1]], [[zero]] : f64
+        // CHECK-NEXT: quantum.checkpoint([[d1]])
         // CHECK-NEXT: [[q10:%.+]] = quantum.custom "ry"([[r1]]) [[q1]]
         %q_1_0 = quantum.custom "ry"(%f0) %q_1 : !quantum.bit
 
@@ -83,6 +97,8 @@ func.func @structured_circuit(%arg0: tensor<1xf64>, %arg1: i1, %arg2: i1) -> f64
         %q_1_1 = scf.if %arg2 -> !quantum.bit {
             // CHECK-NEXT: [[s2:%.+]] = tensor.extract %arg3
             // CHECK-NEXT: [[r2:%.+]] = arith.addf [[s2]], [[e0]] : f64
+            // CHECK-NEXT: [[d2:%.+]] = arith.cmpf one, [[s2]], [[zero]] : f64
+            // CHECK-NEXT: quantum.checkpoint([[d2]])
             // CHECK-NEXT: [[q100:%.+]] = quantum.custom "rz"([[r2]]) [[q10]]
             %q_1_0_0 = quantum.custom "rz"(%f0) %q_1_0 : !quantum.bit
             // CHECK: scf.yield [[q100]]
@@ -90,10 +106,14 @@ func.func @structured_circuit(%arg0: tensor<1xf64>, %arg1: i1, %arg2: i1) -> f64
         } else {
             // CHECK: [[s3:%.+]] = tensor.extract %arg3
             // CHECK-NEXT: [[r3:%.+]] = arith.addf [[s3]], [[e0]] : f64
+            // CHECK-NEXT: [[d3:%.+]] = arith.cmpf one, [[s3]], [[zero]] : f64
+            // CHECK-NEXT: quantum.checkpoint([[d3]])
             // CHECK-NEXT: [[q101:%.+]] = quantum.custom "rz"([[r3]]) [[q10]]
             %q_1_0_1 = quantum.custom "rz"(%f0) %q_1_0 : !quantum.bit
             // CHECK-NEXT: [[s4:%.+]] = tensor.extract %arg3
             // CHECK-NEXT: [[r4:%.+]] = arith.addf [[s4]], [[e0]] : f64
+            // CHECK-NEXT: [[d4:%.+]] = arith.cmpf one, [[s4]], [[zero]] : f64
+            // CHECK-NEXT: quantum.checkpoint([[d4]])
             // CHECK-NEXT: [[q102:%.+]] = quantum.custom "rz"([[r4]]) [[q101]]
             %q_1_0_2 = quantum.custom "rz"(%f0) %q_1_0_1 : !quantum.bit
             // CHECK: scf.yield [[q102]]
@@ -112,6 +132,8 @@ func.func @structured_circuit(%arg0: tensor<1xf64>, %arg1: i1, %arg2: i1) -> f64
   ^exit:
     // CHECK: [[s5:%.+]] = tensor.extract %arg3
     // CHECK-NEXT: [[r5:%.+]] = arith.addf [[s5]], [[e0]] : f64
+    // CHECK-NEXT: [[d5:%.+]] = arith.cmpf one, [[s5]], [[zero]] : f64
+    // CHECK-NEXT: quantum.checkpoint([[d5]])
     // CHECK-NEXT: {{%.+}} = quantum.custom "rx"([[r5]]) [[q2]]
     %q_3 = quantum.custom "rx"(%f0) %q_2 : !quantum.bit
 
@@ -131,6 +153,7 @@ func.func @gradCall1(%arg0: tensor<1xf64>, %b0: i1, %b1: i1) -> tensor<1xf64> {
 func.func @loop_circuit(%arg0: tensor<1xf64>) -> f64 attributes {qnode, diff_method = "parameter-shift"} {
     // CHECK-DAG: [[c0:%.+]] = arith.constant 0 : index
     // CHECK-DAG: [[c1:%.+]] = arith.constant 1 : index
+    // CHECK-DAG: [[zero:%.+]] = arith.constant 0.000000e+00 : f64
     %c0 = arith.constant 0 : index
     // CHECK: [[e0:%.+]] = tensor.extract
     %f0 = tensor.extract %arg0[%c0] : tensor<1xf64>
@@ -142,6 +165,8 @@ func.func @loop_circuit(%arg0: tensor<1xf64>) -> f64 attributes {qnode, diff_met
 
     // CHECK-NEXT: [[s0:%.+]] = tensor.extract %arg1
     // CHECK-NEXT: [[r0:%.+]] = arith.addf [[s0]], [[e0]] : f64
+    // CHECK-NEXT: [[d0:%.+]] = arith.cmpf one, [[s0]], [[zero]] : f64
+    // CHECK-NEXT: quantum.checkpoint([[d0]])
     // CHECK-NEXT: [[q1:%.+]] = quantum.custom "rx"([[r0]]) [[q0]]
     %q_1 = quantum.custom "rx"(%f0) %q_0 : !quantum.bit
 
@@ -153,12 +178,15 @@ func.func @loop_circuit(%arg0: tensor<1xf64>) -> f64 attributes {qnode, diff_met
     %q_2 = scf.for %i = %lb to %ub step %st iter_args(%q_1_0 = %q_1) -> !quantum.bit {
         // CHECK: [[sel0:%.+]] = tensor.extract %arg2[[[c0]]]
 
-        // CHECK: [[s1:%.+]] = tensor.extract %arg1
         // CHECK: [[cond1:%.+]] = arith.cmpi eq, [[i]], [[sel0]] : index
+        // CHECK: [[s1:%.+]] = tensor.extract %arg1
         // CHECK: [[r1:%.+]] = scf.if [[cond1]] -> (f64)
         // CHECK-NEXT: [[tmp:%.+]] = arith.addf [[s1]], [[e0]] : f64
         // CHECK-NEXT: scf.yield [[tmp]] : f64
         // CHECK: scf.yield [[e0]] : f64
+        // CHECK: [[d1:%.+]] = arith.cmpf one, [[s1]], [[zero]] : f64
+        // CHECK: [[dc1:%.+]] = arith.andi [[cond1]], [[d1]] : i1
+        // CHECK: quantum.checkpoint([[dc1]])
         // CHECK: [[q11:%.+]] = quantum.custom "ry"([[r1]]) [[q10]]
         %q_1_1 = quantum.custom "ry"(%f0) %q_1_0 : !quantum.bit
 
@@ -170,12 +198,15 @@ func.func @loop_circuit(%arg0: tensor<1xf64>) -> f64 attributes {qnode, diff_met
     %q_3 = scf.for %j = %lb to %ub step %st iter_args(%q_2_0 = %q_2) -> !quantum.bit {
         // CHECK: [[sel1:%.+]] = tensor.extract %arg2[[[c0]]]
 
-        // CHECK: [[s2:%.+]] = tensor.extract %arg1
         // CHECK: [[cond2:%.+]] = arith.cmpi eq, [[j]], [[sel1]] : index
+        // CHECK: [[s2:%.+]] = tensor.extract %arg1
         // CHECK: [[r2:%.+]] = scf.if [[cond2]] -> (f64)
         // CHECK-NEXT: [[tmp:%.+]] = arith.addf [[s2]], [[e0]] : f64
         // CHECK-NEXT: scf.yield [[tmp]] : f64
         // CHECK: scf.yield [[e0]] : f64
+        // CHECK: [[d2:%.+]] = arith.cmpf one, [[s2]], [[zero]] : f64
+        // CHECK: [[dc2:%.+]] = arith.andi [[cond2]], [[d2]] : i1
+        // CHECK: quantum.checkpoint([[dc2]])
         // CHECK: [[q21:%.+]] = quantum.custom "ry"([[r2]]) [[q20]]
         %q_2_1 = quantum.custom "ry"(%f0) %q_2_0 : !quantum.bit
 
@@ -183,14 +214,17 @@ func.func @loop_circuit(%arg0: tensor<1xf64>) -> f64 attributes {qnode, diff_met
         %q_1_1 = scf.for %k = %j to %ub step %st iter_args(%q_2_1_0 = %q_2_1) -> !quantum.bit {
             // CHECK: [[sel2:%.+]] = tensor.extract %arg2[[[c1]]]
 
-            // CHECK: [[s3:%.+]] = tensor.extract %arg1
             // CHECK: [[cond3:%.+]] = arith.cmpi eq, [[j]], [[sel1]] : index
             // CHECK: [[cond4:%.+]] = arith.cmpi eq, [[k]], [[sel2]] : index
             // CHECK: [[cond5:%.+]] = arith.andi [[cond3]], [[cond4]] : i1
+            // CHECK: [[s3:%.+]] = tensor.extract %arg1
             // CHECK: [[r3:%.+]] = scf.if [[cond5]] -> (f64)
             // CHECK-NEXT: [[tmp:%.+]] = arith.addf [[s3]], [[e0]] : f64
             // CHECK-NEXT: scf.yield [[tmp]] : f64
             // CHECK: scf.yield [[e0]] : f64
+            // CHECK: [[d3:%.+]] = arith.cmpf one, [[s3]], [[zero]] : f64
+            // CHECK: [[dc3:%.+]] = arith.andi [[cond5]], [[d3]] : i1
+            // CHECK: quantum.checkpoint([[dc3]])
             // CHECK: [[q211:%.+]] = quantum.custom "rz"([[r3]]) [[q210]]
             %q_2_1_1 = quantum.custom "rz"(%f0) %q_2_1_0 : !quantum.bit
 
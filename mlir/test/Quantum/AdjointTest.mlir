@@ -122,10 +122,14 @@ func.func @workflow_unhandled() {
 func.func private @qubit_unitary_test(%arg0: tensor<4x4xcomplex<f64>>) -> tensor<4xcomplex<f64>> {
     quantum.device ["rtd_lightning.so", "LightningQubit", "{shots: 0}"]
     %0 = quantum.alloc( 2) : !quantum.reg
+    %lb = arith.constant 0 : index
+    %ub = arith.constant 1 : index
     %1 = quantum.adjoint(%0) : !quantum.reg {
     ^bb0(%arg1: !quantum.reg):
-      %6 = quantum.extract %arg1[ 0] : !quantum.reg -> !quantum.bit
-      %7 = quantum.extract %arg1[ 1] : !quantum.reg -> !quantum.bit
+     // The loop-carried matrix cannot be recomputed and needs to be cached.
+     %r:2 = scf.for %i = %lb to %ub step %ub iter_args(%r0 = %arg1, %m = %arg0) -> (!quantum.reg, tensor<4x4xcomplex<f64>>) {
+      %6 = quantum.extract %r0[ 0] : !quantum.reg -> !quantum.bit
+      %7 = quantum.extract %r0[ 1] : !quantum.reg -> !quantum.bit
 
       // CHECK-DAG: [[idx0:%.+]] = index.constant 0
       // CHECK-DAG: [[idx1:%.+]] = index.constant 1
@@ -138,7 +142,7 @@ func.func private @qubit_unitary_test(%arg0: tensor<4x4xcomplex<f64>>) -> tensor
       // CHECK:     catalyst.list_push [[real]]
       // CHECK:     catalyst.list_push [[imag]]
 
-      %8:2 = quantum.unitary(%arg0 : tensor<4x4xcomplex<f64>>) %6, %7 : !quantum.bit, !quantum.bit
+      %8:2 = quantum.unitary(%m : tensor<4x4xcomplex<f64>>) %6, %7 : !quantum.bit, !quantum.bit
 
       // CHECK-DAG: [[result:%.+]] = tensor.empty
       // CHECK: scf.for [[k:%.+]] = [[idx0]] to [[idxN]] step [[idx1]] iter_args([[curr_k:%.+]] = [[result]])
@@ -156,9 +160,11 @@ func.func private @qubit_unitary_test(%arg0: tensor<4x4xcomplex<f64>>) -> tensor
       // CHECK:   scf.yield [[last_tensor]]
 
 
-      %9 = quantum.insert %arg1[ 0], %8#0 : !quantum.reg, !quantum.bit
+      %9 = quantum.insert %r0[ 0], %8#0 : !quantum.reg, !quantum.bit
       %10 = quantum.insert %9[ 1], %8#1 : !quantum.reg, !quantum.bit
-      quantum.yield %10 : !quantum.reg
+      scf.yield %10, %m : !quantum.reg, tensor<4x4xcomplex<f64>>
+     }
+     quantum.yield %r#0 : !quantum.reg
     }
     %2 = quantum.extract %1[ 0] : !quantum.reg -> !quantum.bit
     %3 = quantum.extract %1[ 1] : !quantum.reg -> !quantum.bit
@@ -236,25 +242,70 @@ func.func private @param_ordering(%0: !quantum.reg) -> !quantum.reg {
   %c1 = arith.constant 0.1 : f64
   %c2 = arith.constant 0.2 : f64
   %c3 = arith.constant 0.3 : f64
+  %lb = arith.constant 0 : index
+  %ub = arith.constant 1 : index
 
-  // CHECK:     catalyst.list_push [[C1]]
-  // CHECK:     catalyst.list_push [[C2]]
-  // CHECK:     catalyst.list_push [[C3]]
+  // CHECK:     scf.for {{.*}} iter_args([[X1:%.+]] = [[C1]], [[X2:%.+]] = [[C2]], [[X3:%.+]] = [[C3]])
+  // CHECK:       catalyst.list_push [[X1]]
+  // CHECK:       catalyst.list_push [[X2]]
+  // CHECK:       catalyst.list_push [[X3]]
 
   // CHECK-NOT: quantum.adjoint
   %1 = quantum.adjoint(%0) : !quantum.reg {
   ^bb0(%r0: !quantum.reg):
-    %q0 = quantum.extract %r0[ 0] : !quantum.reg -> !quantum.bit
+    // Loop-carried parameters cannot be recomputed and need to be cached.
+    %loop:4 = scf.for %i = %lb to %ub step %ub iter_args(%r = %r0, %a = %c1, %b = %c2, %c = %c3)
+        -> (!quantum.reg, f64, f64, f64) {
+      %q0 = quantum.extract %r[ 0] : !quantum.reg -> !quantum.bit
 
-    // CHECK:   [[A3:%.+]] = catalyst.list_pop
-    // CHECK:   [[A2:%.+]] = catalyst.list_pop
-    // CHECK:   [[A1:%.+]] = catalyst.list_pop
-    // CHECK:   quantum.custom "Rot"([[A1]], [[A2]], [[A3]])
-    %q1 = quantum.custom "Rot"(%c1, %c2, %c3) %q0 : !quantum.bit
+      // CHECK:   [[A3:%.+]] = catalyst.list_pop
+      // CHECK:   [[A2:%.+]] = catalyst.list_pop
+      // CHECK:   [[A1:%.+]] = catalyst.list_pop
+      // CHECK:   quantum.custom "Rot"([[A1]], [[A2]], [[A3]])
+      %q1 = quantum.custom "Rot"(%a, %b, %c) %q0 : !quantum.bit
 
-    %r1 = quantum.insert %r0[ 0], %q1 : !quantum.reg, !quantum.bit
-    quantum.yield %r1 : !quantum.reg
+      %r1 = quantum.insert %r[ 0], %q1 : !quantum.reg, !quantum.bit
+      scf.yield %r1, %a, %b, %c : !quantum.reg, f64, f64, f64
+    }
+    quantum.yield %loop#0 : !quantum.reg
+  }
+
+  return %1 : !quantum.reg
+}
+
+// -----
+
+// CHECK-LABEL: @recompute_params
+func.func private @recompute_params(%0: !quantum.reg, %theta: f64) -> !quantum.reg {
+  %lb = arith.constant 0 : index
+  %ub = arith.constant 4 : index
+  %step = arith.constant 1 : index
+
+  // CHECK-NOT: catalyst.list_init
+  %1 = quantum.adjoint(%0) : !quantum.reg {
+  ^bb0(%r0: !quantum.reg):
+    // Parameters and wires computed from the induction variable are recomputed by iterating over
+    // the induction variables in reverse.
+    // CHECK:     scf.for [[iv:%.+]] = {{.*}} iter_args
+    // CHECK:       [[reversed:%.+]] = index.sub {{%.+}}, [[iv]]
+    // CHECK:       [[wire:%.+]] = arith.index_cast [[reversed]] : index to i64
+    // CHECK:       quantum.extract {{%.+}}[[[wire]]]
+    // CHECK:       [[float:%.+]] = arith.sitofp [[wire]] : i64 to f64
+    // CHECK:       [[angle:%.+]] = arith.mulf %arg1, [[float]]
+    // CHECK:       quantum.custom "RX"([[angle]]) {{%.+}} {adjoint}
+    // CHECK:       quantum.insert {{%.+}}[[[wire]]]
+    %loop = scf.for %i = %lb to %ub step %step iter_args(%r = %r0) -> !quantum.reg {
+      %wire = arith.index_cast %i : index to i64
+      %float = arith.sitofp %wire : i64 to f64
+      %angle = arith.mulf %theta, %float : f64
+      %q0 = quantum.extract %r[%wire] : !quantum.reg -> !quantum.bit
+      %q1 = quantum.custom "RX"(%angle) %q0 : !quantum.bit
+      %r1 = quantum.insert %r[%wire], %q1 : !quantum.reg, !quantum.bit
+      scf.yield %r1 : !quantum.reg
+    }
+    quantum.yield %loop : !quantum.reg
   }
+  // CHECK-NOT: catalyst.list_
 
   return %1 : !quantum.reg
 }
@@ -26,6 +26,17 @@ func.func @counts(%q0: !quantum.bit, %q1: !quantum.bit) -> (tensor<4xf64>, tenso
 
 // -----
 
+func.func @sparse_counts(%q0: !quantum.bit, %q1: !quantum.bit) -> (tensor<10xf64>, tensor<10xi64>) {
+    %obs = quantum.compbasis %q0, %q1 : !quantum.obs
+    // CHECK: [[eigvals:%.+]] = memref.alloc() : memref<10xf64>
+    // CHECK: [[counts:%.+]] = memref.alloc() : memref<10xi64>
+    // CHECK: quantum.counts {{.*}} in([[eigvals]] : memref<10xf64>, [[counts]] : memref<10xi64>) {shots = 10 : i64, sparse}
+    %samples:2 = quantum.counts %obs {shots=10, sparse} : tensor<10xf64>, tensor<10xi64>
+    func.return %samples#0, %samples#1 : tensor<10xf64>, tensor<10xi64>
+}
+
+// -----
+
 func.func @sample(%q0: !quantum.bit, %q1: !quantum.bit) {
     %obs = quantum.compbasis %q0, %q1 : !quantum.obs
     // CHECK: quantum.sample {{.*}} : memref<1000x2xf64>
@@ -35,6 +46,24 @@ func.func @sample(%q0: !quantum.bit, %q1: !quantum.bit) {
 
 // -----
 
+func.func @packed_sample(%q0: !quantum.bit, %q1: !quantum.bit) {
+    %obs = quantum.compbasis %q0, %q1 : !quantum.obs
+    // CHECK: quantum.sample {{.*}} : memref<1000xi64>
+    %samples = quantum.sample %obs {shots=1000} : tensor<1000xi64>
+    func.return
+}
+
+// -----
+
+func.func @shadow(%q0: !quantum.bit, %q1: !quantum.bit) {
+    %obs = quantum.compbasis %q0, %q1 : !quantum.obs
+    // CHECK: quantum.shadow {{.*}} : memref<1000x2xi64>
+    %records = quantum.shadow %obs {shots=1000} : tensor<1000x2xi64>
+    func.return
+}
+
+// -----
+
 func.func @probs(%q0: !quantum.bit, %q1: !quantum.bit) {
     %obs = quantum.compbasis %q0, %q1 : !quantum.obs
     // CHECK: [[alloc:%.+]] = memref.alloc() : memref<4xf64>
@@ -52,3 +81,25 @@ func.func @state(%q0: !quantum.bit, %q1: !quantum.bit) {
     %state = quantum.state %obs : tensor<4xcomplex<f64>>
     func.return
 }
+
+// -----
+
+///////////////////////
+// State preparation //
+///////////////////////
+
+func.func @set_state(%q0: !quantum.bit, %q1: !quantum.bit, %state: tensor<4xcomplex<f64>>) {
+    // CHECK: [[state:%.+]] = bufferization.to_memref %arg2 : memref<4xcomplex<f64>>
+    // CHECK: quantum.set_state([[state]] : memref<4xcomplex<f64>>) %arg0, %arg1
+    %out:2 = quantum.set_state(%state : tensor<4xcomplex<f64>>) %q0, %q1 : !quantum.bit, !quantum.bit
+    func.return
+}
+
+// -----
+
+func.func @set_basis_state(%q0: !quantum.bit, %q1: !quantum.bit, %bits: tensor<2xi1>) {
+    // CHECK: [[bits:%.+]] = bufferization.to_memref %arg2 : memref<2xi1>
+    // CHECK: quantum.set_basis_state([[bits]] : memref<2xi1>) %arg0, %arg1
+    %out:2 = quantum.set_basis_state(%bits : tensor<2xi1>) %q0, %q1 : !quantum.bit, !quantum.bit
+    func.return
+}
@@ -21,10 +21,10 @@ func.func @test_alloc_dce() {
     return
 }
 
-// CHECK-LABEL: test_alloc_cse
-func.func @test_alloc_cse() -> (!quantum.reg, !quantum.reg){
+// CHECK-LABEL: test_alloc_no_cse
+func.func @test_alloc_no_cse() -> (!quantum.reg, !quantum.reg){
+    // CHECK: quantum.alloc
     // CHECK: quantum.alloc
-    // CHECK-NOT: quantum.alloc
     %r1 = quantum.alloc(4) : !quantum.reg
     %r2 = quantum.alloc(4) : !quantum.reg
     return %r1, %r2 : !quantum.reg, !quantum.reg
@@ -118,3 +118,42 @@ func.func @test_insert_canonicalize(%r1: !quantum.reg, %i: i64) -> !quantum.bit
     quantum.dealloc %r2 : !quantum.reg
     return %4 : !quantum.bit
 }
+
+// CHECK-LABEL: test_expval_var_fusion
+func.func @test_expval_var_fusion(%q: !quantum.bit) -> (tensor<f64>, tensor<f64>) {
+    // CHECK: [[obs:%.+]] = quantum.namedobs
+    // CHECK: [[expval:%.+]], [[var:%.+]] = quantum.expval_var [[obs]] : f64, f64
+    // CHECK-NOT: quantum.expval
+    // CHECK-NOT: quantum.var
+    // CHECK: tensor.from_elements [[expval]]
+    // CHECK: tensor.from_elements [[var]]
+    %obs = quantum.namedobs %q[PauliZ] : !quantum.obs
+    %expval = quantum.expval %obs : f64
+    %t0 = tensor.from_elements %expval : tensor<f64>
+    %var = quantum.var %obs : f64
+    %t1 = tensor.from_elements %var : tensor<f64>
+    return %t0, %t1 : tensor<f64>, tensor<f64>
+}
+
+// CHECK-LABEL: test_var_expval_fusion
+func.func @test_var_expval_fusion(%q: !quantum.bit) -> (f64, f64) {
+    // CHECK: [[expval:%.+]], [[var:%.+]] = quantum.expval_var
+    // CHECK: return [[expval]], [[var]]
+    %obs = quantum.namedobs %q[PauliX] : !quantum.obs
+    %var = quantum.var %obs : f64
+    %expval = quantum.expval %obs : f64
+    return %expval, %var : f64, f64
+}
+
+// CHECK-LABEL: test_expval_var_no_fusion
+func.func @test_expval_var_no_fusion(%q: !quantum.bit, %p: !quantum.bit) -> (f64, f64, i1) {
+    // CHECK-NOT: quantum.expval_var
+    // CHECK: quantum.expval
+    // CHECK: quantum.measure
+    // CHECK: quantum.var
+    %obs = quantum.namedobs %q[PauliZ] : !quantum.obs
+    %expval = quantum.expval %obs : f64
+    %m, %p2 = quantum.measure %p : i1, !quantum.bit
+    %var = quantum.var %obs : f64
+    return %expval, %var, %m : f64, f64, i1
+}
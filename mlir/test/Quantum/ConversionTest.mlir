@@ -78,6 +78,39 @@ func.func @device() {
 
 // -----
 
+// CHECK-DAG: llvm.func @__catalyst__rt__batch_begin(i64)
+// CHECK-DAG: llvm.func @__catalyst__rt__batch_lane(i64)
+// CHECK-DAG: llvm.func @__catalyst__rt__batch_execute()
+// CHECK-DAG: llvm.func @__catalyst__rt__batch_end()
+
+// CHECK-LABEL: @batch
+func.func @batch(%size : i64, %lane : i64) {
+    // CHECK: llvm.call @__catalyst__rt__batch_begin(%arg0) : (i64) -> ()
+    quantum.batch_begin(%size)
+    // CHECK: llvm.call @__catalyst__rt__batch_lane(%arg1) : (i64) -> ()
+    quantum.batch_lane(%lane)
+    // CHECK: llvm.call @__catalyst__rt__batch_execute() : () -> ()
+    quantum.batch_execute
+    // CHECK: llvm.call @__catalyst__rt__batch_end() : () -> ()
+    quantum.batch_end
+
+    return
+}
+
+// -----
+
+// CHECK: llvm.func @__catalyst__rt__checkpoint(i1)
+
+// CHECK-LABEL: @checkpoint
+func.func @checkpoint(%diverges : i1) {
+    // CHECK: llvm.call @__catalyst__rt__checkpoint(%arg0) : (i1) -> ()
+    quantum.checkpoint(%diverges)
+
+    return
+}
+
+// -----
+
 ///////////////////////
 // Memory Management //
 ///////////////////////
@@ -112,17 +145,19 @@ func.func @dealloc(%r : !quantum.reg) {
 
 // -----
 
-// CHECK: llvm.func @__catalyst__rt__array_get_element_ptr_1d(!llvm.ptr, i64) -> !llvm.ptr
+// CHECK-NOT: __catalyst__rt__array_get_element_ptr_1d
 
 // CHECK-LABEL: @extract
 func.func @extract(%r : !quantum.reg, %c : i64) {
 
-    // CHECK: [[qb_ptr:%.+]] = llvm.call @__catalyst__rt__array_get_element_ptr_1d(%arg0, %arg1) : (!llvm.ptr, i64) -> !llvm.ptr
+    // CHECK: [[data:%.+]] = llvm.load %arg0 : !llvm.ptr -> !llvm.ptr
+    // CHECK: [[qb_ptr:%.+]] = llvm.getelementptr inbounds [[data]][%arg1] : (!llvm.ptr, i64) -> !llvm.ptr, !llvm.ptr
     // CHECK: llvm.load [[qb_ptr]] : !llvm.ptr -> !llvm.ptr
     quantum.extract %r[%c] : !quantum.reg -> !quantum.bit
 
     // CHECK: [[c5:%.+]] = llvm.mlir.constant(5 : i64)
-    // CHECK: [[qb_ptr:%.+]] = llvm.call @__catalyst__rt__array_get_element_ptr_1d(%arg0, [[c5]]) : (!llvm.ptr, i64) -> !llvm.ptr
+    // CHECK: [[data:%.+]] = llvm.load %arg0 : !llvm.ptr -> !llvm.ptr
+    // CHECK: [[qb_ptr:%.+]] = llvm.getelementptr inbounds [[data]]{{\[}}[[c5]]{{\]}} : (!llvm.ptr, i64) -> !llvm.ptr, !llvm.ptr
     // CHECK: llvm.load [[qb_ptr]] : !llvm.ptr -> !llvm.ptr
 
     quantum.extract %r[5] : !quantum.reg -> !quantum.bit
@@ -152,6 +187,7 @@ func.func @insert(%r : !quantum.reg, %q : !quantum.bit) -> !quantum.reg {
 // CHECK-DAG: llvm.func @__catalyst__qis__SWAP(!llvm.ptr, !llvm.ptr, !llvm.ptr)
 // CHECK-DAG: llvm.func @__catalyst__qis__CRot(f64, f64, f64, !llvm.ptr, !llvm.ptr, !llvm.ptr)
 // CHECK-DAG: llvm.func @__catalyst__qis__Toffoli(!llvm.ptr, !llvm.ptr, !llvm.ptr, !llvm.ptr)
+// CHECK-DAG: llvm.mlir.global internal constant @__catalyst__modifiers_adjoint() {{.*}} : !llvm.struct<(i1, i64, ptr, ptr)>
 
 // CHECK-LABEL: @custom_gate
 func.func @custom_gate(%q0 : !quantum.bit, %p : f64) -> (!quantum.bit, !quantum.bit, !quantum.bit) {
@@ -176,20 +212,9 @@ func.func @custom_gate(%q0 : !quantum.bit, %p : f64) -> (!quantum.bit, !quantum.
     // CHECK: llvm.call @__catalyst__qis__Toffoli(%arg0, %arg0, %arg0, [[p]])
     %q5:3 = quantum.custom "Toffoli"() %q4#0, %q4#1, %q4#1 : !quantum.bit, !quantum.bit, !quantum.bit
 
-    // CHECK: [[one:%.+]] = llvm.mlir.constant(1 : i64) : i64
-    // CHECK: [[nullPtr:%.+]] = llvm.mlir.zero : !llvm.ptr
-    // CHECK: [[true:%.+]] = llvm.mlir.constant(true) : i1
-    // CHECK: [[zero:%.+]] = llvm.mlir.constant(0 : i64) : i64
-    // CHECK: [[struct:%.+]] = llvm.alloca [[one]] x !llvm.struct<(i1, i64, ptr, ptr)> : (i64) -> !llvm.ptr
-    // CHECK: [[bool:%.+]] = llvm.getelementptr inbounds [[struct]][0, 0] : (!llvm.ptr) -> !llvm.ptr, !llvm.struct<(i1, i64, ptr, ptr)>
-    // CHECK: [[integer:%.+]] = llvm.getelementptr inbounds [[struct]][0, 1] : (!llvm.ptr) -> !llvm.ptr, !llvm.struct<(i1, i64, ptr, ptr)>
-    // CHECK: [[ptr1:%.+]] = llvm.getelementptr inbounds [[struct]][0, 2] : (!llvm.ptr) -> !llvm.ptr, !llvm.struct<(i1, i64, ptr, ptr)>
-    // CHECK: [[ptr2:%.+]] = llvm.getelementptr inbounds [[struct]][0, 3] : (!llvm.ptr) -> !llvm.ptr, !llvm.struct<(i1, i64, ptr, ptr)>
-    // CHECK: llvm.store [[true]], [[bool]] : i1, !llvm.ptr
-    // CHECK: llvm.store [[zero]], [[integer]] : i64, !llvm.ptr
-    // CHECK: llvm.store [[nullPtr]], [[ptr1]] : !llvm.ptr, !llvm.ptr
-    // CHECK: llvm.store [[nullPtr]], [[ptr2]] : !llvm.ptr, !llvm.ptr
-    // CHECK: llvm.call @__catalyst__qis__RX(%arg1, %arg0, [[struct]])
+    // CHECK: [[mod:%.+]] = llvm.mlir.addressof @__catalyst__modifiers_adjoint : !llvm.ptr
+    // CHECK-NOT: llvm.alloca
+    // CHECK: llvm.call @__catalyst__qis__RX(%arg1, %arg0, [[mod]])
     %q6 = quantum.custom "RX"(%p) %q5#0 { adjoint } : !quantum.bit
 
     // CHECK: [[p:%.+]] = llvm.mlir.zero : !llvm.ptr
@@ -205,24 +230,39 @@ func.func @custom_gate(%q0 : !quantum.bit, %p : f64) -> (!quantum.bit, !quantum.
 
 // -----
 
-// CHECK: llvm.func @__catalyst__qis__MultiRZ(f64, !llvm.ptr, i64, ...)
+// CHECK: llvm.func @__catalyst__qis__MultiRZ_array(f64, !llvm.ptr, i64, !llvm.ptr)
 
 // CHECK-LABEL: @multirz
 func.func @multirz(%q0 : !quantum.bit, %p : f64) -> (!quantum.bit, !quantum.bit, !quantum.bit) {
 
+    // The qubit arrays are allocated once at the top of the function.
+    // CHECK: [[n3:%.+]] = llvm.mlir.constant(3 : i64)
+    // CHECK: [[qs3:%.+]] = llvm.alloca [[n3]] x !llvm.ptr
+    // CHECK: [[n2:%.+]] = llvm.mlir.constant(2 : i64)
+    // CHECK: [[qs2:%.+]] = llvm.alloca [[n2]] x !llvm.ptr
+    // CHECK: [[n1:%.+]] = llvm.mlir.constant(1 : i64)
+    // CHECK: [[qs1:%.+]] = llvm.alloca [[n1]] x !llvm.ptr
+
     // CHECK: [[p:%.+]] = llvm.mlir.zero : !llvm.ptr
     // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
-    // CHECK: llvm.call @__catalyst__qis__MultiRZ(%arg1, [[p]], [[c1]], %arg0)
+    // CHECK: [[e0:%.+]] = llvm.getelementptr inbounds [[qs1]][0]
+    // CHECK: llvm.store %arg0, [[e0]]
+    // CHECK: llvm.call @__catalyst__qis__MultiRZ_array(%arg1, [[p]], [[c1]], [[qs1]])
     %q1 = quantum.multirz(%p) %q0 : !quantum.bit
 
     // CHECK: [[p:%.+]] = llvm.mlir.zero : !llvm.ptr
     // CHECK: [[c2:%.+]] = llvm.mlir.constant(2 : i64)
-    // CHECK: llvm.call @__catalyst__qis__MultiRZ(%arg1, [[p]], [[c2]], %arg0, %arg0)
+    // CHECK: [[e0:%.+]] = llvm.getelementptr inbounds [[qs2]][0]
+    // CHECK: llvm.store %arg0, [[e0]]
+    // CHECK: [[e1:%.+]] = llvm.getelementptr inbounds [[qs2]][1]
+    // CHECK: llvm.store %arg0, [[e1]]
+    // CHECK: llvm.call @__catalyst__qis__MultiRZ_array(%arg1, [[p]], [[c2]], [[qs2]])
     %q2:2 = quantum.multirz(%p) %q1, %q1 : !quantum.bit, !quantum.bit
 
     // CHECK: [[p:%.+]] = llvm.mlir.zero : !llvm.ptr
     // CHECK: [[c3:%.+]] = llvm.mlir.constant(3 : i64)
-    // CHECK: llvm.call @__catalyst__qis__MultiRZ(%arg1, [[p]], [[c3]], %arg0, %arg0, %arg0)
+    // CHECK-COUNT-3: llvm.store %arg0
+    // CHECK: llvm.call @__catalyst__qis__MultiRZ_array(%arg1, [[p]], [[c3]], [[qs3]])
     %q3:3 = quantum.multirz(%p) %q2#0, %q2#1, %q2#1 : !quantum.bit, !quantum.bit, !quantum.bit
 
     // CHECK: [[st1:%.+]] = llvm.insertvalue %arg0
@@ -234,10 +274,69 @@ func.func @multirz(%q0 : !quantum.bit, %p : f64) -> (!quantum.bit, !quantum.bit,
 
 // -----
 
-// CHECK: llvm.func @__catalyst__qis__QubitUnitary(!llvm.ptr, !llvm.ptr, i64, ...)
+// CHECK-DAG: llvm.func @__catalyst__qis__PauliRot(f64, !llvm.ptr, !llvm.ptr, i64, !llvm.ptr)
+// CHECK-DAG: llvm.mlir.global internal constant @__catalyst__pauli_word_XZ("XZ\00")
+
+// CHECK-LABEL: @paulirot
+func.func @paulirot(%q0 : !quantum.bit, %q1 : !quantum.bit, %p : f64) -> (!quantum.bit, !quantum.bit) {
+    // CHECK: [[n2:%.+]] = llvm.mlir.constant(2 : i64)
+    // CHECK: [[qs2:%.+]] = llvm.alloca [[n2]] x !llvm.ptr
+
+    // CHECK: [[p:%.+]] = llvm.mlir.zero : !llvm.ptr
+    // CHECK: [[w:%.+]] = llvm.mlir.addressof @__catalyst__pauli_word_XZ
+    // CHECK: [[word:%.+]] = llvm.getelementptr inbounds [[w]][0, 0]
+    // CHECK: [[c2:%.+]] = llvm.mlir.constant(2 : i64)
+    // CHECK: [[e0:%.+]] = llvm.getelementptr inbounds [[qs2]][0]
+    // CHECK: llvm.store %arg0, [[e0]]
+    // CHECK: [[e1:%.+]] = llvm.getelementptr inbounds [[qs2]][1]
+    // CHECK: llvm.store %arg1, [[e1]]
+    // CHECK: llvm.call @__catalyst__qis__PauliRot(%arg2, [[word]], [[p]], [[c2]], [[qs2]])
+    %q2:2 = quantum.paulirot "XZ"(%p) %q0, %q1 : !quantum.bit, !quantum.bit
+
+    // CHECK: [[st1:%.+]] = llvm.insertvalue %arg0
+    // CHECK: [[st2:%.+]] = llvm.insertvalue %arg1, [[st1]]
+    // CHECK: return [[st2]]
+    return %q2#0, %q2#1 : !quantum.bit, !quantum.bit
+}
+
+// -----
+
+// CHECK-DAG: llvm.func @__catalyst__qis__QFT(!llvm.ptr, i64, !llvm.ptr)
+// CHECK-DAG: llvm.mlir.global internal constant @__catalyst__modifiers_adjoint()
+
+// CHECK-LABEL: @qft
+func.func @qft(%q0 : !quantum.bit, %q1 : !quantum.bit) -> (!quantum.bit, !quantum.bit) {
+    // CHECK: [[n2:%.+]] = llvm.mlir.constant(2 : i64)
+    // CHECK: [[qs2:%.+]] = llvm.alloca [[n2]] x !llvm.ptr
+
+    // CHECK: [[p:%.+]] = llvm.mlir.zero : !llvm.ptr
+    // CHECK: [[c2:%.+]] = llvm.mlir.constant(2 : i64)
+    // CHECK: [[e0:%.+]] = llvm.getelementptr inbounds [[qs2]][0]
+    // CHECK: llvm.store %arg0, [[e0]]
+    // CHECK: [[e1:%.+]] = llvm.getelementptr inbounds [[qs2]][1]
+    // CHECK: llvm.store %arg1, [[e1]]
+    // CHECK: llvm.call @__catalyst__qis__QFT([[p]], [[c2]], [[qs2]])
+    %q2:2 = quantum.qft %q0, %q1 : !quantum.bit, !quantum.bit
+
+    // CHECK: [[mod:%.+]] = llvm.mlir.addressof @__catalyst__modifiers_adjoint : !llvm.ptr
+    // CHECK: llvm.call @__catalyst__qis__QFT([[mod]], {{%.+}}, [[qs2]])
+    %q3:2 = quantum.qft %q2#0, %q2#1 { adjoint } : !quantum.bit, !quantum.bit
+
+    // CHECK: [[st1:%.+]] = llvm.insertvalue %arg0
+    // CHECK: [[st2:%.+]] = llvm.insertvalue %arg1, [[st1]]
+    // CHECK: return [[st2]]
+    return %q3#0, %q3#1 : !quantum.bit, !quantum.bit
+}
+
+// -----
+
+// CHECK: llvm.func @__catalyst__qis__QubitUnitary_array(!llvm.ptr, !llvm.ptr, i64, !llvm.ptr)
 
 // CHECK-LABEL: @qubit_unitary
 func.func @qubit_unitary(%q0 : !quantum.bit, %p1 : memref<2x2xcomplex<f64>>,  %p2 : memref<4x4xcomplex<f64>>) -> (!quantum.bit, !quantum.bit) {
+    // CHECK: [[qs2:%.+]] = llvm.alloca {{%.+}} x !llvm.ptr
+    // CHECK: [[qs1:%.+]] = llvm.alloca {{%.+}} x !llvm.ptr
+
     // Only check the last members of the deconstructed memref struct being inserted.
     // CHECK: [[m1:%.+]] = llvm.insertvalue %arg7
     // CHECK: [[m2:%.+]] = llvm.insertvalue %arg14
@@ -248,7 +347,8 @@ func.func @qubit_unitary(%q0 : !quantum.bit, %p1 : memref<2x2xcomplex<f64>>,  %p
     // CHECK: [[c1_2:%.+]] = llvm.mlir.constant(1 : i64)
     // CHECK: [[buf1:%.+]] = llvm.alloca [[c1_2]] x !llvm.struct<(ptr, ptr, i64, array<2 x i64>, array<2 x i64>)>
     // CHECK: llvm.store [[m1]], [[buf1]]
-    // CHECK: llvm.call @__catalyst__qis__QubitUnitary([[buf1]], [[a]], [[c1_1]], %arg0)
+    // CHECK: llvm.store %arg0
+    // CHECK: llvm.call @__catalyst__qis__QubitUnitary_array([[buf1]], [[a]], [[c1_1]], [[qs1]])
     %q1 = quantum.unitary(%p1 : memref<2x2xcomplex<f64>>) %q0 : !quantum.bit
 
     // CHECK: [[a:%.+]] = llvm.mlir.zero : !llvm.ptr
@@ -256,7 +356,8 @@ func.func @qubit_unitary(%q0 : !quantum.bit, %p1 : memref<2x2xcomplex<f64>>,  %p
     // CHECK: [[c1_2:%.+]] = llvm.mlir.constant(1 : i64)
     // CHECK: [[buf2:%.+]] = llvm.alloca [[c1_2]] x !llvm.struct<(ptr, ptr, i64, array<2 x i64>, array<2 x i64>)>
     // CHECK: llvm.store [[m2]], [[buf2]]
-    // CHECK: llvm.call @__catalyst__qis__QubitUnitary([[buf2]], [[a]], [[c2]], %arg0, %arg0)
+    // CHECK-COUNT-2: llvm.store %arg0
+    // CHECK: llvm.call @__catalyst__qis__QubitUnitary_array([[buf2]], [[a]], [[c2]], [[qs2]])
     %q2:2 = quantum.unitary(%p2 : memref<4x4xcomplex<f64>>) %q1, %q1 : !quantum.bit, !quantum.bit
 
     // CHECK: [[st1:%.+]] = llvm.insertvalue %arg0
@@ -267,6 +368,50 @@ func.func @qubit_unitary(%q0 : !quantum.bit, %p1 : memref<2x2xcomplex<f64>>,  %p
 
 // -----
 
+// CHECK: llvm.func @__catalyst__qis__SetState(!llvm.ptr, i64, !llvm.ptr)
+
+// CHECK-LABEL: @set_state
+func.func @set_state(%q0 : !quantum.bit, %q1 : !quantum.bit, %state : memref<4xcomplex<f64>>) -> (!quantum.bit, !quantum.bit) {
+    // CHECK: [[qs:%.+]] = llvm.alloca {{%.+}} x !llvm.ptr
+    // CHECK: [[st:%.+]] = llvm.insertvalue %arg6
+
+    // CHECK: [[c2:%.+]] = llvm.mlir.constant(2 : i64)
+    // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
+    // CHECK: [[buf:%.+]] = llvm.alloca [[c1]] x !llvm.struct<(ptr, ptr, i64, array<1 x i64>, array<1 x i64>)>
+    // CHECK: llvm.store [[st]], [[buf]]
+    // CHECK: llvm.store %arg0
+    // CHECK: llvm.store %arg1
+    // CHECK: llvm.call @__catalyst__qis__SetState([[buf]], [[c2]], [[qs]])
+    %out:2 = quantum.set_state(%state : memref<4xcomplex<f64>>) %q0, %q1 : !quantum.bit, !quantum.bit
+
+    // CHECK: [[r1:%.+]] = llvm.insertvalue %arg0
+    // CHECK: [[r2:%.+]] = llvm.insertvalue %arg1, [[r1]]
+    // CHECK: return [[r2]]
+    return %out#0, %out#1 : !quantum.bit, !quantum.bit
+}
+
+// -----
+
+// CHECK: llvm.func @__catalyst__qis__SetBasisState(!llvm.ptr, i64, !llvm.ptr)
+
+// CHECK-LABEL: @set_basis_state
+func.func @set_basis_state(%q0 : !quantum.bit, %bits : memref<1xi1>) -> !quantum.bit {
+    // CHECK: [[qs:%.+]] = llvm.alloca {{%.+}} x !llvm.ptr
+    // CHECK: [[st:%.+]] = llvm.insertvalue %arg5
+
+    // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
+    // CHECK: [[c1_1:%.+]] = llvm.mlir.constant(1 : i64)
+    // CHECK: [[buf:%.+]] = llvm.alloca [[c1_1]] x !llvm.struct<(ptr, ptr, i64, array<1 x i64>, array<1 x i64>)>
+    // CHECK: llvm.store [[st]], [[buf]]
+    // CHECK: llvm.store %arg0
+    // CHECK: llvm.call @__catalyst__qis__SetBasisState([[buf]], [[c1]], [[qs]])
+    %out = quantum.set_basis_state(%bits : memref<1xi1>) %q0 : !quantum.bit
+
+    return %out : !quantum.bit
+}
+
+// -----
+
 /////////////////
 // Observables //
 /////////////////
@@ -301,10 +446,13 @@ func.func @namedobs(%q : !quantum.bit) {
 
 // -----
 
-// CHECK: llvm.func @__catalyst__qis__HermitianObs(!llvm.ptr, i64, ...) -> i64
+// CHECK: llvm.func @__catalyst__qis__HermitianObs_array(!llvm.ptr, i64, !llvm.ptr) -> i64
 
 // CHECK-LABEL: @hermitian
 func.func @hermitian(%q : !quantum.bit, %p1 : memref<2x2xcomplex<f64>>, %p2 : memref<4x4xcomplex<f64>>) {
+    // CHECK: [[qs2:%.+]] = llvm.alloca {{%.+}} x !llvm.ptr
+    // CHECK: [[qs1:%.+]] = llvm.alloca {{%.+}} x !llvm.ptr
+
     // Only check the last members of the deconstructed memref struct being inserted.
     // CHECK: [[m1:%.+]] = llvm.insertvalue %arg7
     // CHECK: [[m2:%.+]] = llvm.insertvalue %arg14
@@ -313,13 +461,15 @@ func.func @hermitian(%q : !quantum.bit, %p1 : memref<2x2xcomplex<f64>>, %p2 : me
     // CHECK: [[c1_1:%.+]] = llvm.mlir.constant(1 : i64)
     // CHECK: [[buf1:%.+]] = llvm.alloca [[c1_1]] x !llvm.struct<(ptr, ptr, i64, array<2 x i64>, array<2 x i64>)>
     // CHECK: llvm.store [[m1]], [[buf1]]
-    // CHECK: llvm.call @__catalyst__qis__HermitianObs([[buf1]], [[c1]], %arg0)
+    // CHECK: llvm.store %arg0
+    // CHECK: llvm.call @__catalyst__qis__HermitianObs_array([[buf1]], [[c1]], [[qs1]])
     quantum.hermitian(%p1 : memref<2x2xcomplex<f64>>) %q : !quantum.obs
     // CHECK: [[c2:%.+]] = llvm.mlir.constant(2 : i64)
     // CHECK: [[c1_2:%.+]] = llvm.mlir.constant(1 : i64)
     // CHECK: [[buf2:%.+]] = llvm.alloca [[c1_2]] x !llvm.struct<(ptr, ptr, i64, array<2 x i64>, array<2 x i64>)>
     // CHECK: llvm.store [[m2]], [[buf2]]
-    // CHECK: llvm.call @__catalyst__qis__HermitianObs([[buf2]], [[c2]], %arg0, %arg0)
+    // CHECK-COUNT-2: llvm.store %arg0
+    // CHECK: llvm.call @__catalyst__qis__HermitianObs_array([[buf2]], [[c2]], [[qs2]])
     quantum.hermitian(%p2 : memref<4x4xcomplex<f64>>) %q, %q : !quantum.obs
 
     return
@@ -327,16 +477,20 @@ func.func @hermitian(%q : !quantum.bit, %p1 : memref<2x2xcomplex<f64>>, %p2 : me
 
 // -----
 
-// CHECK: llvm.func @__catalyst__qis__TensorObs(i64, ...) -> i64
+// CHECK: llvm.func @__catalyst__qis__TensorObs_array(i64, !llvm.ptr) -> i64
 
 // CHECK-LABEL: @tensor
 func.func @tensor(%obs : !quantum.obs) {
+    // CHECK: [[obs3:%.+]] = llvm.alloca {{%.+}} x i64
+    // CHECK: [[obs1:%.+]] = llvm.alloca {{%.+}} x i64
 
     // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
-    // CHECK: llvm.call @__catalyst__qis__TensorObs([[c1]], %arg0)
+    // CHECK: llvm.store %arg0
+    // CHECK: llvm.call @__catalyst__qis__TensorObs_array([[c1]], [[obs1]])
     quantum.tensor %obs : !quantum.obs
     // CHECK: [[c3:%.+]] = llvm.mlir.constant(3 : i64)
-    // CHECK: llvm.call @__catalyst__qis__TensorObs([[c3]], %arg0, %arg0, %arg0)
+    // CHECK-COUNT-3: llvm.store %arg0
+    // CHECK: llvm.call @__catalyst__qis__TensorObs_array([[c3]], [[obs3]])
     quantum.tensor %obs, %obs, %obs : !quantum.obs
 
     return
@@ -344,10 +498,13 @@ func.func @tensor(%obs : !quantum.obs) {
 
 // -----
 
-// CHECK: llvm.func @__catalyst__qis__HamiltonianObs(!llvm.ptr, i64, ...) -> i64
+// CHECK: llvm.func @__catalyst__qis__HamiltonianObs_array(!llvm.ptr, i64, !llvm.ptr) -> i64
 
 // CHECK-LABEL: @hamiltonian
 func.func @hamiltonian(%obs : !quantum.obs, %p1 : memref<1xf64>, %p2 : memref<3xf64>) {
+    // CHECK: [[obs3:%.+]] = llvm.alloca {{%.+}} x i64
+    // CHECK: [[obs1:%.+]] = llvm.alloca {{%.+}} x i64
+
     // Only check the last members of the deconstructed memref struct being inserted.
     // CHECK: [[v1:%.+]] = llvm.insertvalue %arg5
     // CHECK: [[v2:%.+]] = llvm.insertvalue %arg10
@@ -356,13 +513,15 @@ func.func @hamiltonian(%obs : !quantum.obs, %p1 : memref<1xf64>, %p2 : memref<3x
     // CHECK: [[c1_1:%.+]] = llvm.mlir.constant(1 : i64)
     // CHECK: [[buf1:%.+]] = llvm.alloca [[c1_1]] x !llvm.struct<(ptr, ptr, i64, array<1 x i64>, array<1 x i64>)>
     // CHECK: llvm.store [[v1]], [[buf1]]
-    // CHECK: llvm.call @__catalyst__qis__HamiltonianObs([[buf1]], [[c1]], %arg0)
+    // CHECK: llvm.store %arg0
+    // CHECK: llvm.call @__catalyst__qis__HamiltonianObs_array([[buf1]], [[c1]], [[obs1]])
     quantum.hamiltonian(%p1 : memref<1xf64>) %obs : !quantum.obs
     // CHECK: [[c3:%.+]] = llvm.mlir.constant(3 : i64)
     // CHECK: [[c1_2:%.+]] = llvm.mlir.constant(1 : i64)
     // CHECK: [[buf2:%.+]] = llvm.alloca [[c1_2]] x !llvm.struct<(ptr, ptr, i64, array<1 x i64>, array<1 x i64>)>
     // CHECK: llvm.store [[v2]], [[buf2]]
-    // CHECK: llvm.call @__catalyst__qis__HamiltonianObs([[buf2]], [[c3]], %arg0, %arg0, %arg0)
+    // CHECK-COUNT-3: llvm.store %arg0
+    // CHECK: llvm.call @__catalyst__qis__HamiltonianObs_array([[buf2]], [[c3]], [[obs3]])
     quantum.hamiltonian(%p2 : memref<3xf64>) %obs, %obs, %obs : !quantum.obs
 
     return
@@ -406,10 +565,12 @@ func.func @measure(%q : !quantum.bit) -> !quantum.bit {
 
 // -----
 
-// CHECK: llvm.func @__catalyst__qis__Sample(!llvm.ptr, i64, i64, ...)
+// CHECK: llvm.func @__catalyst__qis__Sample_array(!llvm.ptr, i64, i64, !llvm.ptr)
 
 // CHECK-LABEL: @sample
 func.func @sample(%q : !quantum.bit) {
+    // CHECK: [[qs2:%.+]] = llvm.alloca {{%.+}} x !llvm.ptr
+    // CHECK: [[qs1:%.+]] = llvm.alloca {{%.+}} x !llvm.ptr
 
     %o1 = quantum.compbasis %q : !quantum.obs
     %o2 = quantum.compbasis %q, %q : !quantum.obs
@@ -418,14 +579,16 @@ func.func @sample(%q : !quantum.bit) {
     // CHECK: [[ptr:%.+]] = llvm.alloca [[c1]] x !llvm.struct<(ptr, ptr, i64, array<2 x i64>, array<2 x i64>)>
     // CHECK: [[c1000:%.+]] = llvm.mlir.constant(1000 : i64)
     // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
-    // CHECK: llvm.call @__catalyst__qis__Sample([[ptr]], [[c1000]], [[c1]], %arg0)
+    // CHECK: llvm.store %arg0
+    // CHECK: llvm.call @__catalyst__qis__Sample_array([[ptr]], [[c1000]], [[c1]], [[qs1]])
     %alloc1 = memref.alloc() : memref<1000x1xf64>
     quantum.sample %o1 in(%alloc1 : memref<1000x1xf64>) {shots = 1000 : i64}
     // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
     // CHECK: [[ptr:%.+]] = llvm.alloca [[c1]] x !llvm.struct<(ptr, ptr, i64, array<2 x i64>, array<2 x i64>)>
     // CHECK: [[c2000:%.+]] = llvm.mlir.constant(2000 : i64)
     // CHECK: [[c2:%.+]] = llvm.mlir.constant(2 : i64)
-    // CHECK: llvm.call @__catalyst__qis__Sample([[ptr]], [[c2000]], [[c2]], %arg0, %arg0)
+    // CHECK-COUNT-2: llvm.store %arg0
+    // CHECK: llvm.call @__catalyst__qis__Sample_array([[ptr]], [[c2000]], [[c2]], [[qs2]])
     %alloc2 = memref.alloc() : memref<2000x2xf64>
     quantum.sample %o2 in(%alloc2 : memref<2000x2xf64>) {shots = 2000 : i64}
 
@@ -434,10 +597,56 @@ func.func @sample(%q : !quantum.bit) {
 
 // -----
 
-// CHECK: llvm.func @__catalyst__qis__Counts(!llvm.ptr, i64, i64, ...)
+// CHECK: llvm.func @__catalyst__qis__PackedSample_array(!llvm.ptr, i64, i64, !llvm.ptr)
+
+// CHECK-LABEL: @packed_sample
+func.func @packed_sample(%q : !quantum.bit) {
+    // CHECK: [[qs:%.+]] = llvm.alloca {{%.+}} x !llvm.ptr
+
+    %o = quantum.compbasis %q, %q : !quantum.obs
+
+    // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
+    // CHECK: [[ptr:%.+]] = llvm.alloca [[c1]] x !llvm.struct<(ptr, ptr, i64, array<1 x i64>, array<1 x i64>)>
+    // CHECK: [[c1000:%.+]] = llvm.mlir.constant(1000 : i64)
+    // CHECK: [[c2:%.+]] = llvm.mlir.constant(2 : i64)
+    // CHECK-COUNT-2: llvm.store %arg0
+    // CHECK: llvm.call @__catalyst__qis__PackedSample_array([[ptr]], [[c1000]], [[c2]], [[qs]])
+    %alloc = memref.alloc() : memref<1000xi64>
+    quantum.sample %o in(%alloc : memref<1000xi64>) {shots = 1000 : i64}
+
+    return
+}
+
+// -----
+
+// CHECK: llvm.func @__catalyst__qis__Shadow_array(!llvm.ptr, i64, i64, !llvm.ptr)
+
+// CHECK-LABEL: @shadow
+func.func @shadow(%q : !quantum.bit) {
+    // CHECK: [[qs:%.+]] = llvm.alloca {{%.+}} x !llvm.ptr
+
+    %o = quantum.compbasis %q, %q : !quantum.obs
+
+    // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
+    // CHECK: [[ptr:%.+]] = llvm.alloca [[c1]] x !llvm.struct<(ptr, ptr, i64, array<2 x i64>, array<2 x i64>)>
+    // CHECK: [[c1000:%.+]] = llvm.mlir.constant(1000 : i64)
+    // CHECK: [[c2:%.+]] = llvm.mlir.constant(2 : i64)
+    // CHECK-COUNT-2: llvm.store %arg0
+    // CHECK: llvm.call @__catalyst__qis__Shadow_array([[ptr]], [[c1000]], [[c2]], [[qs]])
+    %alloc = memref.alloc() : memref<1000x2xi64>
+    quantum.shadow %o in(%alloc : memref<1000x2xi64>) {shots = 1000 : i64}
+
+    return
+}
+
+// -----
+
+// CHECK: llvm.func @__catalyst__qis__Counts_array(!llvm.ptr, i64, i64, !llvm.ptr)
 
 // CHECK-LABEL: @counts
 func.func @counts(%q : !quantum.bit) {
+    // CHECK: [[qs2:%.+]] = llvm.alloca {{%.+}} x !llvm.ptr
+    // CHECK: [[qs1:%.+]] = llvm.alloca {{%.+}} x !llvm.ptr
 
     %o1 = quantum.compbasis %q : !quantum.obs
     %o2 = quantum.compbasis %q, %q : !quantum.obs
@@ -446,7 +655,8 @@ func.func @counts(%q : !quantum.bit) {
     // CHECK: [[ptr:%.+]] = llvm.alloca [[c1]] x !llvm.struct<(struct<(ptr, ptr, i64, array<1 x i64>, array<1 x i64>)>, struct<(ptr, ptr, i64, array<1 x i64>, array<1 x i64>)>
     // CHECK: [[c1000:%.+]] = llvm.mlir.constant(1000 : i64)
     // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
-    // CHECK: llvm.call @__catalyst__qis__Counts([[ptr]], [[c1000]], [[c1]], %arg0)
+    // CHECK: llvm.store %arg0
+    // CHECK: llvm.call @__catalyst__qis__Counts_array([[ptr]], [[c1000]], [[c1]], [[qs1]])
     %in_eigvals1 = memref.alloc() : memref<2xf64>
     %in_counts1 = memref.alloc() : memref<2xi64>
     quantum.counts %o1 in(%in_eigvals1 : memref<2xf64>, %in_counts1 : memref<2xi64>) {shots = 1000 : i64}
@@ -454,7 +664,8 @@ func.func @counts(%q : !quantum.bit) {
     // CHECK: [[ptr:%.+]] = llvm.alloca [[c1]] x !llvm.struct<(struct<(ptr, ptr, i64, array<1 x i64>, array<1 x i64>)>, struct<(ptr, ptr, i64, array<1 x i64>, array<1 x i64>)>
     // CHECK: [[c2000:%.+]] = llvm.mlir.constant(2000 : i64)
     // CHECK: [[c2:%.+]] = llvm.mlir.constant(2 : i64)
-    // CHECK: llvm.call @__catalyst__qis__Counts([[ptr]], [[c2000]], [[c2]], %arg0, %arg0)
+    // CHECK-COUNT-2: llvm.store %arg0
+    // CHECK: llvm.call @__catalyst__qis__Counts_array([[ptr]], [[c2000]], [[c2]], [[qs2]])
     %in_eigvals2 = memref.alloc() : memref<4xf64>
     %in_counts2 = memref.alloc() : memref<4xi64>
     quantum.counts %o2 in(%in_eigvals2 : memref<4xf64>, %in_counts2 : memref<4xi64>) {shots = 2000 : i64}
@@ -464,6 +675,29 @@ func.func @counts(%q : !quantum.bit) {
 
 // -----
 
+// CHECK: llvm.func @__catalyst__qis__SparseCounts_array(!llvm.ptr, i64, i64, !llvm.ptr)
+
+// CHECK-LABEL: @sparse_counts
+func.func @sparse_counts(%q : !quantum.bit) {
+    // CHECK: [[qs:%.+]] = llvm.alloca {{%.+}} x !llvm.ptr
+
+    %o = quantum.compbasis %q, %q : !quantum.obs
+
+    // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
+    // CHECK: [[ptr:%.+]] = llvm.alloca [[c1]] x !llvm.struct<(struct<(ptr, ptr, i64, array<1 x i64>, array<1 x i64>)>, struct<(ptr, ptr, i64, array<1 x i64>, array<1 x i64>)>
+    // CHECK: [[c3:%.+]] = llvm.mlir.constant(3 : i64)
+    // CHECK: [[c2:%.+]] = llvm.mlir.constant(2 : i64)
+    // CHECK-COUNT-2: llvm.store %arg0
+    // CHECK: llvm.call @__catalyst__qis__SparseCounts_array([[ptr]], [[c3]], [[c2]], [[qs]])
+    %in_eigvals = memref.alloc() : memref<3xf64>
+    %in_counts = memref.alloc() : memref<3xi64>
+    quantum.counts %o in(%in_eigvals : memref<3xf64>, %in_counts : memref<3xi64>) {shots = 3 : i64, sparse}
+
+    return
+}
+
+// -----
+
 // CHECK: llvm.func @__catalyst__qis__Expval(i64)
 
 // CHECK-LABEL: @expval
@@ -490,10 +724,52 @@ func.func @var(%obs : !quantum.obs) {
 
 // -----
 
-// CHECK: llvm.func @__catalyst__qis__Probs(!llvm.ptr, i64, ...)
+// CHECK: llvm.func @__catalyst__qis__ExpvalVar(!llvm.ptr, i64)
+
+// CHECK-LABEL: @expval_var
+func.func @expval_var(%obs : !quantum.obs) -> (f64, f64) {
+    // CHECK: [[c2:%.+]] = llvm.mlir.constant(2 : i64)
+    // CHECK: [[ptr:%.+]] = llvm.alloca [[c2]] x f64
+
+    // CHECK: llvm.call @__catalyst__qis__ExpvalVar([[ptr]], %arg0)
+    // CHECK: [[varPtr:%.+]] = llvm.getelementptr inbounds [[ptr]][1]
+    // CHECK: [[expval:%.+]] = llvm.load [[ptr]] : !llvm.ptr -> f64
+    // CHECK: [[var:%.+]] = llvm.load [[varPtr]] : !llvm.ptr -> f64
+    // CHECK: return [[expval]], [[var]]
+    %expval, %var = quantum.expval_var %obs : f64, f64
+
+    return %expval, %var : f64, f64
+}
+
+// -----
+
+// CHECK: llvm.func @__catalyst__qis__MeasurementGroup_array(i64, !llvm.ptr)
+
+// CHECK-LABEL: @measurement_group
+func.func @measurement_group(%obs0 : !quantum.obs, %obs1 : !quantum.obs) {
+    // CHECK: [[obs:%.+]] = llvm.alloca {{%.+}} x i64
+
+    // CHECK: [[c2:%.+]] = llvm.mlir.constant(2 : i64)
+    // CHECK: llvm.store %arg0
+    // CHECK: llvm.store %arg1
+    // CHECK: llvm.call @__catalyst__qis__MeasurementGroup_array([[c2]], [[obs]])
+    quantum.measurement_group %obs0, %obs1
+    // CHECK: llvm.call @__catalyst__qis__Expval(%arg0)
+    quantum.expval %obs0 : f64
+    // CHECK: llvm.call @__catalyst__qis__Variance(%arg1)
+    quantum.var %obs1 : f64
+
+    return
+}
+
+// -----
+
+// CHECK: llvm.func @__catalyst__qis__Probs_array(!llvm.ptr, i64, !llvm.ptr)
 
 // CHECK-LABEL: @probs
 func.func @probs(%q : !quantum.bit) {
+    // CHECK: [[qs4:%.+]] = llvm.alloca {{%.+}} x !llvm.ptr
+    // CHECK: [[qs1:%.+]] = llvm.alloca {{%.+}} x !llvm.ptr
 
     %o1 = quantum.compbasis %q : !quantum.obs
     %o2 = quantum.compbasis %q, %q, %q, %q : !quantum.obs
@@ -501,13 +777,15 @@ func.func @probs(%q : !quantum.bit) {
     // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
     // CHECK: [[ptr:%.+]] = llvm.alloca [[c1]] x !llvm.struct<(ptr, ptr, i64, array<1 x i64>, array<1 x i64>)>
     // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
-    // CHECK: llvm.call @__catalyst__qis__Probs([[ptr]], [[c1]], %arg0)
+    // CHECK: llvm.store %arg0
+    // CHECK: llvm.call @__catalyst__qis__Probs_array([[ptr]], [[c1]], [[qs1]])
     %alloc1 = memref.alloc() : memref<2xf64>
     quantum.probs %o1 in(%alloc1 : memref<2xf64>)
     // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
     // CHECK: [[ptr:%.+]] = llvm.alloca [[c1]] x !llvm.struct<(ptr, ptr, i64, array<1 x i64>, array<1 x i64>)>
     // CHECK: [[c4:%.+]] = llvm.mlir.constant(4 : i64)
-    // CHECK: llvm.call @__catalyst__qis__Probs([[ptr]], [[c4]], %arg0, %arg0, %arg0, %arg0)
+    // CHECK-COUNT-4: llvm.store %arg0
+    // CHECK: llvm.call @__catalyst__qis__Probs_array([[ptr]], [[c4]], [[qs4]])
     %alloc2 = memref.alloc() : memref<16xf64>
     quantum.probs %o2 in(%alloc2 : memref<16xf64>)
 
@@ -516,7 +794,7 @@ func.func @probs(%q : !quantum.bit) {
 
 // -----
 
-// CHECK: llvm.func @__catalyst__qis__State(!llvm.ptr, i64, ...)
+// CHECK: llvm.func @__catalyst__qis__State_array(!llvm.ptr, i64, !llvm.ptr)
 
 // CHECK-LABEL: @state
 func.func @state(%q : !quantum.bit) {
@@ -528,13 +806,15 @@ func.func @state(%q : !quantum.bit) {
     // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
     // CHECK: [[ptr:%.+]] = llvm.alloca [[c1]] x !llvm.struct<(ptr, ptr, i64, array<1 x i64>, array<1 x i64>)>
     // CHECK: [[c0:%.+]] = llvm.mlir.constant(0 : i64)
-    // CHECK: llvm.call @__catalyst__qis__State([[ptr]], [[c0]])
+    // CHECK: [[null:%.+]] = llvm.mlir.zero : !llvm.ptr
+    // CHECK: llvm.call @__catalyst__qis__State_array([[ptr]], [[c0]], [[null]])
     %alloc1 = memref.alloc() : memref<2xcomplex<f64>>
     quantum.state %o1 in(%alloc1 : memref<2xcomplex<f64>>)
     // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
     // CHECK: [[ptr:%.+]] = llvm.alloca [[c1]] x !llvm.struct<(ptr, ptr, i64, array<1 x i64>, array<1 x i64>)>
     // CHECK: [[c0:%.+]] = llvm.mlir.constant(0 : i64)
-    // CHECK: llvm.call @__catalyst__qis__State([[ptr]], [[c0]])
+    // CHECK: [[null:%.+]] = llvm.mlir.zero : !llvm.ptr
+    // CHECK: llvm.call @__catalyst__qis__State_array([[ptr]], [[c0]], [[null]])
     %alloc2 = memref.alloc() : memref<16xcomplex<f64>>
     quantum.state %o2 in(%alloc2: memref<16xcomplex<f64>>)
 
@@ -552,27 +832,30 @@ func.func @controlled_circuit(%1 : !quantum.bit, %2 : !quantum.bit, %3 : !quantu
     %cst_0 = llvm.mlir.constant (9.000000e-01 : f64) : f64
     %cst_1 = llvm.mlir.constant (3.000000e-01 : f64) : f64
 
-    // CHECK: [[oneA:%.+]] = llvm.mlir.constant(1 : i64)
-    // CHECK: [[oneB:%.+]] = llvm.mlir.constant(1 : i64)
-    // CHECK: [[mod:%.+]] = llvm.alloca [[oneA]] x !llvm.struct<(i1, i64, ptr, ptr)>
+    // The modifiers and qubit array slots are allocated once at the top of the function.
+    // CHECK: [[qs1:%.+]] = llvm.alloca {{%.+}} x !llvm.ptr
+    // CHECK: [[qs2:%.+]] = llvm.alloca {{%.+}} x !llvm.ptr
+    // CHECK: [[nWires:%.+]] = llvm.mlir.constant(1 : i64)
+    // CHECK: [[pctrl:%.+]] = llvm.alloca [[nWires]] x !llvm.ptr
+    // CHECK: [[nMod:%.+]] = llvm.mlir.constant(1 : i64)
+    // CHECK: [[mod:%.+]] = llvm.alloca [[nMod]] x !llvm.struct<(i1, i64, ptr, ptr)>
+    // CHECK: [[pwire:%.+]] = llvm.getelementptr inbounds [[pctrl]][0]
+    // CHECK: llvm.store %arg2, [[pwire]]
+    // CHECK: [[vals:%.+]] = llvm.mlir.addressof @__catalyst__ctrl_values_1
     // CHECK: [[ppctrl:%.+]] = llvm.getelementptr inbounds [[mod]][0, 2]
-    // CHECK: [[pctrl:%.+]] = llvm.alloca [[oneB]] x !llvm.ptr
     // CHECK: llvm.store [[pctrl]], [[ppctrl]]
     // CHECK: __catalyst__qis__Rot(
     // CHECK-SAME:                 [[mod]]
     %out_qubits, %out_ctrl_qubits = quantum.custom "Rot"(%cst, %cst_1, %cst_0) %2 ctrls (%3) ctrlvals (%true) : !quantum.bit ctrls !quantum.bit
-    // CHECK: [[mod:%.+]] = llvm.alloca {{%.+}} x !llvm.struct<(i1, i64, ptr, ptr)> : (i64) -> !llvm.ptr
+    // CHECK-NOT: llvm.alloca
     // CHECK: [[ppctrl:%.+]] = llvm.getelementptr inbounds [[mod]][0, 2]
-    // CHECK: [[pctrl:%.+]] = llvm.alloca {{%.+}} x !llvm.ptr : (i64) -> !llvm.ptr
     // CHECK: llvm.store [[pctrl]], [[ppctrl]]
-    // CHECK: __catalyst__qis__MultiRZ(
+    // CHECK: __catalyst__qis__MultiRZ_array(
     // CHECK-SAME:                 [[mod]]
     %out_qubits_2:2, %out_ctrl_qubits_3 = quantum.multirz(%cst) %out_qubits, %1 ctrls (%out_ctrl_qubits) ctrlvals (%true) : !quantum.bit, !quantum.bit ctrls !quantum.bit
-    // CHECK: [[mod:%.+]] = llvm.alloca {{%.+}} x !llvm.struct<(i1, i64, ptr, ptr)> : (i64) -> !llvm.ptr
     // CHECK: [[ppctrl:%.+]] = llvm.getelementptr inbounds [[mod]][0, 2]
-    // CHECK: [[pctrl:%.+]] = llvm.alloca {{%.+}} x !llvm.ptr : (i64) -> !llvm.ptr
     // CHECK: llvm.store [[pctrl]], [[ppctrl]]
-    // CHECK: __catalyst__qis__QubitUnitary(
+    // CHECK: __catalyst__qis__QubitUnitary_array(
     // CHECK-SAME:                 [[mod]]
     %out_qubits_4, %out_ctrl_qubits_5 = quantum.unitary(%arg0 : memref<2x2xcomplex<f64>>) %out_qubits_2#0 ctrls (%out_ctrl_qubits_3) ctrlvals (%true) : !quantum.bit ctrls !quantum.bit
 
@@ -0,0 +1,272 @@
+// Copyright 2024 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt --defer-measurements --split-input-file %s | FileCheck %s
+// RUN: quantum-opt --defer-measurements="max-ancillas=1" --split-input-file %s | FileCheck %s --check-prefix=LIMIT
+
+// CHECK-LABEL: test_defer_measurement
+func.func @test_defer_measurement() -> f64 {
+    // CHECK: [[reg:%.+]] = quantum.alloc( 2)
+    // CHECK: [[areg:%.+]] = quantum.alloc( 1)
+    // CHECK: [[a0:%.+]] = quantum.extract [[areg]][ 0]
+    // CHECK: [[q0:%.+]] = quantum.extract [[reg]][ 0]
+    // CHECK: [[h:%.+]] = quantum.custom "Hadamard"() [[q0]]
+    // CHECK: [[cnot:%.+]]:2 = quantum.custom "CNOT"() [[h]], [[a0]]
+    // CHECK-NOT: quantum.measure
+    // CHECK: [[r1:%.+]] = quantum.insert [[reg]][ 0], [[cnot]]#0
+    // CHECK-NOT: scf.if
+    // CHECK: [[q1:%.+]] = quantum.extract [[r1]][ 1]
+    // CHECK: [[true:%.+]] = arith.constant true
+    // CHECK: [[x:%.+]], [[a1:%.+]] = quantum.custom "PauliX"() [[q1]] ctrls([[cnot]]#1) ctrlvals([[true]])
+    // CHECK: [[r2:%.+]] = quantum.insert [[r1]][ 1], [[x]]
+    // CHECK: [[q2:%.+]] = quantum.extract [[r2]][ 1]
+    // CHECK: quantum.namedobs [[q2]]
+    // CHECK: [[a2:%.+]] = quantum.insert [[areg]][ 0], [[a1]]
+    // CHECK: quantum.dealloc [[a2]]
+    // CHECK: quantum.dealloc [[r2]]
+    %r0 = quantum.alloc( 2) : !quantum.reg
+    %q0 = quantum.extract %r0[ 0] : !quantum.reg -> !quantum.bit
+    %q1 = quantum.custom "Hadamard"() %q0 : !quantum.bit
+    %m, %q2 = quantum.measure %q1 : i1, !quantum.bit
+    %t = tensor.from_elements %m : tensor<i1>
+    %r1 = quantum.insert %r0[ 0], %q2 : !quantum.reg, !quantum.bit
+    %c = tensor.extract %t[] : tensor<i1>
+    %r2 = scf.if %c -> (!quantum.reg) {
+        %q3 = quantum.extract %r1[ 1] : !quantum.reg -> !quantum.bit
+        %q4 = quantum.custom "PauliX"() %q3 : !quantum.bit
+        %r3 = quantum.insert %r1[ 1], %q4 : !quantum.reg, !quantum.bit
+        scf.yield %r3 : !quantum.reg
+    } else {
+        scf.yield %r1 : !quantum.reg
+    }
+    %q5 = quantum.extract %r2[ 1] : !quantum.reg -> !quantum.bit
+    %obs = quantum.namedobs %q5[ PauliZ] : !quantum.obs
+    %e = quantum.expval %obs : f64
+    quantum.dealloc %r2 : !quantum.reg
+    return %e : f64
+}
+
+// -----
+
+// CHECK-LABEL: test_defer_both_branches
+func.func @test_defer_both_branches(%theta: f64) -> f64 {
+    // CHECK: [[cnot:%.+]]:2 = quantum.custom "CNOT"()
+    // CHECK: [[true:%.+]] = arith.constant true
+    // CHECK: [[rx:%.+]], [[a1:%.+]] = quantum.custom "RX"(%arg0) {{%.+}} ctrls([[cnot]]#1) ctrlvals([[true]])
+    // CHECK: [[neg:%.+]] = arith.negf %arg0
+    // CHECK: [[false:%.+]] = arith.constant false
+    // CHECK: [[ry:%.+]], [[a2:%.+]] = quantum.custom "RY"([[neg]]) {{%.+}} ctrls([[a1]]) ctrlvals([[false]])
+    // CHECK: quantum.gphase([[neg]]) ctrls([[a2]]) ctrlvals([[false]])
+    // CHECK-NOT: scf.if
+    %r0 = quantum.alloc( 2) : !quantum.reg
+    %q0 = quantum.extract %r0[ 0] : !quantum.reg -> !quantum.bit
+    %m, %q1 = quantum.measure %q0 : i1, !quantum.bit
+    %r1 = quantum.insert %r0[ 0], %q1 : !quantum.reg, !quantum.bit
+    %r2 = scf.if %m -> (!quantum.reg) {
+        %q2 = quantum.extract %r1[ 1] : !quantum.reg -> !quantum.bit
+        %q3 = quantum.custom "RX"(%theta) %q2 : !quantum.bit
+        %r3 = quantum.insert %r1[ 1], %q3 : !quantum.reg, !quantum.bit
+        scf.yield %r3 : !quantum.reg
+    } else {
+        %neg = arith.negf %theta : f64
+        %q2 = quantum.extract %r1[ 1] : !quantum.reg -> !quantum.bit
+        %q3 = quantum.custom "RY"(%neg) %q2 : !quantum.bit
+        quantum.gphase(%neg) :
+        %r3 = quantum.insert %r1[ 1], %q3 : !quantum.reg, !quantum.bit
+        scf.yield %r3 : !quantum.reg
+    }
+    %q4 = quantum.extract %r2[ 1] : !quantum.reg -> !quantum.bit
+    %obs = quantum.namedobs %q4[ PauliZ] : !quantum.obs
+    %e = quantum.expval %obs : f64
+    quantum.dealloc %r2 : !quantum.reg
+    return %e : f64
+}
+
+// -----
+
+// CHECK-LABEL: test_outcome_returned
+func.func @test_outcome_returned() -> i1 {
+    // CHECK: quantum.measure
+    // CHECK: scf.if
+    %r0 = quantum.alloc( 2) : !quantum.reg
+    %q0 = quantum.extract %r0[ 0] : !quantum.reg -> !quantum.bit
+    %m, %q1 = quantum.measure %q0 : i1, !quantum.bit
+    %r1 = quantum.insert %r0[ 0], %q1 : !quantum.reg, !quantum.bit
+    %r2 = scf.if %m -> (!quantum.reg) {
+        %q2 = quantum.extract %r1[ 1] : !quantum.reg -> !quantum.bit
+        %q3 = quantum.custom "PauliX"() %q2 : !quantum.bit
+        %r3 = quantum.insert %r1[ 1], %q3 : !quantum.reg, !quantum.bit
+        scf.yield %r3 : !quantum.reg
+    } else {
+        scf.yield %r1 : !quantum.reg
+    }
+    quantum.dealloc %r2 : !quantum.reg
+    return %m : i1
+}
+
+// -----
+
+// CHECK-LABEL: test_branch_measures
+func.func @test_branch_measures() {
+    // CHECK: quantum.measure
+    // CHECK: scf.if
+    %r0 = quantum.alloc( 2) : !quantum.reg
+    %q0 = quantum.extract %r0[ 0] : !quantum.reg -> !quantum.bit
+    %m, %q1 = quantum.measure %q0 : i1, !quantum.bit
+    %r1 = quantum.insert %r0[ 0], %q1 : !quantum.reg, !quantum.bit
+    %r2 = scf.if %m -> (!quantum.reg) {
+        %q2 = quantum.extract %r1[ 1] : !quantum.reg -> !quantum.bit
+        %m2, %q3 = quantum.measure %q2 : i1, !quantum.bit
+        %r3 = quantum.insert %r1[ 1], %q3 : !quantum.reg, !quantum.bit
+        scf.yield %r3 : !quantum.reg
+    } else {
+        scf.yield %r1 : !quantum.reg
+    }
+    quantum.dealloc %r2 : !quantum.reg
+    return
+}
+
+// -----
+
+// CHECK-LABEL: test_state_not_deferred
+func.func @test_state_not_deferred() -> tensor<4xcomplex<f64>> {
+    // CHECK: quantum.measure
+    // CHECK: scf.if
+    %r0 = quantum.alloc( 2) : !quantum.reg
+    %q0 = quantum.extract %r0[ 0] : !quantum.reg -> !quantum.bit
+    %m, %q1 = quantum.measure %q0 : i1, !quantum.bit
+    %r1 = quantum.insert %r0[ 0], %q1 : !quantum.reg, !quantum.bit
+    %r2 = scf.if %m -> (!quantum.reg) {
+        %q2 = quantum.extract %r1[ 1] : !quantum.reg -> !quantum.bit
+        %q3 = quantum.custom "PauliX"() %q2 : !quantum.bit
+        %r3 = quantum.insert %r1[ 1], %q3 : !quantum.reg, !quantum.bit
+        scf.yield %r3 : !quantum.reg
+    } else {
+        scf.yield %r1 : !quantum.reg
+    }
+    %q4 = quantum.extract %r2[ 0] : !quantum.reg -> !quantum.bit
+    %q5 = quantum.extract %r2[ 1] : !quantum.reg -> !quantum.bit
+    %obs = quantum.compbasis %q4, %q5 : !quantum.obs
+    %state = quantum.state %obs : tensor<4xcomplex<f64>>
+    quantum.dealloc %r2 : !quantum.reg
+    return %state : tensor<4xcomplex<f64>>
+}
+
+// -----
+
+// CHECK-LABEL: test_ancilla_budget
+// LIMIT-LABEL: test_ancilla_budget
+func.func @test_ancilla_budget() -> f64 {
+    // CHECK: quantum.alloc( 2)
+    // CHECK: quantum.alloc( 2)
+    // CHECK-NOT: quantum.measure
+    // LIMIT: quantum.alloc( 1)
+    // LIMIT: quantum.custom "CNOT"
+    // LIMIT: quantum.measure
+    // LIMIT: scf.if
+    %r0 = quantum.alloc( 2) : !quantum.reg
+    %q0 = quantum.extract %r0[ 0] : !quantum.reg -> !quantum.bit
+    %m0, %q1 = quantum.measure %q0 : i1, !quantum.bit
+    %r1 = quantum.insert %r0[ 0], %q1 : !quantum.reg, !quantum.bit
+    %r2 = scf.if %m0 -> (!quantum.reg) {
+        %q2 = quantum.extract %r1[ 1] : !quantum.reg -> !quantum.bit
+        %q3 = quantum.custom "PauliX"() %q2 : !quantum.bit
+        %r3 = quantum.insert %r1[ 1], %q3 : !quantum.reg, !quantum.bit
+        scf.yield %r3 : !quantum.reg
+    } else {
+        scf.yield %r1 : !quantum.reg
+    }
+    %q4 = quantum.extract %r2[ 1] : !quantum.reg -> !quantum.bit
+    %m1, %q5 = quantum.measure %q4 : i1, !quantum.bit
+    %r4 = quantum.insert %r2[ 1], %q5 : !quantum.reg, !quantum.bit
+    %r5 = scf.if %m1 -> (!quantum.reg) {
+        %q6 = quantum.extract %r4[ 0] : !quantum.reg -> !quantum.bit
+        %q7 = quantum.custom "PauliZ"() %q6 : !quantum.bit
+        %r6 = quantum.insert %r4[ 0], %q7 : !quantum.reg, !quantum.bit
+        scf.yield %r6 : !quantum.reg
+    } else {
+        scf.yield %r4 : !quantum.reg
+    }
+    %q8 = quantum.extract %r5[ 0] : !quantum.reg -> !quantum.bit
+    %obs = quantum.namedobs %q8[ PauliX] : !quantum.obs
+    %e = quantum.expval %obs : f64
+    quantum.dealloc %r5 : !quantum.reg
+    return %e : f64
+}
+
+// -----
+
+// CHECK-LABEL: test_shared_condition
+func.func @test_shared_condition() -> f64 {
+    // CHECK: [[cnot:%.+]]:2 = quantum.custom "CNOT"()
+    // CHECK-NOT: tensor.from_elements
+    // CHECK-NOT: tensor.extract
+    // CHECK: [[x:%.+]], [[a1:%.+]] = quantum.custom "PauliX"() {{%.+}} ctrls([[cnot]]#1)
+    // CHECK-NOT: scf.if
+    // CHECK: [[z:%.+]], [[a2:%.+]] = quantum.custom "PauliZ"() {{%.+}} ctrls([[a1]])
+    // CHECK-NOT: scf.if
+    // CHECK: quantum.insert {{%.+}}[ 0], [[a2]]
+    %r0 = quantum.alloc( 2) : !quantum.reg
+    %q0 = quantum.extract %r0[ 0] : !quantum.reg -> !quantum.bit
+    %q1 = quantum.custom "Hadamard"() %q0 : !quantum.bit
+    %m, %q2 = quantum.measure %q1 : i1, !quantum.bit
+    %t = tensor.from_elements %m : tensor<i1>
+    %r1 = quantum.insert %r0[ 0], %q2 : !quantum.reg, !quantum.bit
+    %c = tensor.extract %t[] : tensor<i1>
+    %r2 = scf.if %c -> (!quantum.reg) {
+        %q3 = quantum.extract %r1[ 1] : !quantum.reg -> !quantum.bit
+        %q4 = quantum.custom "PauliX"() %q3 : !quantum.bit
+        %r3 = quantum.insert %r1[ 1], %q4 : !quantum.reg, !quantum.bit
+        scf.yield %r3 : !quantum.reg
+    } else {
+        scf.yield %r1 : !quantum.reg
+    }
+    %r4 = scf.if %c -> (!quantum.reg) {
+        %q5 = quantum.extract %r2[ 1] : !quantum.reg -> !quantum.bit
+        %q6 = quantum.custom "PauliZ"() %q5 : !quantum.bit
+        %r5 = quantum.insert %r2[ 1], %q6 : !quantum.reg, !quantum.bit
+        scf.yield %r5 : !quantum.reg
+    } else {
+        scf.yield %r2 : !quantum.reg
+    }
+    %q7 = quantum.extract %r4[ 1] : !quantum.reg -> !quantum.bit
+    %obs = quantum.namedobs %q7[ PauliX] : !quantum.obs
+    %e = quantum.expval %obs : f64
+    quantum.dealloc %r4 : !quantum.reg
+    return %e : f64
+}
+
+// -----
+
+// CHECK-LABEL: test_probs_not_deferred
+func.func @test_probs_not_deferred() -> tensor<4xf64> {
+    // CHECK: quantum.measure
+    // CHECK: scf.if
+    %r0 = quantum.alloc( 2) : !quantum.reg
+    %q0 = quantum.extract %r0[ 0] : !quantum.reg -> !quantum.bit
+    %m, %q1 = quantum.measure %q0 : i1, !quantum.bit
+    %r1 = quantum.insert %r0[ 0], %q1 : !quantum.reg, !quantum.bit
+    %r2 = scf.if %m -> (!quantum.reg) {
+        %q2 = quantum.extract %r1[ 1] : !quantum.reg -> !quantum.bit
+        %q3 = quantum.custom "PauliX"() %q2 : !quantum.bit
+        %r3 = quantum.insert %r1[ 1], %q3 : !quantum.reg, !quantum.bit
+        scf.yield %r3 : !quantum.reg
+    } else {
+        scf.yield %r1 : !quantum.reg
+    }
+    %obs = quantum.compbasis : !quantum.obs
+    %probs = quantum.probs %obs : tensor<4xf64>
+    quantum.dealloc %r2 : !quantum.reg
+    return %probs : tensor<4xf64>
+}
@@ -0,0 +1,85 @@
+// Copyright 2024 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt --group-measurements --split-input-file -verify-diagnostics %s | FileCheck %s
+
+// CHECK-LABEL: test_group_measurements
+func.func @test_group_measurements(%r: !quantum.reg) -> (tensor<f64>, tensor<f64>, tensor<f64>) {
+    // CHECK: [[q0:%.+]] = quantum.extract %arg0
+    // CHECK: [[z0:%.+]] = quantum.namedobs [[q0]]
+    // CHECK: [[q1:%.+]] = quantum.extract %arg0
+    // CHECK: [[z1:%.+]] = quantum.namedobs [[q1]]
+    // CHECK: [[x1:%.+]] = quantum.namedobs [[q1]]
+    // CHECK: quantum.measurement_group [[z0]], [[z1]], [[x1]]
+    // CHECK: quantum.expval [[z0]]
+    // CHECK: quantum.expval [[z1]]
+    // CHECK: quantum.var [[x1]]
+    %q0 = quantum.extract %r[0] : !quantum.reg -> !quantum.bit
+    %z0 = quantum.namedobs %q0[PauliZ] : !quantum.obs
+    %e0 = quantum.expval %z0 : f64
+    %t0 = tensor.from_elements %e0 : tensor<f64>
+    %q1 = quantum.extract %r[1] : !quantum.reg -> !quantum.bit
+    %z1 = quantum.namedobs %q1[PauliZ] : !quantum.obs
+    %e1 = quantum.expval %z1 : f64
+    %t1 = tensor.from_elements %e1 : tensor<f64>
+    %x1 = quantum.namedobs %q1[PauliX] : !quantum.obs
+    %v1 = quantum.var %x1 : f64
+    %t2 = tensor.from_elements %v1 : tensor<f64>
+    return %t0, %t1, %t2 : tensor<f64>, tensor<f64>, tensor<f64>
+}
+
+// -----
+
+// CHECK-LABEL: test_group_ends_at_gate
+func.func @test_group_ends_at_gate(%q0: !quantum.bit, %q1: !quantum.bit) -> (f64, f64, f64, f64) {
+    // CHECK: quantum.measurement_group
+    // CHECK-NEXT: quantum.expval
+    // CHECK-NEXT: quantum.expval
+    // CHECK: quantum.custom "Hadamard"
+    // CHECK: quantum.measurement_group
+    // CHECK-NEXT: quantum.expval
+    // CHECK-NEXT: quantum.expval
+    %z0 = quantum.namedobs %q0[PauliZ] : !quantum.obs
+    %z1 = quantum.namedobs %q1[PauliZ] : !quantum.obs
+    %e0 = quantum.expval %z0 : f64
+    %e1 = quantum.expval %z1 : f64
+    %q2 = quantum.custom "Hadamard"() %q0 : !quantum.bit
+    %x2 = quantum.namedobs %q2[PauliX] : !quantum.obs
+    %e2 = quantum.expval %x2 : f64
+    %e3 = quantum.expval %z1 : f64
+    return %e0, %e1, %e2, %e3 : f64, f64, f64, f64
+}
+
+// -----
+
+// CHECK-LABEL: test_observable_depends_on_measurement
+func.func @test_observable_depends_on_measurement(%q: !quantum.bit) -> (f64, f64) {
+    // CHECK-NOT: quantum.measurement_group
+    %z = quantum.namedobs %q[PauliZ] : !quantum.obs
+    %e0 = quantum.expval %z : f64
+    %coeffs = tensor.from_elements %e0 : tensor<1xf64>
+    %h = quantum.hamiltonian(%coeffs : tensor<1xf64>) %z : !quantum.obs
+    %e1 = quantum.expval %h : f64
+    return %e0, %e1 : f64, f64
+}
+
+// -----
+
+// CHECK-LABEL: test_single_measurement
+func.func @test_single_measurement(%q: !quantum.bit) -> f64 {
+    // CHECK-NOT: quantum.measurement_group
+    %z = quantum.namedobs %q[PauliZ] : !quantum.obs
+    %e = quantum.expval %z : f64
+    return %e : f64
+}
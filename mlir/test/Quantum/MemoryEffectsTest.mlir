@@ -0,0 +1,116 @@
+// Copyright 2024 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt --cse --loop-invariant-code-motion --canonicalize --split-input-file %s | FileCheck %s
+
+// CHECK-LABEL: test_expval_cse
+func.func @test_expval_cse(%q : !quantum.bit) -> (f64, f64) {
+    // CHECK: quantum.namedobs
+    // CHECK-NOT: quantum.namedobs
+    %obs1 = quantum.namedobs %q[PauliZ] : !quantum.obs
+    %obs2 = quantum.namedobs %q[PauliZ] : !quantum.obs
+
+    // CHECK: quantum.expval
+    // CHECK-NOT: quantum.expval
+    %e1 = quantum.expval %obs1 : f64
+    %e2 = quantum.expval %obs2 : f64
+    return %e1, %e2 : f64, f64
+}
+
+// -----
+
+// CHECK-LABEL: test_expval_dce
+func.func @test_expval_dce(%q : !quantum.bit) {
+    // CHECK-NOT: quantum.namedobs
+    // CHECK-NOT: quantum.expval
+    %obs = quantum.namedobs %q[PauliZ] : !quantum.obs
+    %e = quantum.expval %obs : f64
+    return
+}
+
+// -----
+
+// CHECK-LABEL: test_expval_no_cse_across_measure
+func.func @test_expval_no_cse_across_measure(%q0 : !quantum.bit, %q1 : !quantum.bit) -> (f64, f64, i1) {
+    %obs = quantum.namedobs %q0[PauliZ] : !quantum.obs
+
+    // CHECK: quantum.expval
+    // CHECK: quantum.measure
+    // CHECK: quantum.expval
+    %e1 = quantum.expval %obs : f64
+    %m, %q2 = quantum.measure %q1 : i1, !quantum.bit
+    %e2 = quantum.expval %obs : f64
+    return %e1, %e2, %m : f64, f64, i1
+}
+
+// -----
+
+// CHECK-LABEL: test_measure_no_cse_no_dce
+func.func @test_measure_no_cse_no_dce(%q : !quantum.bit) -> i1 {
+    // CHECK: quantum.measure
+    // CHECK: quantum.measure
+    // CHECK: quantum.measure
+    %m1, %q1 = quantum.measure %q : i1, !quantum.bit
+    %m2, %q2 = quantum.measure %q : i1, !quantum.bit
+    %m3, %q3 = quantum.measure %q : i1, !quantum.bit
+    return %m1 : i1
+}
+
+// -----
+
+// CHECK-LABEL: test_bufferized_probs_no_dce
+func.func @test_bufferized_probs_no_dce(%q : !quantum.bit, %buf : memref<2xf64>) {
+    // CHECK: quantum.probs
+    %obs = quantum.compbasis %q : !quantum.obs
+    quantum.probs %obs in(%buf : memref<2xf64>)
+    return
+}
+
+// -----
+
+// CHECK-LABEL: test_observable_licm
+func.func @test_observable_licm(%q : !quantum.bit, %lb : index, %ub : index, %step : index) -> f64 {
+    %c0 = arith.constant 0.0 : f64
+
+    // CHECK: quantum.namedobs
+    // CHECK: scf.for
+    // CHECK-NOT: quantum.namedobs
+    // CHECK: quantum.custom
+    %res, %qout = scf.for %i = %lb to %ub step %step iter_args(%acc = %c0, %qi = %q) -> (f64, !quantum.bit) {
+        %obs = quantum.namedobs %q[PauliX] : !quantum.obs
+        %e = quantum.expval %obs : f64
+        %sum = arith.addf %acc, %e : f64
+        %qn = quantum.custom "Hadamard"() %qi : !quantum.bit
+        scf.yield %sum, %qn : f64, !quantum.bit
+    }
+    return %res : f64
+}
+
+// -----
+
+// CHECK-LABEL: test_list_no_cse
+func.func @test_list_no_cse(%v : f64) -> (f64, f64) {
+    %list = catalyst.list_init : !catalyst.arraylist<f64>
+
+    // CHECK: catalyst.list_push
+    // CHECK: catalyst.list_pop
+    // CHECK: catalyst.list_push
+    // CHECK: catalyst.list_pop
+    catalyst.list_push %v, %list : !catalyst.arraylist<f64>
+    %r1 = catalyst.list_pop %list : !catalyst.arraylist<f64>
+    catalyst.list_push %v, %list : !catalyst.arraylist<f64>
+    %r2 = catalyst.list_pop %list : !catalyst.arraylist<f64>
+    catalyst.list_dealloc %list : !catalyst.arraylist<f64>
+    return %r1, %r2 : f64, f64
+}
@@ -0,0 +1,63 @@
+// Copyright 2024 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt --recognize-qft --split-input-file -verify-diagnostics %s | FileCheck %s
+
+// CHECK-LABEL: test_qft_3_wires
+func.func @test_qft_3_wires(%q0: !quantum.bit, %q1: !quantum.bit, %q2: !quantum.bit) -> (!quantum.bit, !quantum.bit, !quantum.bit) {
+    %half = arith.constant 1.5707963267948966 : f64
+    %quarter = arith.constant 0.78539816339744828 : f64
+
+    // CHECK-NOT: quantum.custom
+    // CHECK: [[qft:%.+]]:3 = quantum.qft %arg0, %arg1, %arg2 : !quantum.bit, !quantum.bit, !quantum.bit
+    // CHECK-NOT: quantum.custom
+    %0 = quantum.custom "Hadamard"() %q0 : !quantum.bit
+    %1:2 = quantum.custom "ControlledPhaseShift"(%half) %q1, %0 : !quantum.bit, !quantum.bit
+    %2:2 = quantum.custom "ControlledPhaseShift"(%quarter) %q2, %1#1 : !quantum.bit, !quantum.bit
+    %3 = quantum.custom "Hadamard"() %1#0 : !quantum.bit
+    %4:2 = quantum.custom "ControlledPhaseShift"(%half) %2#0, %3 : !quantum.bit, !quantum.bit
+    %5 = quantum.custom "Hadamard"() %4#0 : !quantum.bit
+    %6:2 = quantum.custom "SWAP"() %2#1, %5 : !quantum.bit, !quantum.bit
+
+    // CHECK: return [[qft]]#0, [[qft]]#1, [[qft]]#2
+    return %6#0, %4#1, %6#1 : !quantum.bit, !quantum.bit, !quantum.bit
+}
+
+// -----
+
+// CHECK-LABEL: test_qft_wrong_angle
+func.func @test_qft_wrong_angle(%q0: !quantum.bit, %q1: !quantum.bit) -> (!quantum.bit, !quantum.bit) {
+    %quarter = arith.constant 0.78539816339744828 : f64
+
+    // CHECK-NOT: quantum.qft
+    %0 = quantum.custom "Hadamard"() %q0 : !quantum.bit
+    %1:2 = quantum.custom "ControlledPhaseShift"(%quarter) %q1, %0 : !quantum.bit, !quantum.bit
+    %2 = quantum.custom "Hadamard"() %1#0 : !quantum.bit
+    %3:2 = quantum.custom "SWAP"() %1#1, %2 : !quantum.bit, !quantum.bit
+    return %3#0, %3#1 : !quantum.bit, !quantum.bit
+}
+
+// -----
+
+// CHECK-LABEL: test_qft_intermediate_use
+func.func @test_qft_intermediate_use(%q0: !quantum.bit, %q1: !quantum.bit) -> (!quantum.bit, !quantum.bit, !quantum.bit) {
+    %half = arith.constant 1.5707963267948966 : f64
+
+    // CHECK-NOT: quantum.qft
+    %0 = quantum.custom "Hadamard"() %q0 : !quantum.bit
+    %1:2 = quantum.custom "ControlledPhaseShift"(%half) %q1, %0 : !quantum.bit, !quantum.bit
+    %2 = quantum.custom "Hadamard"() %1#0 : !quantum.bit
+    %3:2 = quantum.custom "SWAP"() %1#1, %2 : !quantum.bit, !quantum.bit
+    return %3#0, %3#1, %1#1 : !quantum.bit, !quantum.bit, !quantum.bit
+}
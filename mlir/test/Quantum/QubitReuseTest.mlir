@@ -0,0 +1,145 @@
+// Copyright 2024 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt --qubit-reuse --split-input-file %s | FileCheck %s
+
+// CHECK-LABEL: test_reuse_measured_wire
+func.func @test_reuse_measured_wire() -> f64 {
+    // CHECK: [[reg:%.+]] = quantum.alloc( 1)
+    // CHECK: [[q0:%.+]] = quantum.extract [[reg]][ 0]
+    // CHECK: [[h:%.+]] = quantum.custom "Hadamard"() [[q0]]
+    // CHECK: [[m:%.+]], [[q1:%.+]] = quantum.measure [[h]]
+    // CHECK: [[reset:%.+]] = scf.if [[m]] -> (!quantum.bit) {
+    // CHECK:     [[x:%.+]] = quantum.custom "PauliX"() [[q1]]
+    // CHECK:     scf.yield [[x]]
+    // CHECK: } else {
+    // CHECK:     scf.yield [[q1]]
+    // CHECK: [[r1:%.+]] = quantum.insert [[reg]][ 0], [[reset]]
+    // CHECK: [[q2:%.+]] = quantum.extract [[r1]][ 0]
+    // CHECK: [[ry:%.+]] = quantum.custom "RY"
+    // CHECK: quantum.insert [[r1]][ 0], [[ry]]
+    %theta = arith.constant 0.5 : f64
+    %r0 = quantum.alloc( 2) : !quantum.reg
+    %q0 = quantum.extract %r0[ 0] : !quantum.reg -> !quantum.bit
+    %q1 = quantum.custom "Hadamard"() %q0 : !quantum.bit
+    %m, %q2 = quantum.measure %q1 : i1, !quantum.bit
+    %r1 = quantum.insert %r0[ 0], %q2 : !quantum.reg, !quantum.bit
+    %q3 = quantum.extract %r1[ 1] : !quantum.reg -> !quantum.bit
+    %q4 = quantum.custom "RY"(%theta) %q3 : !quantum.bit
+    %obs = quantum.namedobs %q4[ PauliZ] : !quantum.obs
+    %e = quantum.expval %obs : f64
+    %r2 = quantum.insert %r1[ 1], %q4 : !quantum.reg, !quantum.bit
+    quantum.dealloc %r2 : !quantum.reg
+    return %e : f64
+}
+
+// -----
+
+// CHECK-LABEL: test_postselected_wire
+func.func @test_postselected_wire() -> f64 {
+    // CHECK: [[reg:%.+]] = quantum.alloc( 1)
+    // CHECK-NOT: scf.if
+    // CHECK-NOT: "PauliX"
+    // CHECK: [[r1:%.+]] = quantum.insert [[reg]][ 0]
+    // CHECK: quantum.extract [[r1]][ 0]
+    %r0 = quantum.alloc( 2) : !quantum.reg
+    %q0 = quantum.extract %r0[ 0] : !quantum.reg -> !quantum.bit
+    %q1 = quantum.custom "Hadamard"() %q0 : !quantum.bit
+    %m, %q2 = quantum.measure %q1 {postselect = 0 : i32} : i1, !quantum.bit
+    %r1 = quantum.insert %r0[ 0], %q2 : !quantum.reg, !quantum.bit
+    %q3 = quantum.extract %r1[ 1] : !quantum.reg -> !quantum.bit
+    %obs = quantum.namedobs %q3[ PauliZ] : !quantum.obs
+    %e = quantum.expval %obs : f64
+    %r2 = quantum.insert %r1[ 1], %q3 : !quantum.reg, !quantum.bit
+    quantum.dealloc %r2 : !quantum.reg
+    return %e : f64
+}
+
+// -----
+
+// CHECK-LABEL: test_drop_unused_wire
+func.func @test_drop_unused_wire() -> f64 {
+    // CHECK: [[reg:%.+]] = quantum.alloc( 2)
+    // CHECK: quantum.extract [[reg]][ 0]
+    // CHECK: quantum.extract [[reg]][ 1]
+    // CHECK-NOT: scf.if
+    %r0 = quantum.alloc( 3) : !quantum.reg
+    %q0 = quantum.extract %r0[ 0] : !quantum.reg -> !quantum.bit
+    %q1 = quantum.extract %r0[ 2] : !quantum.reg -> !quantum.bit
+    %q2:2 = quantum.custom "CNOT"() %q0, %q1 : !quantum.bit, !quantum.bit
+    %obs = quantum.namedobs %q2#1[ PauliZ] : !quantum.obs
+    %e = quantum.expval %obs : f64
+    %r1 = quantum.insert %r0[ 0], %q2#0 : !quantum.reg, !quantum.bit
+    %r2 = quantum.insert %r1[ 2], %q2#1 : !quantum.reg, !quantum.bit
+    quantum.dealloc %r2 : !quantum.reg
+    return %e : f64
+}
+
+// -----
+
+// CHECK-LABEL: test_overlapping_wires
+func.func @test_overlapping_wires() -> f64 {
+    // CHECK: quantum.alloc( 2)
+    // CHECK-NOT: scf.if
+    %r0 = quantum.alloc( 2) : !quantum.reg
+    %q0 = quantum.extract %r0[ 0] : !quantum.reg -> !quantum.bit
+    %q1 = quantum.extract %r0[ 1] : !quantum.reg -> !quantum.bit
+    %m, %q2 = quantum.measure %q0 : i1, !quantum.bit
+    %r1 = quantum.insert %r0[ 0], %q2 : !quantum.reg, !quantum.bit
+    %obs = quantum.namedobs %q1[ PauliZ] : !quantum.obs
+    %e = quantum.expval %obs : f64
+    %r2 = quantum.insert %r1[ 1], %q1 : !quantum.reg, !quantum.bit
+    quantum.dealloc %r2 : !quantum.reg
+    return %e : f64
+}
+
+// -----
+
+// CHECK-LABEL: test_wire_extracted_after_measurement
+func.func @test_wire_extracted_after_measurement() -> f64 {
+    // CHECK: quantum.alloc( 2)
+    // CHECK-NOT: scf.if
+    %r0 = quantum.alloc( 2) : !quantum.reg
+    %q0 = quantum.extract %r0[ 0] : !quantum.reg -> !quantum.bit
+    %m, %q1 = quantum.measure %q0 : i1, !quantum.bit
+    %r1 = quantum.insert %r0[ 0], %q1 : !quantum.reg, !quantum.bit
+    %q2 = quantum.extract %r1[ 1] : !quantum.reg -> !quantum.bit
+    %q3 = quantum.extract %r1[ 0] : !quantum.reg -> !quantum.bit
+    %q4:2 = quantum.custom "CNOT"() %q3, %q2 : !quantum.bit, !quantum.bit
+    %obs = quantum.namedobs %q4#1[ PauliZ] : !quantum.obs
+    %e = quantum.expval %obs : f64
+    %r2 = quantum.insert %r1[ 0], %q4#0 : !quantum.reg, !quantum.bit
+    %r3 = quantum.insert %r2[ 1], %q4#1 : !quantum.reg, !quantum.bit
+    quantum.dealloc %r3 : !quantum.reg
+    return %e : f64
+}
+
+// -----
+
+// CHECK-LABEL: test_state_not_reused
+func.func @test_state_not_reused() -> tensor<4xcomplex<f64>> {
+    // CHECK: quantum.alloc( 2)
+    // CHECK-NOT: scf.if
+    %r0 = quantum.alloc( 2) : !quantum.reg
+    %q0 = quantum.extract %r0[ 0] : !quantum.reg -> !quantum.bit
+    %m, %q1 = quantum.measure %q0 : i1, !quantum.bit
+    %r1 = quantum.insert %r0[ 0], %q1 : !quantum.reg, !quantum.bit
+    %q2 = quantum.extract %r1[ 1] : !quantum.reg -> !quantum.bit
+    %q3 = quantum.custom "Hadamard"() %q2 : !quantum.bit
+    %obs = quantum.compbasis %q3 : !quantum.obs
+    %state = quantum.state %obs : tensor<4xcomplex<f64>>
+    %r2 = quantum.insert %r1[ 1], %q3 : !quantum.reg, !quantum.bit
+    quantum.dealloc %r2 : !quantum.reg
+    return %state : tensor<4xcomplex<f64>>
+}
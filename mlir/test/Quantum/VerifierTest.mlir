@@ -85,6 +85,26 @@ func.func @multirz3(%q0 : !quantum.bit, %theta : f64) {
 
 // -----
 
+func.func @paulirot1(%q0 : !quantum.bit, %q1 : !quantum.bit, %theta : f64) {
+    %q2:2 = quantum.paulirot "XY"(%theta) %q0, %q1 : !quantum.bit, !quantum.bit
+
+    // expected-error@+1 {{expected a Pauli word of length 2, got "XYZ"}}
+    %err:2 = quantum.paulirot "XYZ"(%theta) %q2#0, %q2#1 : !quantum.bit, !quantum.bit
+
+    return
+}
+
+// -----
+
+func.func @paulirot2(%q0 : !quantum.bit, %theta : f64) {
+    // expected-error@+1 {{invalid Pauli word "H"}}
+    %err = quantum.paulirot "H"(%theta) %q0 : !quantum.bit
+
+    return
+}
+
+// -----
+
 func.func @unitary2(%q0 : !quantum.bit, %q1 : !quantum.bit,  %m : tensor<4x4xcomplex<f64>>) {
     // expected-error@+1 {{number of qubits in input (2) and output (1) must be the same}}
     %err = quantum.unitary(%m: tensor<4x4xcomplex<f64>>) %q0, %q1 : !quantum.bit
@@ -105,6 +125,28 @@ func.func @unitary3(%q0 : !quantum.bit, %q1 : !quantum.bit, %m : tensor<4x4xcomp
 
 // -----
 
+func.func @set_state1(%q0 : !quantum.bit, %q1 : !quantum.bit, %state : tensor<4xcomplex<f64>>) {
+    // expected-error@+1 {{The state must be of size 2^(num_qubits)}}
+    %err = quantum.set_state(%state : tensor<4xcomplex<f64>>) %q0 : !quantum.bit
+
+    %out:2 = quantum.set_state(%state : tensor<4xcomplex<f64>>) %q0, %q1 : !quantum.bit, !quantum.bit
+
+    return
+}
+
+// -----
+
+func.func @set_basis_state1(%q0 : !quantum.bit, %q1 : !quantum.bit, %bits : tensor<2xi1>) {
+    // expected-error@+1 {{The basis state must have one bit per qubit}}
+    %err = quantum.set_basis_state(%bits : tensor<2xi1>) %q0 : !quantum.bit
+
+    %out:2 = quantum.set_basis_state(%bits : tensor<2xi1>) %q0, %q1 : !quantum.bit, !quantum.bit
+
+    return
+}
+
+// -----
+
 func.func @controlled1(%1 : !quantum.bit, %2 : !quantum.bit, %3 : !quantum.bit) {
     %true = llvm.mlir.constant (1 : i1) :i1
     %cst = llvm.mlir.constant (6.000000e-01 : f64) : f64
@@ -244,6 +286,54 @@ func.func @sample5(%q : !quantum.bit) {
 
 // -----
 
+func.func @sample6(%q : !quantum.bit) {
+    %obs = quantum.compbasis %q : !quantum.obs
+
+    // expected-error@+1 {{bit-packed samples must have 1D static shape equal to (number of shots)}}
+    %err = quantum.sample %obs { shots=1000 } : tensor<100xi64>
+
+    %samples = quantum.sample %obs { shots=1000 } : tensor<1000xi64>
+
+    return
+}
+
+// -----
+
+func.func @sample7(%q : !quantum.bit) {
+    %obs = quantum.namedobs %q[PauliZ] : !quantum.obs
+
+    // expected-error@+1 {{bit-packed samples are only supported in the computational basis}}
+    %err = quantum.sample %obs { shots=1000 } : tensor<1000xi64>
+
+    return
+}
+
+// -----
+
+func.func @shadow1(%q : !quantum.bit) {
+    %obs = quantum.compbasis %q : !quantum.obs
+
+    // expected-error@+1 {{return tensor must have 2D static shape equal to (number of shots, 2)}}
+    %err = quantum.shadow %obs { shots=1000 } : tensor<1000x1xi64>
+
+    %records = quantum.shadow %obs { shots=1000 } : tensor<1000x2xi64>
+
+    return
+}
+
+// -----
+
+func.func @shadow2(%q : !quantum.bit) {
+    %obs = quantum.namedobs %q[PauliZ] : !quantum.obs
+
+    // expected-error@+1 {{classical shadows must be measured in the computational basis}}
+    %err = quantum.shadow %obs { shots=1000 } : tensor<1000x2xi64>
+
+    return
+}
+
+// -----
+
 func.func @counts1(%q0 : !quantum.bit, %q1 : !quantum.bit) {
     %obs = quantum.namedobs %q0[PauliX] : !quantum.obs
 
@@ -311,6 +401,30 @@ func.func @counts5(%q0 : !quantum.bit, %q1 : !quantum.bit) {
 
 // -----
 
+func.func @counts6(%q0 : !quantum.bit, %q1 : !quantum.bit) {
+    %obs = quantum.compbasis %q0, %q1 : !quantum.obs
+
+    // expected-error@+1 {{number of eigenvalues or counts did not match observable}}
+    %err:2 = quantum.counts %obs { shots=1000, sparse } : tensor<4xf64>, tensor<4xi64>
+
+    %counts:2 = quantum.counts %obs { shots=1000, sparse } : tensor<1000xf64>, tensor<1000xi64>
+
+    return
+}
+
+// -----
+
+func.func @counts7(%q0 : !quantum.bit) {
+    %obs = quantum.namedobs %q0[PauliX] : !quantum.obs
+
+    // expected-error@+1 {{sparse counts are only supported in the computational basis}}
+    %err:2 = quantum.counts %obs { shots=2, sparse } : tensor<2xf64>, tensor<2xi64>
+
+    return
+}
+
+// -----
+
 func.func @probs1(%q0 : !quantum.bit, %q1 : !quantum.bit) {
     %obs = quantum.compbasis %q0, %q1 : !quantum.obs
 
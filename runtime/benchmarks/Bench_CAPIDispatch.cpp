@@ -0,0 +1,144 @@
+// Copyright 2024 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+#include <vector>
+
+#include "QuantumDevice.hpp"
+#include "RuntimeCAPI.h"
+
+#include "TestUtils.hpp"
+
+using namespace Catalyst::Runtime;
+
+/**
+ * Benchmarks of the C-API entry points emitted by the compiler. These measure
+ * the overhead of dispatching an instruction through the global execution
+ * context, the qubit manager, and the device for small and moderate registers.
+ */
+
+namespace {
+auto getQubits(QirArray *arr, size_t num_qubits) -> std::vector<QUBIT *>
+{
+    std::vector<QUBIT *> qubits(num_qubits);
+    for (size_t i = 0; i < num_qubits; i++) {
+        qubits[i] = *reinterpret_cast<QUBIT **>(__catalyst__rt__array_get_element_ptr_1d(arr, i));
+    }
+    return qubits;
+}
+} // namespace
+
+TEST_CASE("C-API gate dispatch", "[!benchmark][CAPI]")
+{
+    const size_t num_qubits = GENERATE(2, 10, 16);
+    const std::string suffix = " numQubits=" + std::to_string(num_qubits);
+
+    __catalyst__rt__initialize();
+    for (const auto &[rtd_lib, rtd_name, rtd_kwargs] : getDevices()) {
+        __catalyst__rt__device_init((int8_t *)rtd_lib.c_str(), (int8_t *)rtd_name.c_str(),
+                                    (int8_t *)rtd_kwargs.c_str());
+
+        QirArray *arr = __catalyst__rt__qubit_allocate_array(num_qubits);
+        std::vector<QUBIT *> Qs = getQubits(arr, num_qubits);
+
+        BENCHMARK("Hadamard" + suffix) { __catalyst__qis__Hadamard(Qs[0], NO_MODIFIERS); };
+
+        BENCHMARK("RX" + suffix) { __catalyst__qis__RX(0.3, Qs[0], NO_MODIFIERS); };
+
+        BENCHMARK("CNOT" + suffix)
+        {
+            __catalyst__qis__CNOT(Qs[0], Qs[num_qubits - 1], NO_MODIFIERS);
+        };
+
+        BENCHMARK("MultiRZ" + suffix)
+        {
+            __catalyst__qis__MultiRZ(0.3, NO_MODIFIERS, 2, Qs[0], Qs[1]);
+        };
+
+        QUBIT *ctrls[] = {Qs[1]};
+        bool values[] = {true};
+        Modifiers mod = {false, 1, (QUBIT *)ctrls, (bool *)values};
+        BENCHMARK("Controlled RY" + suffix) { __catalyst__qis__RY(0.3, Qs[0], &mod); };
+
+        __catalyst__rt__toggle_recorder(/* activate_cm */ true);
+        BENCHMARK("RX with tape recording" + suffix)
+        {
+            __catalyst__qis__RX(0.3, Qs[0], NO_MODIFIERS);
+        };
+        __catalyst__rt__toggle_recorder(/* activate_cm */ false);
+
+        __catalyst__rt__qubit_release_array(arr);
+        __catalyst__rt__device_release();
+    }
+    __catalyst__rt__finalize();
+}
+
+TEST_CASE("C-API qubit allocation and release", "[!benchmark][CAPI]")
+{
+    const size_t num_qubits = GENERATE(1, 10, 16);
+    const std::string suffix = " numQubits=" + std::to_string(num_qubits);
+
+    __catalyst__rt__initialize();
+    for (const auto &[rtd_lib, rtd_name, rtd_kwargs] : getDevices()) {
+        __catalyst__rt__device_init((int8_t *)rtd_lib.c_str(), (int8_t *)rtd_name.c_str(),
+                                    (int8_t *)rtd_kwargs.c_str());
+
+        BENCHMARK("qubit_allocate_array + qubit_release_array" + suffix)
+        {
+            QirArray *arr = __catalyst__rt__qubit_allocate_array(num_qubits);
+            __catalyst__rt__qubit_release_array(arr);
+        };
+
+        QirArray *arr = __catalyst__rt__qubit_allocate_array(num_qubits);
+        BENCHMARK("qubit_allocate + qubit_release on top of" + suffix)
+        {
+            QUBIT *q = __catalyst__rt__qubit_allocate();
+            __catalyst__rt__qubit_release(q);
+        };
+        __catalyst__rt__qubit_release_array(arr);
+
+        __catalyst__rt__device_release();
+    }
+    __catalyst__rt__finalize();
+}
+
+TEST_CASE("C-API mid-circuit measurement", "[!benchmark][CAPI]")
+{
+    const size_t num_qubits = GENERATE(2, 10, 16);
+    const std::string suffix = " numQubits=" + std::to_string(num_qubits);
+
+    __catalyst__rt__initialize();
+    for (const auto &[rtd_lib, rtd_name, rtd_kwargs] : getDevices()) {
+        __catalyst__rt__device_init((int8_t *)rtd_lib.c_str(), (int8_t *)rtd_name.c_str(),
+                                    (int8_t *)rtd_kwargs.c_str());
+
+        QirArray *arr = __catalyst__rt__qubit_allocate_array(num_qubits);
+        std::vector<QUBIT *> Qs = getQubits(arr, num_qubits);
+        for (auto *q : Qs) {
+            __catalyst__qis__Hadamard(q, NO_MODIFIERS);
+        }
+
+        // Each measurement collapses the state, so re-prepare the measured qubit
+        // to keep the cost of the collapse in the measured region.
+        BENCHMARK("Hadamard + Measure" + suffix)
+        {
+            __catalyst__qis__Hadamard(Qs[0], NO_MODIFIERS);
+            return __catalyst__qis__Measure(Qs[0], -1);
+        };
+
+        __catalyst__rt__qubit_release_array(arr);
+        __catalyst__rt__device_release();
+    }
+    __catalyst__rt__finalize();
+}
@@ -0,0 +1,122 @@
+// Copyright 2024 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+#include <vector>
+
+#include "DataView.hpp"
+#include "MemRefUtils.hpp"
+#include "QuantumDevice.hpp"
+#include "Utils.hpp"
+
+#include "TestUtils.hpp"
+
+using namespace Catalyst::Runtime;
+using namespace Catalyst::Runtime::Simulator;
+
+namespace {
+/**
+ * Prepare an entangled state on all qubits of `sim` so that the sampled
+ * distribution is not concentrated on a single basis state.
+ */
+void prepareState(LightningSimulator &sim, const std::vector<QubitIdType> &Qs)
+{
+    for (const auto &q : Qs) {
+        sim.NamedOperation("RY", {0.7}, {q}, false);
+    }
+    for (size_t i = 1; i < Qs.size(); i++) {
+        sim.NamedOperation("CNOT", {}, {Qs[i - 1], Qs[i]}, false);
+    }
+}
+} // namespace
+
+TEST_CASE("LightningSimulator Sample and Counts throughput", "[!benchmark][Measures]")
+{
+    const size_t num_qubits = GENERATE(4, 12, 20);
+    const size_t shots = GENERATE(1000, 100000);
+    const std::string suffix =
+        " numQubits=" + std::to_string(num_qubits) + " shots=" + std::to_string(shots);
+
+    std::unique_ptr<LightningSimulator> sim = std::make_unique<LightningSimulator>();
+    std::vector<QubitIdType> Qs = sim->AllocateQubits(num_qubits);
+    prepareState(*sim, Qs);
+
+    std::vector<double> samples(shots * num_qubits);
+    MemRefT<double, 2> buffer{samples.data(), samples.data(), 0, {shots, num_qubits}, {1, 1}};
+    DataView<double, 2> view(buffer.data_aligned, buffer.offset, buffer.sizes, buffer.strides);
+
+    BENCHMARK("Sample" + suffix) { sim->Sample(view, shots); };
+
+    std::vector<QubitIdType> wires{Qs[0], Qs[num_qubits - 1]};
+    std::vector<double> psamples(shots * wires.size());
+    MemRefT<double, 2> pbuffer{psamples.data(), psamples.data(), 0, {shots, wires.size()}, {1, 1}};
+    DataView<double, 2> pview(pbuffer.data_aligned, pbuffer.offset, pbuffer.sizes,
+                              pbuffer.strides);
+
+    BENCHMARK("PartialSample" + suffix) { sim->PartialSample(pview, wires, shots); };
+
+    const size_t num_counts = 1UL << num_qubits;
+    std::vector<double> eigvals(num_counts);
+    std::vector<int64_t> counts(num_counts);
+    DataView<double, 1> eview(eigvals);
+    DataView<int64_t, 1> cview(counts);
+
+    BENCHMARK("Counts" + suffix) { sim->Counts(eview, cview, shots); };
+}
+
+TEST_CASE("LightningSimulator Measure", "[!benchmark][Measures]")
+{
+    const size_t num_qubits = GENERATE(4, 12, 20);
+    const std::string suffix = " numQubits=" + std::to_string(num_qubits);
+
+    std::unique_ptr<LightningSimulator> sim = std::make_unique<LightningSimulator>();
+    std::vector<QubitIdType> Qs = sim->AllocateQubits(num_qubits);
+    prepareState(*sim, Qs);
+
+    BENCHMARK("RY + Measure" + suffix)
+    {
+        sim->NamedOperation("RY", {0.7}, {Qs[0]}, false);
+        return sim->Measure(Qs[0], std::nullopt);
+    };
+}
+
+TEST_CASE("LightningSimulator adjoint Gradient", "[!benchmark][Gradient]")
+{
+    const size_t num_qubits = GENERATE(4, 10, 16);
+    const size_t num_layers = 4;
+    const std::string suffix = " numQubits=" + std::to_string(num_qubits) +
+                               " numParams=" + std::to_string(num_qubits * num_layers);
+
+    std::unique_ptr<LightningSimulator> sim = std::make_unique<LightningSimulator>();
+    std::vector<QubitIdType> Qs = sim->AllocateQubits(num_qubits);
+
+    sim->StartTapeRecording();
+    for (size_t l = 0; l < num_layers; l++) {
+        for (const auto &q : Qs) {
+            sim->NamedOperation("RX", {0.1 * static_cast<double>(l + 1)}, {q}, false);
+        }
+        for (size_t i = 1; i < num_qubits; i++) {
+            sim->NamedOperation("CNOT", {}, {Qs[i - 1], Qs[i]}, false);
+        }
+    }
+    ObsIdType obs = sim->Observable(ObsId::PauliZ, {}, {Qs[num_qubits - 1]});
+    sim->Expval(obs);
+    sim->StopTapeRecording();
+
+    std::vector<double> jacobian(num_qubits * num_layers);
+    std::vector<DataView<double, 1>> gradients;
+    gradients.emplace_back(jacobian);
+
+    BENCHMARK("Gradient" + suffix) { sim->Gradient(gradients, {}); };
+}
@@ -0,0 +1,91 @@
+// Copyright 2024 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <complex>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "CacheManager.hpp"
+#include "QubitManager.hpp"
+#include "Utils.hpp"
+
+#include <catch2/catch.hpp>
+
+using namespace Catalyst::Runtime;
+using namespace Catalyst::Runtime::Simulator;
+
+TEST_CASE("QubitManager translation", "[!benchmark][QubitManager]")
+{
+    const size_t num_qubits = GENERATE(4, 16, 64);
+    const std::string suffix = " numQubits=" + std::to_string(num_qubits);
+
+    QubitManager qm = QubitManager();
+    std::vector<QubitIdType> Qs = qm.AllocateRange(0, num_qubits);
+
+    BENCHMARK("getDeviceId" + suffix) { return qm.getDeviceId(Qs[num_qubits - 1]); };
+
+    BENCHMARK("getDeviceIds" + suffix) { return qm.getDeviceIds(Qs); };
+
+    BENCHMARK("isValidQubitId" + suffix) { return qm.isValidQubitId(Qs); };
+
+    BENCHMARK("getSimulatorId" + suffix) { return qm.getSimulatorId(num_qubits - 1); };
+
+    BENCHMARK_ADVANCED("Allocate + Release" + suffix)(Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([&] {
+            QubitIdType q = qm.Allocate(num_qubits);
+            qm.Release(q);
+        });
+    };
+}
+
+TEST_CASE("CacheManager recording", "[!benchmark][CacheManager]")
+{
+    const size_t num_ops = GENERATE(10, 100, 1000);
+    const std::string suffix = " numOps=" + std::to_string(num_ops);
+
+    BENCHMARK_ADVANCED("addOperation" + suffix)(Catch::Benchmark::Chronometer meter)
+    {
+        CacheManager cm = CacheManager();
+        meter.measure([&] {
+            cm.Reset();
+            for (size_t i = 0; i < num_ops; i++) {
+                cm.addOperation("RX", {0.3}, {i % 8}, false);
+            }
+        });
+    };
+
+    BENCHMARK_ADVANCED("addOperation with controls" + suffix)(Catch::Benchmark::Chronometer meter)
+    {
+        CacheManager cm = CacheManager();
+        meter.measure([&] {
+            cm.Reset();
+            for (size_t i = 0; i < num_ops; i++) {
+                cm.addOperation("RY", {0.3}, {i % 8}, false, {}, {(i + 1) % 8}, {true});
+            }
+        });
+    };
+
+    BENCHMARK_ADVANCED("addObservable" + suffix)(Catch::Benchmark::Chronometer meter)
+    {
+        CacheManager cm = CacheManager();
+        meter.measure([&] {
+            cm.Reset();
+            for (size_t i = 0; i < num_ops; i++) {
+                cm.addObservable(static_cast<ObsIdType>(i), MeasurementsT::Expval);
+            }
+        });
+    };
+}
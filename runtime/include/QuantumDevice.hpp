@@ -14,12 +14,19 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
 #include <complex>
+#include <limits>
 #include <memory>
+#include <numbers>
 #include <optional>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "DataView.hpp"
+#include "Exception.hpp"
 #include "Types.h"
 
 // A helper template macro to generate the <IDENTIFIER>Factory method by
@@ -103,6 +110,98 @@ struct QuantumDevice {
      */
     [[nodiscard]] virtual auto GetDeviceShots() const -> size_t = 0;
 
+    /**
+     * @brief Seed the pseudo random number generator of the device.
+     *
+     * @note Devices without a seedable source of randomness can ignore the seed.
+     * The default implementation does nothing.
+     *
+     * @param seed The seed value
+     */
+    virtual void SetDeviceSeed([[maybe_unused]] uint64_t seed) {}
+
+    /**
+     * @brief Start a batched execution of `batch_size` runs of the same circuit, each run being
+     * a lane of the batch.
+     *
+     * @note The runtime runs the circuit of every lane twice. In the first sweep, the device
+     * records the operations and measurements of each lane; `ExecuteBatch` then simulates all
+     * the lanes at once; and in the second sweep, the device returns the measurement results of
+     * each lane in the recorded order. The default implementation does not support batching.
+     *
+     * @param batch_size The number of lanes of the batch
+     */
+    virtual void StartBatch([[maybe_unused]] size_t batch_size)
+    {
+        RT_FAIL("Batched execution is not supported by this device");
+    }
+
+    /**
+     * @brief Select the lane of the batch that the following instructions belong to.
+     *
+     * @param lane The lane of the batch
+     */
+    virtual void SetBatchLane([[maybe_unused]] size_t lane)
+    {
+        RT_FAIL("Batched execution is not supported by this device");
+    }
+
+    /**
+     * @brief Simulate the recorded circuits of all the lanes of the batch.
+     */
+    virtual void ExecuteBatch() { RT_FAIL("Batched execution is not supported by this device"); }
+
+    /**
+     * @brief Stop the batched execution and return to executing instructions one by one.
+     */
+    virtual void StopBatch() { RT_FAIL("Batched execution is not supported by this device"); }
+
+    /**
+     * @brief Take a snapshot of the state of the allocated qubits.
+     *
+     * @note The default implementation does not support snapshots.
+     *
+     * @return `size_t` The id of the snapshot
+     */
+    virtual auto Snapshot() -> size_t
+    {
+        RT_FAIL("State snapshots are not supported by this device");
+    }
+
+    /**
+     * @brief Restore the state of the allocated qubits from a snapshot of the same qubits. The
+     * snapshot remains valid and can be restored again.
+     *
+     * @param id The id of the snapshot
+     */
+    virtual void Restore([[maybe_unused]] size_t id)
+    {
+        RT_FAIL("State snapshots are not supported by this device");
+    }
+
+    /**
+     * @brief Release a snapshot of the state.
+     *
+     * @param id The id of the snapshot
+     */
+    virtual void ReleaseSnapshot([[maybe_unused]] size_t id)
+    {
+        RT_FAIL("State snapshots are not supported by this device");
+    }
+
+    /**
+     * @brief Mark the point of the circuit before a gate that may differ between the consecutive
+     * executions of variants of the same circuit, such as the shifted circuits of the
+     * parameter-shift rule.
+     *
+     * @note Devices can snapshot the state at a diverging point and restore it in the next
+     * executions instead of simulating the common prefix again. Every instruction must still
+     * produce the same results as without checkpoints. The default implementation does nothing.
+     *
+     * @param diverges Whether the following gate differs from the previous executions
+     */
+    virtual void Checkpoint([[maybe_unused]] bool diverges) {}
+
     /**
      * @brief Start recording a quantum tape if provided.
      *
@@ -170,6 +269,148 @@ struct QuantumDevice {
                     [[maybe_unused]] const std::vector<QubitIdType> &controlled_wires = {},
                     [[maybe_unused]] const std::vector<bool> &controlled_values = {}) = 0;
 
+    /**
+     * @brief Apply the quantum Fourier transform to the state vector of a device, with the
+     * first wire being the most significant bit of the transformed index.
+     *
+     * @note The default implementation applies the decomposition of the transform into Hadamard,
+     * ControlledPhaseShift, and SWAP gates. Devices can override it with a native implementation.
+     *
+     * @param wires Wires to apply the transform to
+     * @param inverse Indicates whether to apply the inverse transform
+     * @param controlled_wires Optional controlled wires applied to the operation
+     * @param controlled_values Optional controlled values applied to the operation
+     */
+    virtual void QFT(const std::vector<QubitIdType> &wires, bool inverse = false,
+                     const std::vector<QubitIdType> &controlled_wires = {},
+                     const std::vector<bool> &controlled_values = {})
+    {
+        struct Gate {
+            std::string name;
+            std::vector<double> params;
+            std::vector<QubitIdType> wires;
+        };
+
+        const size_t num_wires = wires.size();
+        std::vector<Gate> gates;
+        for (size_t i = 0; i < num_wires; i++) {
+            gates.push_back({"Hadamard", {}, {wires[i]}});
+            for (size_t j = i + 1; j < num_wires; j++) {
+                const double phi = std::ldexp(std::numbers::pi, -static_cast<int>(j - i));
+                gates.push_back({"ControlledPhaseShift", {phi}, {wires[j], wires[i]}});
+            }
+        }
+        for (size_t i = 0; i < num_wires / 2; i++) {
+            gates.push_back({"SWAP", {}, {wires[i], wires[num_wires - 1 - i]}});
+        }
+
+        auto apply = [&](const Gate &gate) {
+            NamedOperation(gate.name, gate.params, gate.wires, inverse, controlled_wires,
+                           controlled_values);
+        };
+        if (!inverse) {
+            std::for_each(gates.begin(), gates.end(), apply);
+        }
+        else {
+            std::for_each(gates.rbegin(), gates.rend(), apply);
+        }
+    }
+
+    /**
+     * @brief Apply the rotation `exp(-i theta/2 P)` about a Pauli word `P` to the state vector of
+     * a device.
+     *
+     * @note The default implementation maps the X and Y factors of the word to the Z basis with
+     * Hadamard and S gates, and applies a MultiRZ rotation to the non-identity factors. A word of
+     * identities only is applied as a global phase. Devices can override it with a native
+     * implementation.
+     *
+     * @param pauli_word Pauli operator (`I`, `X`, `Y`, or `Z`) applied to each wire
+     * @param theta Rotation angle
+     * @param wires Wires to apply the rotation to
+     * @param inverse Indicates whether to apply the inverse rotation
+     * @param controlled_wires Optional controlled wires applied to the operation
+     * @param controlled_values Optional controlled values applied to the operation
+     */
+    virtual void PauliRotation(const std::string &pauli_word, double theta,
+                               const std::vector<QubitIdType> &wires, bool inverse = false,
+                               const std::vector<QubitIdType> &controlled_wires = {},
+                               const std::vector<bool> &controlled_values = {})
+    {
+        std::vector<QubitIdType> rotated_wires;
+        for (size_t i = 0; i < wires.size(); i++) {
+            if (pauli_word[i] != 'I') {
+                rotated_wires.push_back(wires[i]);
+            }
+        }
+        if (rotated_wires.empty()) {
+            NamedOperation("GlobalPhase", {theta / 2}, {}, inverse, controlled_wires,
+                           controlled_values);
+            return;
+        }
+
+        // The basis changes cancel out when the controls are not satisfied, so only the rotation
+        // itself needs to be controlled.
+        auto change_basis = [&](bool to_z) {
+            for (size_t i = 0; i < wires.size(); i++) {
+                if (pauli_word[i] == 'X') {
+                    NamedOperation("Hadamard", {}, {wires[i]});
+                }
+                else if (pauli_word[i] == 'Y' && to_z) {
+                    NamedOperation("S", {}, {wires[i]}, true);
+                    NamedOperation("Hadamard", {}, {wires[i]});
+                }
+                else if (pauli_word[i] == 'Y') {
+                    NamedOperation("Hadamard", {}, {wires[i]});
+                    NamedOperation("S", {}, {wires[i]});
+                }
+            }
+        };
+        change_basis(true);
+        NamedOperation("MultiRZ", {theta}, rotated_wires, inverse, controlled_wires,
+                       controlled_values);
+        change_basis(false);
+    }
+
+    /**
+     * @brief Prepare `wires` in the given state.
+     *
+     * @note The wires must be in the all-zero state, and the amplitudes are given in the
+     * computational basis order of `wires`, the first wire being the most significant. The
+     * default implementation does not support state preparation, which the frontend then
+     * decomposes into gates.
+     *
+     * @param state The normalized state vector of size `2^wires.size()`
+     * @param wires Wires to prepare the state on
+     */
+    virtual void SetState([[maybe_unused]] DataView<std::complex<double>, 1> &state,
+                          [[maybe_unused]] const std::vector<QubitIdType> &wires)
+    {
+        RT_FAIL("State preparation is not supported by this device");
+    }
+
+    /**
+     * @brief Prepare `wires` in a computational basis state.
+     *
+     * @note The wires must be in the all-zero state. The default implementation applies a
+     * PauliX gate to every wire whose bit is set.
+     *
+     * @param bits One bit per wire
+     * @param wires Wires to prepare the basis state on
+     */
+    virtual void SetBasisState(DataView<int8_t, 1> &bits, const std::vector<QubitIdType> &wires)
+    {
+        RT_FAIL_IF(bits.size() != wires.size(), "Invalid number of bits for the given qubits");
+
+        size_t i = 0;
+        for (auto bit : bits) {
+            if (bit) {
+                NamedOperation("PauliX", {}, {wires[i]});
+            }
+            i++;
+        }
+    }
+
     /**
      * @brief Construct a named (Identity, PauliX, PauliY, PauliZ, and Hadamard)
      * or Hermitian observable.
@@ -221,6 +462,35 @@ struct QuantumDevice {
      */
     virtual auto Var(ObsIdType obsKey) -> double = 0;
 
+    /**
+     * @brief Compute both the expected value and the variance of an observable.
+     *
+     * @note Devices can compute both from a single application of the observable to the state.
+     * The default implementation calls `Expval` and `Var`.
+     *
+     * @param obsKey The index of the constructed observable
+     *
+     * @return `std::pair<double, double>` The expected value and the variance
+     */
+    virtual auto ExpvalVar(ObsIdType obsKey) -> std::pair<double, double>
+    {
+        return {Expval(obsKey), Var(obsKey)};
+    }
+
+    /**
+     * @brief Announce the expectation values and variances of the given observables that are
+     * measured next.
+     *
+     * @note Devices with finite shots can estimate the measurements of observables that
+     * qubit-wise commute from a single set of samples, instead of drawing a new set for each
+     * measurement. Each observable of the group must then be measured at most once, and no
+     * instruction may change the state before the last of these measurements. The default
+     * implementation does nothing.
+     *
+     * @param obsKeys The vector of observable keys
+     */
+    virtual void GroupMeasurements([[maybe_unused]] const std::vector<ObsIdType> &obsKeys) {}
+
     /**
      * @brief Get the state-vector of a device.
      *
@@ -268,6 +538,70 @@ struct QuantumDevice {
     virtual void PartialSample(DataView<double, 2> &samples, const std::vector<QubitIdType> &wires,
                                size_t shots) = 0;
 
+    /**
+     * @brief Compute bit-packed samples with the number of shots on the entire wires,
+     * returning the index of each sampled basis state.
+     *
+     * @note The first wire is the most significant bit of each index, which limits bit-packed
+     * samples to 64 wires. The default implementation packs the samples returned by `Sample`.
+     *
+     * @param samples The pre-allocated `DataView<int64_t, 1>` of size `shots`
+     * @param shots The number of shots
+     */
+    virtual void PackedSample(DataView<int64_t, 1> &samples, size_t shots)
+    {
+        const size_t num_qubits = GetNumQubits();
+        std::vector<double> bits(shots * num_qubits);
+        size_t sizes[2] = {shots, num_qubits};
+        size_t strides[2] = {num_qubits, 1};
+        DataView<double, 2> bits_view(bits.data(), 0, sizes, strides);
+        Sample(bits_view, shots);
+        storePackedSamples(samples, packSamples(bits, num_qubits, shots));
+    }
+
+    /**
+     * @brief Compute bit-packed partial samples with the number of shots on `wires`,
+     * returning the index of each sampled basis state of `wires`.
+     *
+     * @note See `PackedSample`. The default implementation packs the samples returned by
+     * `PartialSample`.
+     *
+     * @param samples The pre-allocated `DataView<int64_t, 1>` of size `shots`
+     * @param wires Wires to compute samples on
+     * @param shots The number of shots
+     */
+    virtual void PartialPackedSample(DataView<int64_t, 1> &samples,
+                                     const std::vector<QubitIdType> &wires, size_t shots)
+    {
+        const size_t num_wires = wires.size();
+        std::vector<double> bits(shots * num_wires);
+        size_t sizes[2] = {shots, num_wires};
+        size_t strides[2] = {num_wires, 1};
+        DataView<double, 2> bits_view(bits.data(), 0, sizes, strides);
+        PartialSample(bits_view, wires, shots);
+        storePackedSamples(samples, packSamples(bits, num_wires, shots));
+    }
+
+    /**
+     * @brief Measure a classical shadow of `wires` with the number of shots, measuring every wire
+     * of every shot in a basis drawn uniformly at random among the X, Y and Z Pauli bases.
+     *
+     * @note Each shot is recorded as a pair of 64-bit words: the bases, packed with 2 bits per
+     * wire (1 for X, 2 for Y and 3 for Z), and the outcomes, packed with 1 bit per wire. The first
+     * wire is the most significant in both words, which limits classical shadows to 32 wires.
+     * The default implementation does not support classical shadows.
+     *
+     * @param records The pre-allocated `DataView<int64_t, 2>` of shape `(shots, 2)`
+     * @param wires Wires to measure the classical shadow of
+     * @param shots The number of shots
+     */
+    virtual void Shadow([[maybe_unused]] DataView<int64_t, 2> &records,
+                        [[maybe_unused]] const std::vector<QubitIdType> &wires,
+                        [[maybe_unused]] size_t shots)
+    {
+        RT_FAIL("Classical shadows are not supported by this device");
+    }
+
     /**
      * @brief Sample with the number of shots on the entire wires, returning the
      * number of counts for each sample.
@@ -291,6 +625,55 @@ struct QuantumDevice {
     virtual void PartialCounts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts,
                                const std::vector<QubitIdType> &wires, size_t shots) = 0;
 
+    /**
+     * @brief Sample with the number of shots on the entire wires, returning the
+     * number of counts for each observed sample only.
+     *
+     * @note At most `shots` of the `2^numQubits` possible samples can be observed. The
+     * distinct samples are stored first in increasing order, and the remaining entries are
+     * padded with a sample of -1 and a count of 0. The default implementation counts the
+     * samples returned by `Sample`.
+     *
+     * @param eigvals The pre-allocated `DataView<double, 1>` of size `shots`
+     * @param counts The pre-allocated `DataView<int64_t, 1>` of size `shots`
+     * @param shots The number of shots
+     */
+    virtual void SparseCounts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts,
+                              size_t shots)
+    {
+        const size_t num_qubits = GetNumQubits();
+        std::vector<double> samples(shots * num_qubits);
+        size_t sizes[2] = {shots, num_qubits};
+        size_t strides[2] = {num_qubits, 1};
+        DataView<double, 2> samples_view(samples.data(), 0, sizes, strides);
+        Sample(samples_view, shots);
+        countSparse(eigvals, counts, samples, num_qubits, shots);
+    }
+
+    /**
+     * @brief Partial sample with the number of shots on `wires`, returning the
+     * number of counts for each observed sample only.
+     *
+     * @note See `SparseCounts`. The default implementation counts the samples returned by
+     * `PartialSample`.
+     *
+     * @param eigvals The pre-allocated `DataView<double, 1>` of size `shots`
+     * @param counts The pre-allocated `DataView<int64_t, 1>` of size `shots`
+     * @param wires Wires to compute samples on
+     * @param shots The number of shots
+     */
+    virtual void PartialSparseCounts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts,
+                                     const std::vector<QubitIdType> &wires, size_t shots)
+    {
+        const size_t num_wires = wires.size();
+        std::vector<double> samples(shots * num_wires);
+        size_t sizes[2] = {shots, num_wires};
+        size_t strides[2] = {num_wires, 1};
+        DataView<double, 2> samples_view(samples.data(), 0, sizes, strides);
+        PartialSample(samples_view, wires, shots);
+        countSparse(eigvals, counts, samples, num_wires, shots);
+    }
+
     /**
      * @brief A general measurement method that acts on a single wire.
      *
@@ -315,5 +698,63 @@ struct QuantumDevice {
      */
     virtual void Gradient(std::vector<DataView<double, 1>> &gradients,
                           const std::vector<size_t> &trainParams) = 0;
+
+  protected:
+    /**
+     * @brief Pack `shots` samples of `num_wires` bits laid out row-wise into the index of each
+     * sampled basis state, with the first wire being the most significant bit.
+     */
+    static auto packSamples(const std::vector<double> &samples, size_t num_wires, size_t shots)
+        -> std::vector<uint64_t>
+    {
+        RT_FAIL_IF(num_wires > static_cast<size_t>(std::numeric_limits<uint64_t>::digits),
+                   "Too many wires to pack the samples of");
+
+        std::vector<uint64_t> outcomes(shots);
+        for (size_t shot = 0; shot < shots; shot++) {
+            uint64_t outcome = 0;
+            for (size_t wire = 0; wire < num_wires; wire++) {
+                outcome = (outcome << 1) | static_cast<uint64_t>(samples[shot * num_wires + wire]);
+            }
+            outcomes[shot] = outcome;
+        }
+        return outcomes;
+    }
+
+    static void storePackedSamples(DataView<int64_t, 1> &samples,
+                                   const std::vector<uint64_t> &outcomes)
+    {
+        RT_FAIL_IF(samples.size() != outcomes.size(),
+                   "Invalid size for the pre-allocated packed samples");
+        std::transform(outcomes.begin(), outcomes.end(), samples.begin(),
+                       [](uint64_t outcome) { return static_cast<int64_t>(outcome); });
+    }
+
+    /**
+     * @brief Store the sparse counts of `shots` samples of `num_wires` bits laid out row-wise,
+     * with the first wire being the most significant bit of each sample.
+     */
+    static void countSparse(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts,
+                            const std::vector<double> &samples, size_t num_wires, size_t shots)
+    {
+        RT_FAIL_IF(num_wires > static_cast<size_t>(std::numeric_limits<double>::digits),
+                   "Too many wires to store the samples of sparse counts as doubles");
+        RT_FAIL_IF(eigvals.size() != shots || counts.size() != shots,
+                   "Invalid size for the pre-allocated sparse counts");
+
+        auto outcomes = packSamples(samples, num_wires, shots);
+        std::sort(outcomes.begin(), outcomes.end());
+
+        std::fill(eigvals.begin(), eigvals.end(), -1);
+        std::fill(counts.begin(), counts.end(), 0);
+        size_t idx = 0;
+        for (size_t shot = 0; shot < shots; shot++) {
+            if (shot && outcomes[shot] != outcomes[shot - 1]) {
+                idx++;
+            }
+            eigvals(idx) = static_cast<double>(outcomes[shot]);
+            counts(idx) += 1;
+        }
+    }
 };
 } // namespace Catalyst::Runtime
@@ -29,6 +29,11 @@ void __catalyst__rt__device_init(int8_t *, int8_t *, int8_t *);
 void __catalyst__rt__device_release();
 void __catalyst__rt__finalize();
 void __catalyst__rt__toggle_recorder(bool);
+void __catalyst__rt__batch_begin(int64_t);
+void __catalyst__rt__batch_lane(int64_t);
+void __catalyst__rt__batch_execute();
+void __catalyst__rt__batch_end();
+void __catalyst__rt__checkpoint(bool);
 void __catalyst__rt__print_state();
 void __catalyst__rt__print_tensor(OpaqueMemRefT *, bool);
 void __catalyst__rt__print_string(char *);
@@ -78,11 +83,15 @@ void __catalyst__qis__MultiRZ(double, const Modifiers *, int64_t, /*qubits*/...)
 void __catalyst__qis__GlobalPhase(double, const Modifiers *);
 void __catalyst__qis__ISWAP(QUBIT *, QUBIT *, const Modifiers *);
 void __catalyst__qis__PSWAP(double, QUBIT *, QUBIT *, const Modifiers *);
+void __catalyst__qis__QFT(const Modifiers *, int64_t, QUBIT **);
+void __catalyst__qis__PauliRot(double, const char *, const Modifiers *, int64_t, QUBIT **);
 
 // Struct pointer arguments for these instructions represent real arguments,
 // as passing structs by value is too unreliable / compiler dependant.
 void __catalyst__qis__QubitUnitary(MemRefT_CplxT_double_2d *, const Modifiers *, int64_t,
                                    /*qubits*/...);
+void __catalyst__qis__SetState(MemRefT_CplxT_double_1d *, int64_t, QUBIT **);
+void __catalyst__qis__SetBasisState(MemRefT_int8_1d *, int64_t, QUBIT **);
 
 ObsIdType __catalyst__qis__NamedObs(int64_t, QUBIT *);
 ObsIdType __catalyst__qis__HermitianObs(MemRefT_CplxT_double_2d *, int64_t, /*qubits*/...);
@@ -93,13 +102,39 @@ ObsIdType __catalyst__qis__HamiltonianObs(MemRefT_double_1d *, int64_t, /*obsKey
 RESULT *__catalyst__qis__Measure(QUBIT *, int32_t);
 double __catalyst__qis__Expval(ObsIdType);
 double __catalyst__qis__Variance(ObsIdType);
+void __catalyst__qis__ExpvalVar(double *, ObsIdType);
+void __catalyst__qis__MeasurementGroup(int64_t, /*obsKeys*/...);
 void __catalyst__qis__Probs(MemRefT_double_1d *, int64_t, /*qubits*/...);
 void __catalyst__qis__Sample(MemRefT_double_2d *, int64_t, int64_t, /*qubits*/...);
+void __catalyst__qis__PackedSample(MemRefT_int64_1d *, int64_t, int64_t, /*qubits*/...);
+void __catalyst__qis__Shadow(MemRefT_int64_2d *, int64_t, int64_t, /*qubits*/...);
 void __catalyst__qis__Counts(PairT_MemRefT_double_int64_1d *, int64_t, int64_t, /*qubits*/...);
+void __catalyst__qis__SparseCounts(PairT_MemRefT_double_int64_1d *, int64_t, int64_t,
+                                   /*qubits*/...);
 void __catalyst__qis__State(MemRefT_CplxT_double_1d *, int64_t, /*qubits*/...);
 void __catalyst__qis__Gradient(int64_t, /*results*/...);
 void __catalyst__qis__Gradient_params(MemRefT_int64_1d *, int64_t, /*results*/...);
 
+// Array-based variants of the variadic instructions above, taking the number of qubits,
+// observables or results followed by a pointer to an array of them. These are the ones
+// generated by the compiler, as they are cheaper to call than the variadic versions.
+void __catalyst__qis__MultiRZ_array(double, const Modifiers *, int64_t, QUBIT **);
+void __catalyst__qis__QubitUnitary_array(MemRefT_CplxT_double_2d *, const Modifiers *, int64_t,
+                                         QUBIT **);
+ObsIdType __catalyst__qis__HermitianObs_array(MemRefT_CplxT_double_2d *, int64_t, QUBIT **);
+ObsIdType __catalyst__qis__TensorObs_array(int64_t, ObsIdType *);
+ObsIdType __catalyst__qis__HamiltonianObs_array(MemRefT_double_1d *, int64_t, ObsIdType *);
+void __catalyst__qis__MeasurementGroup_array(int64_t, ObsIdType *);
+void __catalyst__qis__Probs_array(MemRefT_double_1d *, int64_t, QUBIT **);
+void __catalyst__qis__Sample_array(MemRefT_double_2d *, int64_t, int64_t, QUBIT **);
+void __catalyst__qis__PackedSample_array(MemRefT_int64_1d *, int64_t, int64_t, QUBIT **);
+void __catalyst__qis__Shadow_array(MemRefT_int64_2d *, int64_t, int64_t, QUBIT **);
+void __catalyst__qis__Counts_array(PairT_MemRefT_double_int64_1d *, int64_t, int64_t, QUBIT **);
+void __catalyst__qis__SparseCounts_array(PairT_MemRefT_double_int64_1d *, int64_t, int64_t,
+                                         QUBIT **);
+void __catalyst__qis__State_array(MemRefT_CplxT_double_1d *, int64_t, QUBIT **);
+void __catalyst__qis__Gradient_array(int64_t, MemRefT_double_1d **);
+
 void __catalyst__host__rt__unrecoverable_error();
 
 #ifdef __cplusplus
@@ -32,6 +32,14 @@ typedef bool RESULT;
 typedef RESULT *Result;
 typedef void *QirArray;
 
+// Layout of the qubit arrays returned by `__catalyst__rt__qubit_allocate_array`.
+// The compiler lowers `quantum.extract` to direct loads of `data[idx]`, so the
+// position of `data` as the first field is part of the ABI.
+struct QirQubitArray {
+    QubitIdType *data;
+    int64_t size;
+};
+
 typedef intptr_t ObsIdType;
 
 enum ObsId : int8_t {
@@ -117,6 +125,15 @@ struct MemRefT_double_2d {
     size_t strides[2];
 };
 
+// MemRefT<int8_t, dimension=1> type
+struct MemRefT_int8_1d {
+    int8_t *data_allocated;
+    int8_t *data_aligned;
+    size_t offset;
+    size_t sizes[1];
+    size_t strides[1];
+};
+
 // MemRefT<int64_t, dimension=1> type
 struct MemRefT_int64_1d {
     int64_t *data_allocated;
@@ -126,6 +143,15 @@ struct MemRefT_int64_1d {
     size_t strides[1];
 };
 
+// MemRefT<int64_t, dimension=2> type
+struct MemRefT_int64_2d {
+    int64_t *data_allocated;
+    int64_t *data_aligned;
+    size_t offset;
+    size_t sizes[2];
+    size_t strides[2];
+};
+
 // PairT<MemRefT<double, dimension=1>, MemRefT<int64, dimension=2>> type
 struct PairT_MemRefT_double_int64_1d {
     struct MemRefT_double_1d first;
@@ -145,7 +171,9 @@ typedef struct MemRefT_CplxT_double_1d MemRefT_CplxT_double_1d;
 typedef struct MemRefT_CplxT_double_2d MemRefT_CplxT_double_2d;
 typedef struct MemRefT_double_1d MemRefT_double_1d;
 typedef struct MemRefT_double_2d MemRefT_double_2d;
+typedef struct MemRefT_int8_1d MemRefT_int8_1d;
 typedef struct MemRefT_int64_1d MemRefT_int64_1d;
+typedef struct MemRefT_int64_2d MemRefT_int64_2d;
 typedef struct PairT_MemRefT_double_int64_1d PairT_MemRefT_double_int64_1d;
 typedef struct Modifiers Modifiers;
 
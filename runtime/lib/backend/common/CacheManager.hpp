@@ -104,6 +104,57 @@ template <typename ComplexT = std::complex<double>> class CacheManager {
         num_params_ += params.size();
     }
 
+    /**
+     * @brief Add a rotation `exp(-i theta/2 P)` about a Pauli word `P` to the list of cached
+     * gates.
+     *
+     * The rotation is cached as its decomposition into a MultiRZ rotation of the non-identity
+     * factors of the word, conjugated by non-parametric basis changes (Hadamard for X, and S^dagger
+     * and Hadamard for Y). The rotation angle is thus the only cached parameter, and gradient
+     * methods working on the cached gates differentiate it as a MultiRZ generator.
+     *
+     * @param pauli_word Pauli operator (`I`, `X`, `Y`, or `Z`) applied to each wire
+     * @param theta Rotation angle
+     * @param wires Wires the rotation acts on
+     * @param inverse If true, inverse of the rotation is applied
+     * @param controlled_wires Control wires
+     * @param controlled_values Control values
+     */
+    void addPauliRotation(const std::string &pauli_word, double theta,
+                          const std::vector<size_t> &wires, bool inverse,
+                          const std::vector<size_t> &controlled_wires = {},
+                          const std::vector<bool> &controlled_values = {})
+    {
+        std::vector<size_t> rotated_wires;
+        for (size_t i = 0; i < wires.size(); i++) {
+            if (pauli_word[i] != 'I') {
+                rotated_wires.push_back(wires[i]);
+            }
+        }
+        RT_FAIL_IF(rotated_wires.empty(),
+                   "Cannot cache a Pauli rotation about the identity for differentiation");
+
+        auto change_basis = [&](bool to_z) {
+            for (size_t i = 0; i < wires.size(); i++) {
+                if (pauli_word[i] == 'X') {
+                    addOperation("Hadamard", {}, {wires[i]}, false);
+                }
+                else if (pauli_word[i] == 'Y' && to_z) {
+                    addOperation("S", {}, {wires[i]}, true);
+                    addOperation("Hadamard", {}, {wires[i]}, false);
+                }
+                else if (pauli_word[i] == 'Y') {
+                    addOperation("Hadamard", {}, {wires[i]}, false);
+                    addOperation("S", {}, {wires[i]}, false);
+                }
+            }
+        };
+        change_basis(true);
+        addOperation("MultiRZ", {theta}, rotated_wires, inverse, {}, controlled_wires,
+                     controlled_values);
+        change_basis(false);
+    }
+
     /**
      * @brief Add a new observable to the list of cached gates.
      *
@@ -0,0 +1,100 @@
+// Copyright 2024 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Catalyst::Runtime {
+
+/**
+ * @brief A counter-based Philox4x32-10 pseudo random number generator.
+ *
+ * Unlike stateful engines such as `std::mt19937`, every output block is a pure
+ * function of a 64-bit key and a 128-bit counter. This allows parallel workers
+ * to draw from disjoint substreams (e.g. one counter per shot) without any
+ * synchronization, and the results are identical for any partitioning of the
+ * counter space across threads.
+ *
+ * Reference: J. K. Salmon et al., "Parallel random numbers: as easy as 1, 2, 3",
+ * SC '11, https://doi.org/10.1145/2063384.2063405
+ */
+class Philox4x32 {
+  public:
+    using CounterT = std::array<uint32_t, 4>;
+    using KeyT = std::array<uint32_t, 2>;
+
+  private:
+    static constexpr uint32_t M0 = 0xD2511F53;
+    static constexpr uint32_t M1 = 0xCD9E8D57;
+    static constexpr uint32_t W0 = 0x9E3779B9;
+    static constexpr uint32_t W1 = 0xBB67AE85;
+    static constexpr std::size_t num_rounds = 10;
+
+    KeyT key_;
+
+    static inline void _round(CounterT &ctr, const KeyT &key)
+    {
+        const uint64_t prod0 = static_cast<uint64_t>(M0) * ctr[0];
+        const uint64_t prod1 = static_cast<uint64_t>(M1) * ctr[2];
+        const auto hi0 = static_cast<uint32_t>(prod0 >> 32);
+        const auto lo0 = static_cast<uint32_t>(prod0);
+        const auto hi1 = static_cast<uint32_t>(prod1 >> 32);
+        const auto lo1 = static_cast<uint32_t>(prod1);
+        ctr = {hi1 ^ ctr[1] ^ key[0], lo1, hi0 ^ ctr[3] ^ key[1], lo0};
+    }
+
+  public:
+    explicit Philox4x32(uint64_t seed = 0)
+        : key_{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)}
+    {
+    }
+
+    /**
+     * @brief Compute the random block of a given counter.
+     *
+     * @param ctr The 128-bit counter
+     * @return `CounterT` Four independent uniformly distributed 32-bit words
+     */
+    [[nodiscard]] auto operator()(CounterT ctr) const -> CounterT
+    {
+        KeyT key = key_;
+        for (std::size_t r = 0; r < num_rounds; r++) {
+            _round(ctr, key);
+            key[0] += W0;
+            key[1] += W1;
+        }
+        return ctr;
+    }
+
+    /**
+     * @brief Draw a double in [0, 1) for the `index`-th element of substream `stream`.
+     *
+     * @param stream The substream id (e.g. the sampling call)
+     * @param index The position within the substream (e.g. the shot number)
+     * @return `double` A uniformly distributed value with 53 bits of randomness
+     */
+    [[nodiscard]] auto uniform(uint64_t stream, uint64_t index) const -> double
+    {
+        const auto block =
+            (*this)({static_cast<uint32_t>(index), static_cast<uint32_t>(index >> 32),
+                     static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32)});
+        const uint64_t bits = (static_cast<uint64_t>(block[0]) << 32 | block[1]) >> 11;
+        return static_cast<double>(bits) * 0x1.0p-53;
+    }
+};
+
+} // namespace Catalyst::Runtime
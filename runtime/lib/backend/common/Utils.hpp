@@ -16,16 +16,26 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <mutex>
+#include <numbers>
+#include <numeric>
 #include <optional>
 #include <random>
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <tuple>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "Exception.hpp"
+#include "Philox.hpp"
 #include "Types.h"
 
 #define QUANTUM_DEVICE_DEL_DECLARATIONS(CLASSNAME)                                                 \
@@ -271,8 +281,8 @@ constexpr auto has_gate(const SimulatorGateInfoDataT<size> &arr, const std::stri
     return false;
 }
 
-static inline auto simulateDraw(const std::vector<double> &probs, std::optional<int32_t> postselect)
-    -> bool
+static inline auto simulateDraw(const std::vector<double> &probs, std::optional<int32_t> postselect,
+                                double draw) -> bool
 {
     if (postselect) {
         auto postselect_value = postselect.value();
@@ -284,12 +294,678 @@ static inline auto simulateDraw(const std::vector<double> &probs, std::optional<
     }
 
     // Normal flow, no post-selection
+    return draw > probs[0];
+}
+
+static inline auto simulateDraw(const std::vector<double> &probs, std::optional<int32_t> postselect)
+    -> bool
+{
     // Draw a number according to the given distribution
     std::random_device rd;
     std::mt19937 gen(rd());
     std::uniform_real_distribution<> dis(0., 1.);
-    float draw = dis(gen);
-    return draw > probs[0];
+    return simulateDraw(probs, postselect, dis(gen));
+}
+
+/**
+ * @brief Split `size` work items over `num_threads` worker threads.
+ *
+ * @param size The number of work items
+ * @param num_threads The number of worker threads
+ * @param fn The function called with the range `[begin, end)` of work items of each thread
+ */
+template <typename Fn>
+static inline void parallelFor(size_t size, size_t num_threads, Fn &&fn)
+{
+    if (num_threads <= 1) {
+        fn(size_t{0}, size);
+        return;
+    }
+
+    const size_t chunk = (size + num_threads - 1) / num_threads;
+    std::vector<std::thread> workers;
+    workers.reserve(num_threads);
+    for (size_t t = 0; t < num_threads; t++) {
+        const size_t begin = t * chunk;
+        const size_t end = std::min(size, begin + chunk);
+        if (begin >= end) {
+            break;
+        }
+        workers.emplace_back(fn, begin, end);
+    }
+    for (auto &worker : workers) {
+        worker.join();
+    }
+}
+
+/**
+ * @brief Get the number of worker threads to split `shots` shots over, such that every thread
+ * gets enough shots to amortize its startup.
+ *
+ * @param shots The number of shots
+ * @param num_threads The requested number of worker threads (0 denotes hardware concurrency)
+ */
+static inline auto getNumShotThreads(size_t shots, size_t num_threads) -> size_t
+{
+    constexpr size_t min_shots_per_thread = 1024;
+
+    if (!num_threads) {
+        num_threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    return std::min(num_threads, std::max<size_t>(shots / min_shots_per_thread, 1));
+}
+
+/**
+ * @brief Draw the indices of computational basis states from a probability distribution
+ * using multiple threads.
+ *
+ * The cumulative distribution is built once and every shot is drawn by inverse
+ * transform sampling from its own Philox substream `(stream, shot)`. As a result,
+ * the samples only depend on the generator key and `stream`, and not on the number
+ * of threads the shots are split over.
+ *
+ * @param probs The probabilities of the `2^num_qubits` basis states
+ * @param shots The number of shots
+ * @param gen The counter-based generator
+ * @param stream The generator substream reserved for this call
+ * @param num_threads The number of worker threads (0 denotes hardware concurrency)
+ *
+ * @return `std::vector<size_t>` The index of the basis state drawn at each shot
+ */
+static inline auto generateSampleIndicesParallel(const std::vector<double> &probs, size_t shots,
+                                                 const Philox4x32 &gen, uint64_t stream,
+                                                 size_t num_threads = 0) -> std::vector<size_t>
+{
+    std::vector<double> cdf(probs.size());
+    std::partial_sum(probs.begin(), probs.end(), cdf.begin());
+    const double total = cdf.empty() ? 0.0 : cdf.back();
+    RT_FAIL_IF(total <= 0.0, "Invalid probability distribution to sample from");
+
+    std::vector<size_t> indices(shots);
+
+    auto draw_range = [&](size_t begin, size_t end) {
+        for (size_t shot = begin; shot < end; shot++) {
+            const double u = gen.uniform(stream, shot) * total;
+            auto it = std::upper_bound(cdf.begin(), cdf.end(), u);
+            indices[shot] = std::min(static_cast<size_t>(std::distance(cdf.begin(), it)),
+                                     cdf.size() - 1);
+        }
+    };
+
+    num_threads = getNumShotThreads(shots, num_threads);
+
+    parallelFor(shots, num_threads, draw_range);
+    return indices;
+}
+
+/**
+ * @brief Draw computational basis samples from a probability distribution using
+ * multiple threads.
+ *
+ * @note See `generateSampleIndicesParallel`, whose indices are unpacked into bits.
+ *
+ * @param probs The probabilities of the `2^num_qubits` basis states
+ * @param num_qubits The number of qubits
+ * @param shots The number of shots
+ * @param gen The counter-based generator
+ * @param stream The generator substream reserved for this call
+ * @param num_threads The number of worker threads (0 denotes hardware concurrency)
+ *
+ * @return `std::vector<size_t>` A `shots * num_qubits` vector of bits laid out
+ * row-wise, with wire 0 being the most significant bit of each basis state
+ */
+static inline auto generateSamplesParallel(const std::vector<double> &probs, size_t num_qubits,
+                                           size_t shots, const Philox4x32 &gen, uint64_t stream,
+                                           size_t num_threads = 0) -> std::vector<size_t>
+{
+    auto &&indices = generateSampleIndicesParallel(probs, shots, gen, stream, num_threads);
+
+    std::vector<size_t> samples(shots * num_qubits);
+
+    auto unpack_range = [&](size_t begin, size_t end) {
+        for (size_t shot = begin; shot < end; shot++) {
+            for (size_t wire = 0; wire < num_qubits; wire++) {
+                samples[shot * num_qubits + wire] = (indices[shot] >> (num_qubits - 1 - wire)) & 1U;
+            }
+        }
+    };
+
+    parallelFor(shots, getNumShotThreads(shots, num_threads), unpack_range);
+    return samples;
+}
+
+/**
+ * @brief Count the distinct outcomes of computational basis samples on a subset of the wires
+ * using multiple threads.
+ *
+ * Every thread counts the outcomes of a range of shots into its own hash table, and the tables
+ * are merged once all the shots are counted. As a result, the memory used grows with the number
+ * of distinct outcomes, and not with the `2^num_wires` possible outcomes.
+ *
+ * @param samples A `shots * num_qubits` vector of bits laid out row-wise
+ * @param num_qubits The number of qubits of the samples
+ * @param wires The wires to count the outcomes of, with the first wire being the most
+ * significant bit of each outcome
+ * @param shots The number of shots
+ * @param num_threads The number of worker threads (0 denotes hardware concurrency)
+ *
+ * @return `std::vector<std::pair<uint64_t, int64_t>>` The distinct outcomes and their counts,
+ * in increasing order of outcomes
+ */
+static inline auto countOutcomesParallel(const std::vector<size_t> &samples, size_t num_qubits,
+                                         const std::vector<size_t> &wires, size_t shots,
+                                         size_t num_threads = 0)
+    -> std::vector<std::pair<uint64_t, int64_t>>
+{
+    RT_FAIL_IF(wires.size() > static_cast<size_t>(std::numeric_limits<uint64_t>::digits),
+               "Too many wires to count the outcomes of");
+
+    using HistogramT = std::unordered_map<uint64_t, int64_t>;
+    std::vector<HistogramT> histograms;
+    std::mutex histograms_mutex;
+
+    auto count_range = [&](size_t begin, size_t end) {
+        HistogramT histogram;
+        for (size_t shot = begin; shot < end; shot++) {
+            uint64_t outcome = 0;
+            for (auto wire : wires) {
+                outcome = (outcome << 1) | static_cast<uint64_t>(samples[shot * num_qubits + wire]);
+            }
+            histogram[outcome]++;
+        }
+        std::lock_guard<std::mutex> lock(histograms_mutex);
+        histograms.push_back(std::move(histogram));
+    };
+
+    num_threads = getNumShotThreads(shots, num_threads);
+
+    parallelFor(shots, num_threads, count_range);
+
+    HistogramT merged;
+    for (auto &histogram : histograms) {
+        if (merged.empty()) {
+            merged = std::move(histogram);
+            continue;
+        }
+        for (auto &&[outcome, count] : histogram) {
+            merged[outcome] += count;
+        }
+    }
+
+    std::vector<std::pair<uint64_t, int64_t>> outcomes(merged.begin(), merged.end());
+    std::sort(outcomes.begin(), outcomes.end());
+    return outcomes;
+}
+
+/**
+ * @brief Draw the random single-qubit Pauli measurement bases of classical shadow shots using
+ * multiple threads.
+ *
+ * The basis of every wire of every shot is drawn uniformly among X, Y and Z from its own Philox
+ * element `(stream, shot * num_wires + wire)`, so that the bases only depend on the generator key
+ * and `stream`, and not on the number of threads the shots are split over.
+ *
+ * @param num_wires The number of wires of each shot, at most 32
+ * @param shots The number of shots
+ * @param gen The counter-based generator
+ * @param stream The generator substream reserved for this call
+ * @param num_threads The number of worker threads (0 denotes hardware concurrency)
+ *
+ * @return `std::vector<uint64_t>` The bases of each shot, packed with 2 bits per wire (1 for X,
+ * 2 for Y and 3 for Z) and the first wire in the most significant bits
+ */
+static inline auto generateShadowBasesParallel(size_t num_wires, size_t shots,
+                                               const Philox4x32 &gen, uint64_t stream,
+                                               size_t num_threads = 0) -> std::vector<uint64_t>
+{
+    RT_FAIL_IF(num_wires > static_cast<size_t>(std::numeric_limits<uint64_t>::digits) / 2,
+               "Too many wires to pack the classical shadow bases of");
+
+    std::vector<uint64_t> bases(shots);
+
+    auto draw_range = [&](size_t begin, size_t end) {
+        for (size_t shot = begin; shot < end; shot++) {
+            uint64_t packed = 0;
+            for (size_t wire = 0; wire < num_wires; wire++) {
+                const auto pauli = std::min<uint64_t>(
+                    static_cast<uint64_t>(3 * gen.uniform(stream, shot * num_wires + wire)), 2);
+                packed = (packed << 2) | (pauli + 1);
+            }
+            bases[shot] = packed;
+        }
+    };
+
+    parallelFor(shots, getNumShotThreads(shots, num_threads), draw_range);
+    return bases;
+}
+
+/**
+ * @brief Estimate the expectation value of a Pauli word from the records of a classical shadow
+ * using multiple threads.
+ *
+ * A record is the pair of the packed measurement bases of a shot (see
+ * `generateShadowBasesParallel`) and of its packed outcomes, with the first wire being the most
+ * significant bit. Each shot whose bases match the word on its support contributes
+ * `3^weight` times the parity of its outcomes on the support, and the other shots contribute 0.
+ *
+ * @param records The `shots * 2` records laid out row-wise
+ * @param word The Pauli word over the wires of the records, as a string of 'I', 'X', 'Y' and 'Z'
+ * @param num_threads The number of worker threads (0 denotes hardware concurrency)
+ *
+ * @return `double` The estimated expectation value
+ */
+static inline auto estimateShadowExpval(const std::vector<int64_t> &records, std::string_view word,
+                                        size_t num_threads = 0) -> double
+{
+    const size_t num_wires = word.size();
+    RT_FAIL_IF(num_wires > static_cast<size_t>(std::numeric_limits<uint64_t>::digits) / 2,
+               "Too many wires to pack the classical shadow bases of");
+    RT_FAIL_IF(records.size() % 2, "Invalid size for the classical shadow records");
+
+    uint64_t basis_mask = 0;
+    uint64_t basis_word = 0;
+    uint64_t outcome_mask = 0;
+    double scale = 1;
+    for (size_t wire = 0; wire < num_wires; wire++) {
+        const size_t pos = word.size() - 1 - wire;
+        switch (word[wire]) {
+        case 'I':
+            continue;
+        case 'X':
+            basis_word |= uint64_t{1} << (2 * pos);
+            break;
+        case 'Y':
+            basis_word |= uint64_t{2} << (2 * pos);
+            break;
+        case 'Z':
+            basis_word |= uint64_t{3} << (2 * pos);
+            break;
+        default:
+            RT_FAIL("Invalid Pauli word to estimate from a classical shadow");
+        }
+        basis_mask |= uint64_t{3} << (2 * pos);
+        outcome_mask |= uint64_t{1} << pos;
+        scale *= 3;
+    }
+
+    const size_t shots = records.size() / 2;
+    if (!shots) {
+        return 0;
+    }
+
+    std::vector<double> partial_sums;
+    std::mutex partial_sums_mutex;
+
+    auto sum_range = [&](size_t begin, size_t end) {
+        int64_t sum = 0;
+        for (size_t shot = begin; shot < end; shot++) {
+            const auto bases = static_cast<uint64_t>(records[2 * shot]);
+            const auto outcomes = static_cast<uint64_t>(records[2 * shot + 1]);
+            if ((bases & basis_mask) == basis_word) {
+                sum += (std::popcount(outcomes & outcome_mask) & 1) ? -1 : 1;
+            }
+        }
+        std::lock_guard<std::mutex> lock(partial_sums_mutex);
+        partial_sums.push_back(static_cast<double>(sum));
+    };
+
+    parallelFor(shots, getNumShotThreads(shots, num_threads), sum_range);
+
+    return scale * std::accumulate(partial_sums.begin(), partial_sums.end(), 0.0) /
+           static_cast<double>(shots);
+}
+
+/**
+ * @brief Apply the quantum Fourier transform to a contiguous block of wires of a state vector,
+ * in place and using multiple threads.
+ *
+ * The transform is a discrete Fourier transform over the index bits of the wires, which is
+ * computed as a radix-2 FFT. Butterfly stage `i` fuses the Hadamard gate on the `i`-th wire with
+ * all the controlled phase shifts it receives in the gate decomposition of the transform, so
+ * that the state vector is traversed `num_wires + 1` times instead of once per gate.
+ *
+ * @param data The state vector of `2^num_qubits` amplitudes, with wire 0 being the most
+ * significant bit of each basis state
+ * @param num_qubits The number of qubits
+ * @param first_wire The first wire to transform, which is the most significant bit of the
+ * transformed index
+ * @param num_wires The number of wires to transform
+ * @param inverse Indicates whether to apply the inverse transform
+ * @param num_threads The number of worker threads (0 denotes hardware concurrency)
+ */
+static inline void applyQFTParallel(std::complex<double> *data, size_t num_qubits,
+                                    size_t first_wire, size_t num_wires, bool inverse,
+                                    size_t num_threads = 0)
+{
+    constexpr size_t min_pairs_per_thread = 1U << 14;
+    // Twiddle factors are updated incrementally, and recomputed from scratch with this period to
+    // bound the rounding errors.
+    constexpr size_t twiddle_period = 64;
+
+    RT_FAIL_IF(first_wire + num_wires > num_qubits,
+               "Invalid wires for the quantum Fourier transform");
+    if (!num_wires) {
+        return;
+    }
+
+    // The transformed index is made of the state index bits [shift, shift + num_wires).
+    const size_t shift = num_qubits - first_wire - num_wires;
+    const size_t num_pairs = (size_t{1} << num_qubits) / 2;
+    const double scale = std::numbers::sqrt2 / 2;
+
+    if (!num_threads) {
+        num_threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    num_threads = std::min(num_threads, std::max<size_t>(num_pairs / min_pairs_per_thread, 1));
+
+    // Butterfly stage of the i-th wire, whose phase depends on the bits `t` of the wires after it.
+    auto butterflies = [&](size_t i) {
+        const size_t t_bits = num_wires - 1 - i;
+        const size_t t_mask = (size_t{1} << t_bits) - 1;
+        const size_t pos = shift + t_bits;
+        const size_t low_mask = (size_t{1} << pos) - 1;
+        const double angle = (inverse ? -std::numbers::pi : std::numbers::pi) /
+                             static_cast<double>(size_t{1} << t_bits);
+        const std::complex<double> step = std::polar(1.0, angle);
+
+        parallelFor(num_pairs, num_threads, [&](size_t begin, size_t end) {
+            std::complex<double> twiddle;
+            size_t last_t = 0;
+            size_t updates = twiddle_period;
+            for (size_t p = begin; p < end; p++) {
+                const size_t t = (p >> shift) & t_mask;
+                if (t != last_t || updates == twiddle_period) {
+                    if (t == last_t + 1 && updates < twiddle_period) {
+                        twiddle *= step;
+                        updates++;
+                    }
+                    else {
+                        twiddle = std::polar(1.0, angle * static_cast<double>(t));
+                        updates = 0;
+                    }
+                    last_t = t;
+                }
+
+                const size_t a = ((p & ~low_mask) << 1) | (p & low_mask);
+                const size_t b = a | (size_t{1} << pos);
+                const std::complex<double> x = data[a];
+                if (!inverse) {
+                    const std::complex<double> y = data[b];
+                    data[a] = (x + y) * scale;
+                    data[b] = (x - y) * (twiddle * scale);
+                }
+                else {
+                    const std::complex<double> y = data[b] * twiddle;
+                    data[a] = (x + y) * scale;
+                    data[b] = (x - y) * scale;
+                }
+            }
+        });
+    };
+
+    // The FFT leaves the transformed index in bit-reversed order. Bits are reversed with two
+    // lookup tables covering the low and high halves of the transformed index.
+    auto reverseIndices = [&]() {
+        const size_t lo_bits = num_wires / 2;
+        const size_t hi_bits = num_wires - lo_bits;
+        auto reversalTable = [](size_t bits) {
+            std::vector<size_t> table(size_t{1} << bits, 0);
+            for (size_t k = 1; k < table.size(); k++) {
+                table[k] = (table[k >> 1] >> 1) | ((k & 1) << (bits - 1));
+            }
+            return table;
+        };
+        const std::vector<size_t> rev_lo = reversalTable(lo_bits);
+        const std::vector<size_t> rev_hi = reversalTable(hi_bits);
+        const size_t lo_mask = (size_t{1} << lo_bits) - 1;
+        const size_t mask = ((size_t{1} << num_wires) - 1) << shift;
+
+        parallelFor(num_pairs * 2, num_threads, [&](size_t begin, size_t end) {
+            for (size_t idx = begin; idx < end; idx++) {
+                const size_t k = (idx & mask) >> shift;
+                const size_t r = (rev_lo[k & lo_mask] << hi_bits) | rev_hi[k >> lo_bits];
+                if (k < r) {
+                    std::swap(data[idx], data[(idx & ~mask) | (r << shift)]);
+                }
+            }
+        });
+    };
+
+    if (!inverse) {
+        for (size_t i = 0; i < num_wires; i++) {
+            butterflies(i);
+        }
+        reverseIndices();
+    }
+    else {
+        reverseIndices();
+        for (size_t i = num_wires; i-- > 0;) {
+            butterflies(i);
+        }
+    }
+}
+
+/**
+ * @brief Apply the rotation `exp(-i theta/2 P)` about a Pauli word `P` to a state vector, in
+ * place and in a single pass over the amplitudes.
+ *
+ * The word acts on a basis state `x` as `P|x> = i^{n_Y} (-1)^{|x & phase_mask|} |x ^ flip_mask>`,
+ * where `flip_mask` holds the bits of the X and Y factors, and `phase_mask` the bits of the Y and
+ * Z factors. The rotation therefore only mixes the pairs of amplitudes `(x, x ^ flip_mask)`.
+ *
+ * @param data The state vector of `2^num_qubits` amplitudes, with wire 0 being the most
+ * significant bit of each basis state
+ * @param num_qubits The number of qubits
+ * @param pauli_word The Pauli operator (`I`, `X`, `Y`, or `Z`) applied to each wire
+ * @param wires The wires to apply the rotation to
+ * @param theta The rotation angle
+ * @param num_threads The number of worker threads (0 denotes hardware concurrency)
+ */
+static inline void applyPauliRotationParallel(std::complex<double> *data, size_t num_qubits,
+                                              const std::string &pauli_word,
+                                              const std::vector<size_t> &wires, double theta,
+                                              size_t num_threads = 0)
+{
+    constexpr size_t min_amplitudes_per_thread = 1U << 15;
+
+    RT_FAIL_IF(pauli_word.size() != wires.size(), "Invalid Pauli word for the given wires");
+
+    size_t flip_mask = 0;
+    size_t phase_mask = 0;
+    size_t num_y = 0;
+    for (size_t i = 0; i < wires.size(); i++) {
+        RT_FAIL_IF(wires[i] >= num_qubits, "Invalid wires for the Pauli rotation");
+        const size_t bit = size_t{1} << (num_qubits - 1 - wires[i]);
+        switch (pauli_word[i]) {
+        case 'I':
+            break;
+        case 'X':
+            flip_mask |= bit;
+            break;
+        case 'Y':
+            flip_mask |= bit;
+            phase_mask |= bit;
+            num_y++;
+            break;
+        case 'Z':
+            phase_mask |= bit;
+            break;
+        default:
+            RT_FAIL("Invalid Pauli word");
+        }
+    }
+
+    const size_t num_amplitudes = size_t{1} << num_qubits;
+    if (!num_threads) {
+        num_threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    num_threads =
+        std::min(num_threads, std::max<size_t>(num_amplitudes / min_amplitudes_per_thread, 1));
+
+    const double c = std::cos(theta / 2);
+    const double s = std::sin(theta / 2);
+    auto sign = [phase_mask](size_t x) {
+        return (std::popcount(x & phase_mask) & 1) ? -1.0 : 1.0;
+    };
+
+    // Diagonal words (Z and I factors only) apply a phase `exp(-/+ i theta/2)` to each amplitude.
+    if (!flip_mask) {
+        const std::complex<double> phase{c, -s};
+        parallelFor(num_amplitudes, num_threads, [&](size_t begin, size_t end) {
+            for (size_t x = begin; x < end; x++) {
+                data[x] *= sign(x) > 0 ? phase : std::conj(phase);
+            }
+        });
+        return;
+    }
+
+    // Visit each pair once, from the member whose highest flipped bit is zero.
+    const size_t pos = std::bit_width(flip_mask) - 1;
+    const size_t low_mask = (size_t{1} << pos) - 1;
+    constexpr std::complex<double> i_powers[] = {{1, 0}, {0, 1}, {-1, 0}, {0, -1}};
+    const std::complex<double> q = std::complex<double>{0, -s} * i_powers[num_y % 4];
+
+    parallelFor(num_amplitudes / 2, num_threads, [&](size_t begin, size_t end) {
+        for (size_t p = begin; p < end; p++) {
+            const size_t x = ((p & ~low_mask) << 1) | (p & low_mask);
+            const size_t y = x ^ flip_mask;
+            const std::complex<double> a = data[x];
+            const std::complex<double> b = data[y];
+            data[x] = c * a + q * sign(y) * b;
+            data[y] = c * b + q * sign(x) * a;
+        }
+    });
+}
+
+/**
+ * @brief Insert a zero bit at each of the sorted bit `positions` of `x`, so that the indices
+ * `0 .. 2^(n - k)` enumerate the basis states with these bits cleared.
+ */
+static inline auto insertZeroBits(size_t x, const std::vector<size_t> &positions) -> size_t
+{
+    for (auto pos : positions) {
+        const size_t low_mask = (size_t{1} << pos) - 1;
+        x = ((x & ~low_mask) << 1) | (x & low_mask);
+    }
+    return x;
+}
+
+/**
+ * @brief Prepare `wires` of a state vector in the given state, in place.
+ *
+ * The wires must be in the all-zero state, so that the amplitudes are those of
+ * `|other wires> (x) |0...0>`. Each amplitude `phi` at a basis state `b` with the bits of `wires`
+ * cleared is then spread into `state[a] * phi` at `b | scatter(a)`, where `scatter` maps the bits
+ * of `a` onto the bits of `wires`.
+ *
+ * @param data The state vector of `2^num_qubits` amplitudes, with wire 0 being the most
+ * significant bit of each basis state
+ * @param num_qubits The number of qubits
+ * @param wires The wires to prepare, the first one being the most significant bit of `state`
+ * @param state The `2^wires.size()` amplitudes to prepare
+ * @param num_threads The number of worker threads (0 denotes hardware concurrency)
+ */
+static inline void setStateParallel(std::complex<double> *data, size_t num_qubits,
+                                    const std::vector<size_t> &wires,
+                                    const std::complex<double> *state, size_t num_threads = 0)
+{
+    constexpr size_t min_amplitudes_per_thread = 1U << 15;
+
+    const size_t num_wires = wires.size();
+    RT_FAIL_IF(num_wires > num_qubits, "Invalid number of wires for the state preparation");
+
+    std::vector<size_t> positions(num_wires);
+    for (size_t i = 0; i < num_wires; i++) {
+        RT_FAIL_IF(wires[i] >= num_qubits, "Invalid wires for the state preparation");
+        positions[i] = num_qubits - 1 - wires[i];
+    }
+
+    const size_t num_states = size_t{1} << num_wires;
+    std::vector<size_t> offsets(num_states, 0);
+    for (size_t a = 1; a < num_states; a++) {
+        for (size_t i = 0; i < num_wires; i++) {
+            if ((a >> (num_wires - 1 - i)) & 1) {
+                offsets[a] |= size_t{1} << positions[i];
+            }
+        }
+    }
+    std::sort(positions.begin(), positions.end());
+
+    const size_t num_amplitudes = size_t{1} << num_qubits;
+    if (!num_threads) {
+        num_threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    num_threads =
+        std::min(num_threads, std::max<size_t>(num_amplitudes / min_amplitudes_per_thread, 1));
+
+    // The non-zero offsets never land on a base state, so they can all be written from the bases
+    // before the bases themselves are scaled by `state[0]`.
+    parallelFor(num_amplitudes, num_threads, [&](size_t begin, size_t end) {
+        for (size_t x = begin; x < end; x++) {
+            const size_t a = x & (num_states - 1);
+            if (a) {
+                const size_t base = insertZeroBits(x >> num_wires, positions);
+                data[base | offsets[a]] = state[a] * data[base];
+            }
+        }
+    });
+    parallelFor(num_amplitudes / num_states, num_threads, [&](size_t begin, size_t end) {
+        for (size_t p = begin; p < end; p++) {
+            data[insertZeroBits(p, positions)] *= state[0];
+        }
+    });
+}
+
+/**
+ * @brief Prepare `wires` of a state vector in a computational basis state, in place.
+ *
+ * The wires must be in the all-zero state, so each amplitude at a basis state `b` with the bits of
+ * `wires` cleared is moved to `b | mask`, where `mask` holds the bits of `wires` set in `index`.
+ *
+ * @param data The state vector of `2^num_qubits` amplitudes, with wire 0 being the most
+ * significant bit of each basis state
+ * @param num_qubits The number of qubits
+ * @param wires The wires to prepare, the first one being the most significant bit of `index`
+ * @param index The basis state to prepare on `wires`
+ * @param num_threads The number of worker threads (0 denotes hardware concurrency)
+ */
+static inline void setBasisStateParallel(std::complex<double> *data, size_t num_qubits,
+                                         const std::vector<size_t> &wires, size_t index,
+                                         size_t num_threads = 0)
+{
+    constexpr size_t min_amplitudes_per_thread = 1U << 15;
+
+    const size_t num_wires = wires.size();
+    RT_FAIL_IF(num_wires > num_qubits, "Invalid number of wires for the state preparation");
+
+    std::vector<size_t> positions(num_wires);
+    size_t mask = 0;
+    for (size_t i = 0; i < num_wires; i++) {
+        RT_FAIL_IF(wires[i] >= num_qubits, "Invalid wires for the state preparation");
+        positions[i] = num_qubits - 1 - wires[i];
+        if ((index >> (num_wires - 1 - i)) & 1) {
+            mask |= size_t{1} << positions[i];
+        }
+    }
+    if (!mask) {
+        return;
+    }
+    std::sort(positions.begin(), positions.end());
+
+    const size_t num_bases = size_t{1} << (num_qubits - num_wires);
+    if (!num_threads) {
+        num_threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    num_threads =
+        std::min(num_threads, std::max<size_t>(num_bases / min_amplitudes_per_thread, 1));
+
+    parallelFor(num_bases, num_threads, [&](size_t begin, size_t end) {
+        for (size_t p = begin; p < end; p++) {
+            const size_t base = insertZeroBits(p, positions);
+            data[base | mask] = data[base];
+            data[base] = 0;
+        }
+    });
 }
 
 } // namespace Catalyst::Runtime::Simulator::Lightning
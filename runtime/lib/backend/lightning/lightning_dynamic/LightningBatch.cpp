@@ -0,0 +1,692 @@
+// Copyright 2024 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "LightningBatch.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <numbers>
+#include <string_view>
+#include <thread>
+#include <tuple>
+
+#include "Utils.hpp"
+
+namespace {
+using Catalyst::Runtime::Simulator::Lightning::parallelFor;
+using ComplexT = std::complex<double>;
+
+constexpr ComplexT imag_unit{0, 1};
+
+// The product of two complex numbers, without the NaN handling of `std::complex` that prevents
+// the vectorization of the lane loops.
+inline auto mul(ComplexT lhs, ComplexT rhs) -> ComplexT
+{
+    return {lhs.real() * rhs.real() - lhs.imag() * rhs.imag(),
+            lhs.real() * rhs.imag() + lhs.imag() * rhs.real()};
+}
+
+struct GateMatrix {
+    // The row-major matrix of the gate, or its diagonal, with the first target wire being the
+    // most significant bit of the row and column indices
+    std::vector<ComplexT> matrix;
+    bool diagonal;
+    // The number of leading wires of the gate that are controls, e.g. 1 for CNOT
+    size_t num_controls;
+};
+
+auto getGateMatrix(const std::string &name, const std::vector<double> &params, size_t num_wires)
+    -> GateMatrix
+{
+    static const std::unordered_map<std::string_view, std::pair<std::string_view, size_t>>
+        controlled_gates = {{"CNOT", {"PauliX", 1}},
+                            {"Toffoli", {"PauliX", 2}},
+                            {"CY", {"PauliY", 1}},
+                            {"CZ", {"PauliZ", 1}},
+                            {"CRX", {"RX", 1}},
+                            {"CRY", {"RY", 1}},
+                            {"CRZ", {"RZ", 1}},
+                            {"CRot", {"Rot", 1}},
+                            {"ControlledPhaseShift", {"PhaseShift", 1}},
+                            {"CSWAP", {"SWAP", 1}}};
+
+    std::string_view base = name;
+    size_t num_controls = 0;
+    if (auto it = controlled_gates.find(base); it != controlled_gates.end()) {
+        std::tie(base, num_controls) = it->second;
+    }
+    RT_FAIL_IF(num_wires < num_controls, "Invalid number of wires");
+
+    static const std::unordered_map<std::string_view, size_t> num_params = {
+        {"RX", 1},
+        {"RY", 1},
+        {"RZ", 1},
+        {"PhaseShift", 1},
+        {"Rot", 3},
+        {"PSWAP", 1},
+        {"IsingXX", 1},
+        {"IsingYY", 1},
+        {"IsingXY", 1},
+        {"IsingZZ", 1},
+        {"MultiRZ", 1},
+        {"GlobalPhase", 1},
+        {"SingleExcitation", 1},
+        {"SingleExcitationMinus", 1},
+        {"SingleExcitationPlus", 1},
+        {"DoubleExcitation", 1},
+        {"DoubleExcitationMinus", 1},
+        {"DoubleExcitationPlus", 1},
+    };
+    if (auto it = num_params.find(base); it != num_params.end()) {
+        RT_FAIL_IF(params.size() < it->second, "Invalid number of gate parameters");
+    }
+
+    auto dense = [num_controls](std::vector<ComplexT> &&matrix) {
+        return GateMatrix{std::move(matrix), false, num_controls};
+    };
+    auto diag = [num_controls](std::vector<ComplexT> &&matrix) {
+        return GateMatrix{std::move(matrix), true, num_controls};
+    };
+    // A rotation by `theta` between the basis states `low` and `high` of `num_qubits` qubits,
+    // with the other basis states picking up the given phase.
+    auto excitation = [&dense](size_t num_qubits, size_t low, size_t high, double theta,
+                               ComplexT phase) {
+        const size_t dim = size_t{1} << num_qubits;
+        std::vector<ComplexT> matrix(dim * dim, 0);
+        for (size_t x = 0; x < dim; x++) {
+            matrix[x * dim + x] = phase;
+        }
+        matrix[low * dim + low] = std::cos(theta / 2);
+        matrix[low * dim + high] = -std::sin(theta / 2);
+        matrix[high * dim + low] = std::sin(theta / 2);
+        matrix[high * dim + high] = std::cos(theta / 2);
+        return dense(std::move(matrix));
+    };
+
+    const double theta = params.empty() ? 0.0 : params[0];
+    const double c = std::cos(theta / 2);
+    const double s = std::sin(theta / 2);
+    const double r = 1 / std::numbers::sqrt2;
+    const ComplexT is = imag_unit * s;
+
+    GateMatrix gate;
+    if (base == "Identity") {
+        gate = diag({1, 1});
+    }
+    else if (base == "PauliX") {
+        gate = dense({0, 1, 1, 0});
+    }
+    else if (base == "PauliY") {
+        gate = dense({0, -imag_unit, imag_unit, 0});
+    }
+    else if (base == "PauliZ") {
+        gate = diag({1, -1});
+    }
+    else if (base == "Hadamard") {
+        gate = dense({r, r, r, -r});
+    }
+    else if (base == "S") {
+        gate = diag({1, imag_unit});
+    }
+    else if (base == "T") {
+        gate = diag({1, std::polar(1.0, std::numbers::pi / 4)});
+    }
+    else if (base == "SX") {
+        const ComplexT p{0.5, 0.5};
+        const ComplexT m{0.5, -0.5};
+        gate = dense({p, m, m, p});
+    }
+    else if (base == "RX") {
+        gate = dense({c, -is, -is, c});
+    }
+    else if (base == "RY") {
+        gate = dense({c, -s, s, c});
+    }
+    else if (base == "RZ") {
+        gate = diag({std::polar(1.0, -theta / 2), std::polar(1.0, theta / 2)});
+    }
+    else if (base == "PhaseShift") {
+        gate = diag({1, std::polar(1.0, theta)});
+    }
+    else if (base == "Rot") {
+        const double phi = params[0];
+        const double omega = params[2];
+        const double rc = std::cos(params[1] / 2);
+        const double rs = std::sin(params[1] / 2);
+        gate = dense({std::polar(rc, -(phi + omega) / 2), -std::polar(rs, (phi - omega) / 2),
+                      std::polar(rs, -(phi - omega) / 2), std::polar(rc, (phi + omega) / 2)});
+    }
+    else if (base == "SWAP") {
+        gate = dense({1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 1});
+    }
+    else if (base == "ISWAP") {
+        const ComplexT i = imag_unit;
+        gate = dense({1, 0, 0, 0, 0, 0, i, 0, 0, i, 0, 0, 0, 0, 0, 1});
+    }
+    else if (base == "PSWAP") {
+        const ComplexT e = std::polar(1.0, theta);
+        gate = dense({1, 0, 0, 0, 0, 0, e, 0, 0, e, 0, 0, 0, 0, 0, 1});
+    }
+    else if (base == "IsingXX") {
+        gate = dense({c, 0, 0, -is, 0, c, -is, 0, 0, -is, c, 0, -is, 0, 0, c});
+    }
+    else if (base == "IsingYY") {
+        gate = dense({c, 0, 0, is, 0, c, -is, 0, 0, -is, c, 0, is, 0, 0, c});
+    }
+    else if (base == "IsingXY") {
+        gate = dense({1, 0, 0, 0, 0, c, is, 0, 0, is, c, 0, 0, 0, 0, 1});
+    }
+    else if (base == "IsingZZ") {
+        const ComplexT e = std::polar(1.0, -theta / 2);
+        gate = diag({e, std::conj(e), std::conj(e), e});
+    }
+    else if (base == "MultiRZ") {
+        const ComplexT e = std::polar(1.0, -theta / 2);
+        std::vector<ComplexT> phases(size_t{1} << num_wires);
+        for (size_t x = 0; x < phases.size(); x++) {
+            phases[x] = (std::popcount(x) & 1) ? std::conj(e) : e;
+        }
+        gate = diag(std::move(phases));
+    }
+    else if (base == "GlobalPhase") {
+        gate = diag({std::polar(1.0, -theta)});
+    }
+    else if (base == "SingleExcitation") {
+        gate = excitation(2, 0b01, 0b10, theta, 1);
+    }
+    else if (base == "SingleExcitationMinus") {
+        gate = excitation(2, 0b01, 0b10, theta, std::polar(1.0, -theta / 2));
+    }
+    else if (base == "SingleExcitationPlus") {
+        gate = excitation(2, 0b01, 0b10, theta, std::polar(1.0, theta / 2));
+    }
+    else if (base == "DoubleExcitation") {
+        gate = excitation(4, 0b0011, 0b1100, theta, 1);
+    }
+    else if (base == "DoubleExcitationMinus") {
+        gate = excitation(4, 0b0011, 0b1100, theta, std::polar(1.0, -theta / 2));
+    }
+    else if (base == "DoubleExcitationPlus") {
+        gate = excitation(4, 0b0011, 0b1100, theta, std::polar(1.0, theta / 2));
+    }
+    else {
+        RT_FAIL("Unsupported gate in batched execution");
+    }
+
+    const size_t size = gate.matrix.size();
+    const size_t dim = gate.diagonal ? size : static_cast<size_t>(std::sqrt(size));
+    RT_FAIL_IF(dim != size_t{1} << (num_wires - num_controls), "Invalid number of wires");
+    return gate;
+}
+
+// Replace a gate matrix by its adjoint.
+void adjoint(std::vector<ComplexT> &matrix, bool diagonal)
+{
+    if (!diagonal) {
+        const size_t dim = static_cast<size_t>(std::sqrt(matrix.size()));
+        for (size_t row = 0; row < dim; row++) {
+            for (size_t col = row + 1; col < dim; col++) {
+                std::swap(matrix[row * dim + col], matrix[col * dim + row]);
+            }
+        }
+    }
+    std::transform(matrix.begin(), matrix.end(), matrix.begin(),
+                   [](ComplexT v) { return std::conj(v); });
+}
+
+/**
+ * @brief Apply a gate with a matrix per lane to a batched state vector, in place.
+ *
+ * @param data The batched state vector of `2^num_qubits * batch_size` amplitudes
+ * @param num_qubits The number of qubits
+ * @param batch_size The number of lanes
+ * @param matrix The matrix (or the diagonal) of the gate, with entry `i` of lane `l` at
+ * `i * batch_size + l`
+ * @param diagonal Indicates whether `matrix` only holds the diagonal of the gate
+ * @param wires The target wires
+ * @param controlled_wires The control wires
+ * @param controlled_values The values of the control wires to apply the gate on
+ * @param num_threads The number of worker threads (0 denotes hardware concurrency)
+ */
+void applyBatchedMatrix(ComplexT *data, size_t num_qubits, size_t batch_size,
+                        const ComplexT *matrix, bool diagonal, const std::vector<size_t> &wires,
+                        const std::vector<size_t> &controlled_wires,
+                        const std::vector<bool> &controlled_values, size_t num_threads)
+{
+    constexpr size_t min_amplitudes_per_thread = 1U << 15;
+
+    const size_t num_wires = wires.size();
+    const size_t dim = size_t{1} << num_wires;
+    auto bit = [num_qubits](size_t wire) { return size_t{1} << (num_qubits - 1 - wire); };
+
+    // The bits of the basis state selected by each row of the matrix
+    std::vector<size_t> offsets(dim, 0);
+    size_t target_mask = 0;
+    for (size_t j = 0; j < num_wires; j++) {
+        const size_t b = bit(wires[j]);
+        target_mask |= b;
+        for (size_t row = 0; row < dim; row++) {
+            if ((row >> (num_wires - 1 - j)) & 1) {
+                offsets[row] |= b;
+            }
+        }
+    }
+
+    size_t control_mask = 0;
+    size_t control_value = 0;
+    for (size_t j = 0; j < controlled_wires.size(); j++) {
+        const size_t b = bit(controlled_wires[j]);
+        control_mask |= b;
+        control_value |= controlled_values[j] ? b : 0;
+    }
+
+    const size_t num_states = size_t{1} << num_qubits;
+    if (!num_threads) {
+        num_threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    num_threads = std::min(
+        num_threads, std::max<size_t>(num_states * batch_size / min_amplitudes_per_thread, 1));
+
+    parallelFor(num_states, num_threads, [&](size_t begin, size_t end) {
+        std::vector<ComplexT> in(diagonal ? 0 : dim * batch_size);
+        for (size_t x = begin; x < end; x++) {
+            if ((x & target_mask) || (x & control_mask) != control_value) {
+                continue;
+            }
+
+            if (diagonal) {
+                for (size_t row = 0; row < dim; row++) {
+                    ComplexT *amp = data + (x | offsets[row]) * batch_size;
+                    const ComplexT *m = matrix + row * batch_size;
+                    for (size_t l = 0; l < batch_size; l++) {
+                        amp[l] = mul(m[l], amp[l]);
+                    }
+                }
+                continue;
+            }
+
+            for (size_t col = 0; col < dim; col++) {
+                std::copy_n(data + (x | offsets[col]) * batch_size, batch_size,
+                            in.data() + col * batch_size);
+            }
+            for (size_t row = 0; row < dim; row++) {
+                ComplexT *amp = data + (x | offsets[row]) * batch_size;
+                std::fill_n(amp, batch_size, ComplexT{0});
+                for (size_t col = 0; col < dim; col++) {
+                    const ComplexT *m = matrix + (row * dim + col) * batch_size;
+                    const ComplexT *src = in.data() + col * batch_size;
+                    for (size_t l = 0; l < batch_size; l++) {
+                        amp[l] += mul(m[l], src[l]);
+                    }
+                }
+            }
+        }
+    });
+}
+} // namespace
+
+namespace Catalyst::Runtime::Simulator {
+
+LightningBatch::LightningBatch(size_t batch_size, size_t num_threads)
+    : batch_size{batch_size}, num_threads{num_threads}
+{
+    RT_FAIL_IF(!batch_size, "Invalid batch size");
+}
+
+void LightningBatch::checkLaneComplete() const
+{
+    RT_FAIL_IF(op_idx != operations.size() || meas_idx != measurements.size(),
+               "Batch lanes must apply the same gates and measurements");
+}
+
+void LightningBatch::setLane(size_t new_lane)
+{
+    RT_FAIL_IF(new_lane >= batch_size, "Invalid batch lane");
+    if (!executed) {
+        RT_FAIL_IF(new_lane != num_recorded_lanes, "Batch lanes must be recorded in order");
+        checkLaneComplete();
+        num_recorded_lanes++;
+    }
+
+    lane = new_lane;
+    op_idx = 0;
+    meas_idx = 0;
+}
+
+void LightningBatch::addGate(const std::string &name, const std::vector<ComplexT> &matrix,
+                             bool diagonal, const std::vector<size_t> &wires, bool inverse,
+                             const std::vector<size_t> &controlled_wires,
+                             const std::vector<bool> &controlled_values, size_t device_num_qubits)
+{
+    if (!lane) {
+        operations.push_back({name, wires, controlled_wires, controlled_values, inverse, diagonal,
+                              std::vector<ComplexT>(matrix.size() * batch_size)});
+        num_qubits = std::max(num_qubits, device_num_qubits);
+    }
+
+    RT_FAIL_IF(op_idx >= operations.size(), "Batch lanes must apply the same gates");
+    Operation &op = operations[op_idx];
+    RT_FAIL_IF(op.name != name || op.wires != wires || op.controlled_wires != controlled_wires ||
+                   op.controlled_values != controlled_values || op.inverse != inverse ||
+                   op.diagonal != diagonal || op.matrix.size() != matrix.size() * batch_size,
+               "Batch lanes must apply the same gates");
+    op_idx++;
+
+    for (size_t i = 0; i < matrix.size(); i++) {
+        op.matrix[i * batch_size + lane] = matrix[i];
+    }
+}
+
+void LightningBatch::addOperation(const std::string &name, const std::vector<double> &params,
+                                  const std::vector<size_t> &wires, bool inverse,
+                                  const std::vector<size_t> &controlled_wires,
+                                  const std::vector<bool> &controlled_values,
+                                  size_t device_num_qubits)
+{
+    if (executed) {
+        return;
+    }
+
+    GateMatrix gate = getGateMatrix(name, params, wires.size());
+    if (inverse) {
+        adjoint(gate.matrix, gate.diagonal);
+    }
+
+    // The control wires of gates such as CNOT are applied as regular control wires.
+    const auto targets_begin = wires.begin() + static_cast<std::ptrdiff_t>(gate.num_controls);
+    std::vector<size_t> targets(targets_begin, wires.end());
+    std::vector<size_t> all_controlled_wires(controlled_wires);
+    all_controlled_wires.insert(all_controlled_wires.end(), wires.begin(), targets_begin);
+    std::vector<bool> all_controlled_values(controlled_values);
+    all_controlled_values.insert(all_controlled_values.end(), gate.num_controls, true);
+
+    addGate(name, gate.matrix, gate.diagonal, targets, inverse, all_controlled_wires,
+            all_controlled_values, device_num_qubits);
+}
+
+void LightningBatch::addMatrixOperation(const std::vector<ComplexT> &matrix,
+                                        const std::vector<size_t> &wires, bool inverse,
+                                        const std::vector<size_t> &controlled_wires,
+                                        const std::vector<bool> &controlled_values,
+                                        size_t device_num_qubits)
+{
+    if (executed) {
+        return;
+    }
+
+    const size_t dim = size_t{1} << wires.size();
+    RT_FAIL_IF(matrix.size() != dim * dim, "Invalid matrix size for the given wires");
+
+    std::vector<ComplexT> gate(matrix);
+    if (inverse) {
+        adjoint(gate, false);
+    }
+    addGate("QubitUnitary", gate, false, wires, inverse, controlled_wires, controlled_values,
+            device_num_qubits);
+}
+
+auto LightningBatch::getPauliSum(ObsIdType key) const -> const PauliSum &
+{
+    auto it = observables.find(key);
+    RT_FAIL_IF(it == observables.end(), "Invalid key for cached observables");
+    return it->second;
+}
+
+void LightningBatch::addNamedObservable(ObsIdType key, ObsId id, const std::vector<size_t> &wires)
+{
+    if (executed) {
+        return;
+    }
+
+    RT_FAIL_IF(id == ObsId::Hermitian,
+               "Hermitian observables are not supported in batched execution");
+    RT_FAIL_IF(wires.size() != 1, "Invalid number of wires for a named observable");
+
+    const size_t wire = wires[0];
+    const double r = 1 / std::numbers::sqrt2;
+    switch (id) {
+    case ObsId::Identity:
+        observables[key] = {{1.0, {}}};
+        break;
+    case ObsId::PauliX:
+        observables[key] = {{1.0, {{wire, 'X'}}}};
+        break;
+    case ObsId::PauliY:
+        observables[key] = {{1.0, {{wire, 'Y'}}}};
+        break;
+    case ObsId::PauliZ:
+        observables[key] = {{1.0, {{wire, 'Z'}}}};
+        break;
+    default: // Hadamard
+        observables[key] = {{r, {{wire, 'X'}}}, {r, {{wire, 'Z'}}}};
+        break;
+    }
+}
+
+void LightningBatch::addTensorObservable(ObsIdType key, const std::vector<ObsIdType> &obs)
+{
+    if (executed) {
+        return;
+    }
+
+    PauliSum product = {{1.0, {}}};
+    for (ObsIdType factor_key : obs) {
+        const PauliSum &factor = getPauliSum(factor_key);
+        PauliSum next;
+        next.reserve(product.size() * factor.size());
+        for (const PauliTerm &lhs : product) {
+            for (const PauliTerm &rhs : factor) {
+                PauliTerm term{lhs.coeff * rhs.coeff, lhs.factors};
+                for (const auto &[wire, pauli] : rhs.factors) {
+                    RT_FAIL_IF(std::any_of(term.factors.begin(), term.factors.end(),
+                                           [wire](const auto &f) { return f.first == wire; }),
+                               "Tensor observables on overlapping wires are not supported in "
+                               "batched execution");
+                    term.factors.emplace_back(wire, pauli);
+                }
+                next.push_back(std::move(term));
+            }
+        }
+        product = std::move(next);
+    }
+    observables[key] = std::move(product);
+}
+
+void LightningBatch::addHamiltonianObservable(ObsIdType key, const std::vector<double> &coeffs,
+                                              const std::vector<ObsIdType> &obs)
+{
+    if (executed) {
+        return;
+    }
+
+    RT_FAIL_IF(coeffs.size() != obs.size(), "Invalid coefficients for the Hamiltonian");
+
+    PauliSum sum;
+    for (size_t k = 0; k < obs.size(); k++) {
+        for (const PauliTerm &term : getPauliSum(obs[k])) {
+            sum.push_back({coeffs[k] * term.coeff, term.factors});
+        }
+    }
+    observables[key] = std::move(sum);
+}
+
+auto LightningBatch::nextMeasurement(MeasurementKind kind, const std::vector<size_t> &wires,
+                                     size_t size, const PauliSum *obs, size_t device_num_qubits)
+    -> const Measurement &
+{
+    if (!lane && !executed) {
+        measurements.push_back({kind, wires, size, operations.size(),
+                                std::vector<PauliSum>(batch_size), {}});
+        num_qubits = std::max(num_qubits, device_num_qubits);
+    }
+
+    RT_FAIL_IF(meas_idx >= measurements.size(), "Batch lanes must apply the same measurements");
+    Measurement &m = measurements[meas_idx];
+    RT_FAIL_IF(m.kind != kind || m.wires != wires || m.size != size,
+               "Batch lanes must apply the same measurements");
+    meas_idx++;
+
+    if (!executed) {
+        RT_FAIL_IF(m.num_operations != op_idx, "Batch lanes must apply the same measurements");
+        if (obs) {
+            m.observables[lane] = *obs;
+        }
+    }
+    return m;
+}
+
+auto LightningBatch::expval(ObsIdType key, size_t device_num_qubits) -> double
+{
+    const PauliSum *obs = executed ? nullptr : &getPauliSum(key);
+    const auto &m = nextMeasurement(MeasurementKind::Expval, {}, 1, obs, device_num_qubits);
+    return executed ? m.results[lane][0] : 0.0;
+}
+
+auto LightningBatch::var(ObsIdType key, size_t device_num_qubits) -> double
+{
+    const PauliSum *obs = executed ? nullptr : &getPauliSum(key);
+    const auto &m = nextMeasurement(MeasurementKind::Var, {}, 1, obs, device_num_qubits);
+    return executed ? m.results[lane][0] : 0.0;
+}
+
+void LightningBatch::probs(DataView<double, 1> &probs, const std::vector<size_t> &wires,
+                           size_t device_num_qubits)
+{
+    const size_t size = size_t{1} << (wires.empty() ? device_num_qubits : wires.size());
+    RT_FAIL_IF(probs.size() != size, "Invalid size for the pre-allocated probabilities");
+
+    const auto &m = nextMeasurement(MeasurementKind::Probs, wires, size, nullptr,
+                                    device_num_qubits);
+    if (executed) {
+        std::copy(m.results[lane].begin(), m.results[lane].end(), probs.begin());
+    }
+    else {
+        std::fill(probs.begin(), probs.end(), 0.0);
+    }
+}
+
+void LightningBatch::state(DataView<std::complex<double>, 1> &state, size_t device_num_qubits)
+{
+    const size_t size = size_t{1} << device_num_qubits;
+    RT_FAIL_IF(state.size() != size, "Invalid size for the pre-allocated state vector");
+
+    const auto &m = nextMeasurement(MeasurementKind::State, {}, size, nullptr, device_num_qubits);
+    auto it = state.begin();
+    for (size_t x = 0; x < size; x++, ++it) {
+        *it = executed ? ComplexT{m.results[lane][2 * x], m.results[lane][2 * x + 1]}
+                       : ComplexT{0};
+    }
+}
+
+void LightningBatch::execute()
+{
+    RT_FAIL_IF(executed, "Cannot execute a batch more than once");
+    RT_FAIL_IF(num_recorded_lanes != batch_size,
+               "Cannot execute a batch before recording all of its lanes");
+    checkLaneComplete();
+
+    const size_t num_states = size_t{1} << num_qubits;
+    auto bit = [this](size_t wire) { return size_t{1} << (num_qubits - 1 - wire); };
+
+    // All the lanes start in the |0...0> state.
+    std::vector<ComplexT> data(num_states * batch_size, ComplexT{0});
+    std::fill_n(data.begin(), batch_size, ComplexT{1});
+
+    size_t num_applied = 0;
+    std::vector<ComplexT> psi(num_states);
+    std::vector<ComplexT> phi(num_states);
+    for (Measurement &m : measurements) {
+        for (; num_applied < m.num_operations; num_applied++) {
+            const Operation &op = operations[num_applied];
+            applyBatchedMatrix(data.data(), num_qubits, batch_size, op.matrix.data(), op.diagonal,
+                               op.wires, op.controlled_wires, op.controlled_values,
+                               num_threads);
+        }
+
+        RT_FAIL_IF(m.kind == MeasurementKind::State && m.size != num_states,
+                   "Invalid size for the pre-allocated state vector");
+        RT_FAIL_IF(m.kind == MeasurementKind::Probs && m.wires.empty() && m.size != num_states,
+                   "Invalid size for the pre-allocated probabilities");
+
+        m.results.assign(batch_size, {});
+        for (size_t l = 0; l < batch_size; l++) {
+            for (size_t x = 0; x < num_states; x++) {
+                psi[x] = data[x * batch_size + l];
+            }
+
+            std::vector<double> &res = m.results[l];
+            switch (m.kind) {
+            case MeasurementKind::Expval:
+            case MeasurementKind::Var: {
+                // phi = H psi, for the Pauli words acting as
+                // P|x> = i^{n_Y} (-1)^{|x & phase_mask|} |x ^ flip_mask>.
+                constexpr ComplexT i_powers[] = {{1, 0}, {0, 1}, {-1, 0}, {0, -1}};
+                std::fill(phi.begin(), phi.end(), ComplexT{0});
+                for (const PauliTerm &term : m.observables[l]) {
+                    size_t flip_mask = 0;
+                    size_t phase_mask = 0;
+                    size_t num_y = 0;
+                    for (const auto &[wire, pauli] : term.factors) {
+                        flip_mask |= pauli != 'Z' ? bit(wire) : 0;
+                        phase_mask |= pauli != 'X' ? bit(wire) : 0;
+                        num_y += pauli == 'Y';
+                    }
+                    const ComplexT coeff = term.coeff * i_powers[num_y % 4];
+                    for (size_t x = 0; x < num_states; x++) {
+                        const bool odd = std::popcount(x & phase_mask) & 1;
+                        phi[x ^ flip_mask] += (odd ? -coeff : coeff) * psi[x];
+                    }
+                }
+
+                double expval = 0;
+                double sq_norm = 0;
+                for (size_t x = 0; x < num_states; x++) {
+                    expval += std::real(std::conj(psi[x]) * phi[x]);
+                    sq_norm += std::norm(phi[x]);
+                }
+                res = {m.kind == MeasurementKind::Expval ? expval : sq_norm - expval * expval};
+                break;
+            }
+            case MeasurementKind::Probs: {
+                res.assign(m.size, 0.0);
+                const size_t num_wires = m.wires.size();
+                for (size_t x = 0; x < num_states; x++) {
+                    size_t idx = num_wires ? 0 : x;
+                    for (size_t j = 0; j < num_wires; j++) {
+                        idx |= static_cast<size_t>((x & bit(m.wires[j])) != 0)
+                               << (num_wires - 1 - j);
+                    }
+                    res[idx] += std::norm(psi[x]);
+                }
+                break;
+            }
+            case MeasurementKind::State: {
+                res.resize(2 * num_states);
+                for (size_t x = 0; x < num_states; x++) {
+                    res[2 * x] = psi[x].real();
+                    res[2 * x + 1] = psi[x].imag();
+                }
+                break;
+            }
+            }
+        }
+    }
+
+    executed = true;
+    lane = 0;
+    op_idx = 0;
+    meas_idx = 0;
+}
+} // namespace Catalyst::Runtime::Simulator
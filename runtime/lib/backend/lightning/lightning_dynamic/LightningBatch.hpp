@@ -0,0 +1,167 @@
+// Copyright 2024 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <complex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "DataView.hpp"
+#include "Exception.hpp"
+#include "Types.h"
+
+namespace Catalyst::Runtime::Simulator {
+
+/**
+ * @brief The LightningBatch runs the same circuit for a batch of parameter sets, the lanes of
+ * the batch, in a single pass over a batched state vector.
+ *
+ * The batched state vector stores the amplitude of basis state `x` for lane `l` at index
+ * `x * batch_size + l`, so that every gate kernel updates the amplitudes of all the lanes with
+ * contiguous, vectorizable inner loops.
+ *
+ * The batch is driven in three steps by `LightningSimulator`:
+ *  - Recording: the circuit of each lane is run in order, and the gates and measurements of
+ *    every lane are recorded with the gate matrices of the lane. All the lanes must apply the
+ *    same gates to the same wires, and only differ in the gate parameters and observable
+ *    coefficients. The measurements return placeholder values.
+ *  - Execution: the recorded circuit is simulated for all the lanes at once, and the
+ *    measurement results of each lane are stored.
+ *  - Replay: the circuit of each lane is run again, gates are ignored, and the measurements
+ *    return the stored results of the lane in the recorded order.
+ */
+class LightningBatch {
+  private:
+    // A product of Pauli operators (`X`, `Y`, or `Z`) on distinct device wires.
+    struct PauliTerm {
+        double coeff;
+        std::vector<std::pair<size_t, char>> factors;
+    };
+    using PauliSum = std::vector<PauliTerm>;
+
+    struct Operation {
+        std::string name;
+        std::vector<size_t> wires;
+        std::vector<size_t> controlled_wires;
+        std::vector<bool> controlled_values;
+        bool inverse;
+        bool diagonal;
+        // The matrix (or the diagonal) entry `i` of lane `l` is stored at `i * batch_size + l`.
+        std::vector<std::complex<double>> matrix;
+    };
+
+    enum class MeasurementKind : uint8_t { Expval, Var, Probs, State };
+
+    struct Measurement {
+        MeasurementKind kind;
+        std::vector<size_t> wires;
+        size_t size;
+        size_t num_operations; // the number of operations applied before the measurement
+        std::vector<PauliSum> observables;         // per lane
+        std::vector<std::vector<double>> results; // per lane
+    };
+
+    const size_t batch_size;
+    const size_t num_threads;
+
+    bool executed{false};
+    size_t lane{0};
+    size_t num_recorded_lanes{0};
+    size_t num_qubits{0};
+
+    // The position of the current lane in the recorded operations and measurements
+    size_t op_idx{0};
+    size_t meas_idx{0};
+
+    std::vector<Operation> operations{};
+    std::vector<Measurement> measurements{};
+    std::unordered_map<ObsIdType, PauliSum> observables{};
+
+    void checkLaneComplete() const;
+    void addGate(const std::string &name, const std::vector<std::complex<double>> &matrix,
+                 bool diagonal, const std::vector<size_t> &wires, bool inverse,
+                 const std::vector<size_t> &controlled_wires,
+                 const std::vector<bool> &controlled_values, size_t device_num_qubits);
+    auto nextMeasurement(MeasurementKind kind, const std::vector<size_t> &wires, size_t size,
+                         const PauliSum *obs, size_t device_num_qubits) -> const Measurement &;
+    auto getPauliSum(ObsIdType key) const -> const PauliSum &;
+
+  public:
+    /**
+     * @brief Create a batch of `batch_size` lanes in the recording step.
+     *
+     * @param batch_size The number of lanes
+     * @param num_threads The number of worker threads of the kernels (0 denotes hardware
+     * concurrency)
+     */
+    LightningBatch(size_t batch_size, size_t num_threads);
+    ~LightningBatch() = default;
+
+    LightningBatch(const LightningBatch &) = delete;
+    LightningBatch &operator=(const LightningBatch &) = delete;
+    LightningBatch(LightningBatch &&) = delete;
+    LightningBatch &operator=(LightningBatch &&) = delete;
+
+    [[nodiscard]] auto isExecuted() const -> bool { return executed; }
+
+    /**
+     * @brief Select the lane that the following gates and measurements belong to. Lanes must be
+     * recorded in order; they can be replayed in any order.
+     */
+    void setLane(size_t new_lane);
+
+    /**
+     * @brief Simulate the recorded circuit for all the lanes and store the measurement results.
+     */
+    void execute();
+
+    /**
+     * @brief Record a named gate applied to device wires.
+     */
+    void addOperation(const std::string &name, const std::vector<double> &params,
+                      const std::vector<size_t> &wires, bool inverse,
+                      const std::vector<size_t> &controlled_wires,
+                      const std::vector<bool> &controlled_values, size_t device_num_qubits);
+
+    /**
+     * @brief Record a unitary matrix applied to device wires.
+     */
+    void addMatrixOperation(const std::vector<std::complex<double>> &matrix,
+                            const std::vector<size_t> &wires, bool inverse,
+                            const std::vector<size_t> &controlled_wires,
+                            const std::vector<bool> &controlled_values, size_t device_num_qubits);
+
+    /**
+     * @brief Track the structure of an observable created by the device under the given key.
+     * Hermitian observables are not supported.
+     */
+    void addNamedObservable(ObsIdType key, ObsId id, const std::vector<size_t> &wires);
+    void addTensorObservable(ObsIdType key, const std::vector<ObsIdType> &obs);
+    void addHamiltonianObservable(ObsIdType key, const std::vector<double> &coeffs,
+                                  const std::vector<ObsIdType> &obs);
+
+    /**
+     * @brief Record a measurement in the recording step, or return its result for the current
+     * lane in the replay step.
+     */
+    auto expval(ObsIdType key, size_t device_num_qubits) -> double;
+    auto var(ObsIdType key, size_t device_num_qubits) -> double;
+    void probs(DataView<double, 1> &probs, const std::vector<size_t> &wires,
+               size_t device_num_qubits);
+    void state(DataView<std::complex<double>, 1> &state, size_t device_num_qubits);
+};
+} // namespace Catalyst::Runtime::Simulator
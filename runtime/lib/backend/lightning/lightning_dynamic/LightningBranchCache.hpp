@@ -0,0 +1,218 @@
+// Copyright 2024 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <complex>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "LightningPrefixCache.hpp"
+
+namespace Catalyst::Runtime::Simulator {
+
+/**
+ * @brief The LightningBranchCache shares the branches of mid-circuit measurements between the
+ * consecutive executions of the same circuit, such as the executions of a loop over shots.
+ *
+ * Once enabled, the gates applied to each freshly allocated register are deferred, and the cache
+ * walks a tree of the measurement outcomes instead. Each node holds the state of a branch, and
+ * each mid-circuit measurement reached from a node after the same gates, on the same wire, holds
+ * the probabilities of its outcomes and the collapsed state of each outcome drawn so far. The
+ * executions that follow a cached branch then draw the outcome from the cached probabilities and
+ * move to the child node, without simulating any gate. With `k` measurements, the executions of a
+ * circuit simulate at most `2^k` branches, however many shots they are split into, and the shots
+ * are allocated to the branches multinomially.
+ *
+ * The deferred gates are applied on top of the state of the current node when any other
+ * instruction is reached, which ends the walk for the current execution. The states are stored
+ * up to a budget of amplitudes; the branches that do not fit are simulated as usual.
+ */
+class LightningBranchCache {
+  public:
+    using Gate = LightningPrefixCache::Gate;
+    using State = std::shared_ptr<const std::vector<std::complex<double>>>;
+
+    struct Node;
+
+    // A mid-circuit measurement on a device wire, reached from a node after the given gates
+    struct Measurement {
+        std::vector<Gate> gates;
+        size_t wire;
+        std::vector<double> probs;
+        std::array<std::unique_ptr<Node>, 2> branches{};
+    };
+
+    struct Node {
+        // The state of the branch, or nullptr for the all-zero state of the root
+        State state{nullptr};
+        std::vector<Measurement> measurements{};
+        // The states reached from the branch after the given gates, at the end of the walk
+        std::vector<std::pair<std::vector<Gate>, State>> final_states{};
+    };
+
+  private:
+    bool enabled{false};
+    bool tracing{false};
+
+    size_t max_amplitudes{0};
+    size_t num_amplitudes{0};
+    size_t num_qubits{0};
+
+    std::unique_ptr<Node> root{nullptr};
+    Node *node{nullptr};
+    std::vector<Gate> deferred{};
+
+    [[nodiscard]] auto stateSize() const -> size_t { return size_t{1} << num_qubits; }
+
+    auto storeState(std::vector<std::complex<double>> &&data) -> State
+    {
+        num_amplitudes += data.size();
+        return std::make_shared<const std::vector<std::complex<double>>>(std::move(data));
+    }
+
+  public:
+    LightningBranchCache() = default;
+    ~LightningBranchCache() = default;
+
+    LightningBranchCache(const LightningBranchCache &) = delete;
+    LightningBranchCache &operator=(const LightningBranchCache &) = delete;
+    LightningBranchCache(LightningBranchCache &&) = delete;
+    LightningBranchCache &operator=(LightningBranchCache &&) = delete;
+
+    /**
+     * @brief Walk the branches of the registers allocated from now on, storing at most
+     * `max_amplitudes` amplitudes of branch states.
+     */
+    void enable(size_t max_amplitudes) noexcept
+    {
+        enabled = true;
+        this->max_amplitudes = max_amplitudes;
+    }
+
+    [[nodiscard]] auto isEnabled() const -> bool { return enabled; }
+
+    [[nodiscard]] auto isTracing() const -> bool { return tracing; }
+
+    /**
+     * @brief Start walking the branches from the root for a freshly allocated register of
+     * `num_qubits` qubits. The branches of registers of another size are dropped.
+     */
+    void startExecution(size_t num_qubits)
+    {
+        if (!enabled) {
+            return;
+        }
+        if (!root || num_qubits != this->num_qubits) {
+            root = std::make_unique<Node>();
+            num_amplitudes = 0;
+            this->num_qubits = num_qubits;
+        }
+        node = root.get();
+        deferred.clear();
+        tracing = true;
+    }
+
+    /**
+     * @brief Stop walking the branches, once the device holds the state of the current execution.
+     */
+    void stopExecution() noexcept
+    {
+        node = nullptr;
+        deferred.clear();
+        tracing = false;
+    }
+
+    void deferGate(Gate &&gate) { deferred.push_back(std::move(gate)); }
+
+    [[nodiscard]] auto getDeferredGates() const -> std::span<const Gate> { return deferred; }
+
+    [[nodiscard]] auto getState() const -> const State & { return node->state; }
+
+    /**
+     * @brief Whether the state of a new branch fits in the budget.
+     */
+    [[nodiscard]] auto canStore() const -> bool
+    {
+        return num_amplitudes + stateSize() <= max_amplitudes;
+    }
+
+    /**
+     * @brief Find the measurement on `wire` reached from the current node after the deferred
+     * gates, if it was reached before.
+     */
+    auto findMeasurement(size_t wire) -> Measurement *
+    {
+        for (auto &measurement : node->measurements) {
+            if (measurement.wire == wire && measurement.gates == deferred) {
+                return &measurement;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Add the measurement on `wire` reached from the current node after the deferred
+     * gates, with the given probabilities of its outcomes.
+     */
+    auto addMeasurement(size_t wire, std::vector<double> &&probs) -> Measurement &
+    {
+        return node->measurements.emplace_back(Measurement{deferred, wire, std::move(probs)});
+    }
+
+    void storeBranch(Measurement &measurement, bool outcome,
+                     std::vector<std::complex<double>> &&data)
+    {
+        measurement.branches[outcome] = std::make_unique<Node>();
+        measurement.branches[outcome]->state = storeState(std::move(data));
+    }
+
+    /**
+     * @brief Move to the branch of the given outcome, whose state must have been stored.
+     */
+    void enterBranch(const Measurement &measurement, bool outcome)
+    {
+        node = measurement.branches[outcome].get();
+        deferred.clear();
+    }
+
+    /**
+     * @brief The state reached from the current node after the deferred gates, if it was
+     * stored before.
+     */
+    [[nodiscard]] auto findFinalState() const -> State
+    {
+        for (const auto &[gates, state] : node->final_states) {
+            if (gates == deferred) {
+                return state;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Store the state reached from the current node after the deferred gates. The states
+     * reached from the root are left out, as they do not follow any measurement.
+     */
+    void storeFinalState(std::vector<std::complex<double>> &&data)
+    {
+        if (node != root.get() && canStore()) {
+            node->final_states.emplace_back(deferred, storeState(std::move(data)));
+        }
+    }
+};
+} // namespace Catalyst::Runtime::Simulator
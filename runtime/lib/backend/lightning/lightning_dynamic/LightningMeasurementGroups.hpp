@@ -0,0 +1,219 @@
+// Copyright 2024 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Exception.hpp"
+#include "Types.h"
+
+namespace Catalyst::Runtime::Simulator {
+
+// A Pauli word, as the Pauli operator ('X', 'Y' or 'Z') acting on each of its device wires
+using PauliWordT = std::map<size_t, char>;
+
+// A real linear combination of Pauli words
+using PauliSumT = std::vector<std::pair<double, PauliWordT>>;
+
+/**
+ * @brief The LightningMeasurementGroups estimates the shot-based measurements of observables that
+ * qubit-wise commute from a shared set of samples.
+ *
+ * The announced observables that are linear combinations of Pauli words are partitioned into
+ * groups whose words apply the same Pauli operator to every common wire. The samples of a group
+ * are drawn once, in the basis that diagonalizes all of its observables, at its first
+ * measurement, and released after its last one.
+ */
+class LightningMeasurementGroups {
+  private:
+    struct Group {
+        // The Pauli operator diagonalized on each wire, the other wires are sampled in the
+        // computational basis
+        PauliWordT basis;
+        size_t num_pending{0};
+        std::optional<std::vector<size_t>> samples{std::nullopt};
+    };
+
+    struct GroupedObs {
+        size_t group;
+        PauliSumT sum;
+        size_t num_pending;
+    };
+
+    std::vector<Group> groups{};
+    std::unordered_map<ObsIdType, GroupedObs> grouped_obs{};
+
+    // Whether two Pauli words apply the same operator to their common wires
+    [[nodiscard]] static auto commute(const PauliWordT &lhs, const PauliWordT &rhs) -> bool
+    {
+        return std::all_of(lhs.begin(), lhs.end(), [&rhs](const auto &wire_pauli) {
+            auto &&it = rhs.find(wire_pauli.first);
+            return it == rhs.end() || it->second == wire_pauli.second;
+        });
+    }
+
+  public:
+    LightningMeasurementGroups() = default;
+    ~LightningMeasurementGroups() = default;
+
+    LightningMeasurementGroups(const LightningMeasurementGroups &) = delete;
+    LightningMeasurementGroups &operator=(const LightningMeasurementGroups &) = delete;
+    LightningMeasurementGroups(LightningMeasurementGroups &&) = delete;
+    LightningMeasurementGroups &operator=(LightningMeasurementGroups &&) = delete;
+
+    /**
+     * @brief Drop the groups and their samples.
+     */
+    void clear()
+    {
+        this->groups.clear();
+        this->grouped_obs.clear();
+    }
+
+    /**
+     * @brief Partition the given observables into qubit-wise commuting groups, replacing the
+     * previous groups. An observable given several times is measured as many times.
+     *
+     * @param observables The observable keys with their decompositions into Pauli words
+     */
+    void group(const std::vector<std::pair<ObsIdType, PauliSumT>> &observables)
+    {
+        this->clear();
+
+        for (const auto &[key, sum] : observables) {
+            if (auto &&it = this->grouped_obs.find(key); it != this->grouped_obs.end()) {
+                it->second.num_pending++;
+                this->groups[it->second.group].num_pending++;
+                continue;
+            }
+
+            // The words of a single observable must commute for it to be sampled in one basis.
+            PauliWordT basis;
+            const bool commuting = std::all_of(sum.begin(), sum.end(), [&basis](const auto &term) {
+                if (!commute(basis, term.second)) {
+                    return false;
+                }
+                basis.insert(term.second.begin(), term.second.end());
+                return true;
+            });
+            if (!commuting) {
+                continue;
+            }
+
+            auto &&it = std::find_if(this->groups.begin(), this->groups.end(),
+                                     [&basis](const auto &g) { return commute(g.basis, basis); });
+            if (it == this->groups.end()) {
+                it = this->groups.insert(this->groups.end(), Group{});
+            }
+            it->basis.insert(basis.begin(), basis.end());
+            it->num_pending++;
+
+            const auto group = static_cast<size_t>(std::distance(this->groups.begin(), it));
+            this->grouped_obs.emplace(key, GroupedObs{group, sum, 1});
+        }
+    }
+
+    /**
+     * @brief Check whether a measurement of the observable is pending in a group.
+     */
+    [[nodiscard]] auto contains(ObsIdType key) const -> bool
+    {
+        return this->grouped_obs.contains(key);
+    }
+
+    /**
+     * @brief Get the basis in which the group of the observable is sampled.
+     */
+    [[nodiscard]] auto getBasis(ObsIdType key) const -> const PauliWordT &
+    {
+        return this->groups[this->grouped_obs.at(key).group].basis;
+    }
+
+    /**
+     * @brief Check whether the samples of the group of the observable have been drawn.
+     */
+    [[nodiscard]] auto hasSamples(ObsIdType key) const -> bool
+    {
+        return this->groups[this->grouped_obs.at(key).group].samples.has_value();
+    }
+
+    /**
+     * @brief Set the samples of the group of the observable, as the indices of the sampled
+     * basis states of the group basis.
+     */
+    void setSamples(ObsIdType key, std::vector<size_t> &&samples)
+    {
+        this->groups[this->grouped_obs.at(key).group].samples = std::move(samples);
+    }
+
+    /**
+     * @brief Estimate the expectation value and the variance of the observable from the samples
+     * of its group, and complete one of its pending measurements.
+     *
+     * @param key The observable key
+     * @param num_qubits The number of qubits of the sampled states
+     * @return std::pair<double, double> The expectation value and the variance
+     */
+    auto estimate(ObsIdType key, size_t num_qubits) -> std::pair<double, double>
+    {
+        auto &&obs_it = this->grouped_obs.find(key);
+        RT_FAIL_IF(obs_it == this->grouped_obs.end(), "Invalid key for grouped measurements");
+        auto &obs = obs_it->second;
+        auto &group = this->groups[obs.group];
+        RT_FAIL_IF(!group.samples.has_value(), "The samples of the group have not been drawn");
+
+        // Each word is measured by the parity of the bits of its wires in the group basis, where
+        // wire 0 is the most significant bit of the sampled index.
+        std::vector<std::pair<double, uint64_t>> masks;
+        masks.reserve(obs.sum.size());
+        for (const auto &[coeff, word] : obs.sum) {
+            uint64_t mask = 0;
+            for (const auto &[wire, pauli] : word) {
+                mask |= uint64_t{1} << (num_qubits - 1 - wire);
+            }
+            masks.emplace_back(coeff, mask);
+        }
+
+        const auto &samples = group.samples.value();
+        double sum = 0;
+        double sum_squares = 0;
+        for (size_t idx : samples) {
+            double value = 0;
+            for (const auto &[coeff, mask] : masks) {
+                value += (std::popcount(idx & mask) & 1) ? -coeff : coeff;
+            }
+            sum += value;
+            sum_squares += value * value;
+        }
+        const double mean = sum / static_cast<double>(samples.size());
+        const double variance = sum_squares / static_cast<double>(samples.size()) - mean * mean;
+
+        if (!--obs.num_pending) {
+            this->grouped_obs.erase(obs_it);
+        }
+        if (!--group.num_pending) {
+            group.samples.reset();
+        }
+        return {mean, variance};
+    }
+};
+} // namespace Catalyst::Runtime::Simulator
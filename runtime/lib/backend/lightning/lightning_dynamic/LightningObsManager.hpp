@@ -15,11 +15,13 @@
 #pragma once
 
 #include <array>
+#include <optional>
 #include <stdexcept>
 #include <tuple>
 #include <utility>
 
 #include "Exception.hpp"
+#include "LightningMeasurementGroups.hpp"
 #include "Types.h"
 #include "Utils.hpp"
 
@@ -47,6 +49,9 @@ template <typename PrecisionT> class LightningObsManager {
     using ObservablePairType = std::pair<std::shared_ptr<Observable<VectorStateT>>, ObsType>;
     std::vector<ObservablePairType> observables_{};
 
+    // The decomposition of each observable into Pauli words, if it is a combination of them
+    std::vector<std::optional<PauliSumT>> pauli_sums_{};
+
   public:
     LightningObsManager() = default;
     ~LightningObsManager() = default;
@@ -59,7 +64,11 @@ template <typename PrecisionT> class LightningObsManager {
     /**
      * @brief A helper function to clear constructed observables in the program.
      */
-    void clear() { observables_.clear(); }
+    void clear()
+    {
+        observables_.clear();
+        pauli_sums_.clear();
+    }
 
     /**
      * @brief Check the validity of observable keys.
@@ -86,6 +95,19 @@ template <typename PrecisionT> class LightningObsManager {
         return std::get<0>(observables_[key]);
     }
 
+    /**
+     * @brief Get the decomposition of the observable into Pauli words.
+     *
+     * @param key The observable key
+     * @return std::optional<PauliSumT> The weighted Pauli words, or `std::nullopt` if the
+     * observable is not a linear combination of Pauli words
+     */
+    [[nodiscard]] auto getPauliSum(ObsIdType key) const -> const std::optional<PauliSumT> &
+    {
+        RT_FAIL_IF(!isValidObservables({key}), "Invalid observable key");
+        return pauli_sums_[key];
+    }
+
     /**
      * @brief Get the number of observables.
      *
@@ -108,6 +130,23 @@ template <typename PrecisionT> class LightningObsManager {
 
         observables_.push_back(std::make_pair(
             std::make_shared<NamedObs<VectorStateT>>(obs_str, wires), ObsType::Basic));
+
+        switch (obsId) {
+        case ObsId::Identity:
+            pauli_sums_.push_back(PauliSumT{{1.0, {}}});
+            break;
+        case ObsId::PauliX:
+            pauli_sums_.push_back(PauliSumT{{1.0, {{wires[0], 'X'}}}});
+            break;
+        case ObsId::PauliY:
+            pauli_sums_.push_back(PauliSumT{{1.0, {{wires[0], 'Y'}}}});
+            break;
+        case ObsId::PauliZ:
+            pauli_sums_.push_back(PauliSumT{{1.0, {{wires[0], 'Z'}}}});
+            break;
+        default:
+            pauli_sums_.push_back(std::nullopt);
+        }
         return static_cast<ObsIdType>(observables_.size() - 1);
     }
 
@@ -124,6 +163,7 @@ template <typename PrecisionT> class LightningObsManager {
         observables_.push_back(std::make_pair(
             std::make_shared<HermitianObs<VectorStateT>>(HermitianObs<VectorStateT>{matrix, wires}),
             ObsType::Basic));
+        pauli_sums_.push_back(std::nullopt);
 
         return static_cast<ObsIdType>(observables_.size() - 1);
     }
@@ -142,15 +182,33 @@ template <typename PrecisionT> class LightningObsManager {
         std::vector<std::shared_ptr<Observable<VectorStateT>>> obs_vec;
         obs_vec.reserve(key_size);
 
+        // The product of single Pauli words acting on distinct wires is a Pauli word.
+        std::optional<PauliSumT> pauli_sum = PauliSumT{{1.0, {}}};
+
         for (const auto &key : obsKeys) {
             RT_FAIL_IF(static_cast<size_t>(key) >= obs_size || key < 0, "Invalid observable key");
 
             auto &&[obs, type] = observables_[key];
             obs_vec.push_back(obs);
+
+            const auto &factor = pauli_sums_[key];
+            if (!pauli_sum || !factor || factor->size() != 1) {
+                pauli_sum = std::nullopt;
+                continue;
+            }
+            auto &[coeff, word] = pauli_sum->front();
+            coeff *= factor->front().first;
+            for (const auto &wire_pauli : factor->front().second) {
+                if (!word.insert(wire_pauli).second) {
+                    pauli_sum = std::nullopt;
+                    break;
+                }
+            }
         }
 
         observables_.push_back(
             std::make_pair(TensorProdObs<VectorStateT>::create(obs_vec), ObsType::TensorProd));
+        pauli_sums_.push_back(std::move(pauli_sum));
 
         return static_cast<ObsIdType>(obs_size);
     }
@@ -175,11 +233,23 @@ template <typename PrecisionT> class LightningObsManager {
         std::vector<std::shared_ptr<Observable<VectorStateT>>> obs_vec;
         obs_vec.reserve(key_size);
 
-        for (auto key : obsKeys) {
+        std::optional<PauliSumT> pauli_sum = PauliSumT{};
+
+        for (size_t idx = 0; idx < key_size; idx++) {
+            const auto key = obsKeys[idx];
             RT_FAIL_IF(static_cast<size_t>(key) >= obs_size || key < 0, "Invalid observable key");
 
             auto &&[obs, type] = observables_[key];
             obs_vec.push_back(obs);
+
+            const auto &term = pauli_sums_[key];
+            if (!pauli_sum || !term) {
+                pauli_sum = std::nullopt;
+                continue;
+            }
+            for (const auto &[coeff, word] : term.value()) {
+                pauli_sum->emplace_back(coeffs[idx] * coeff, word);
+            }
         }
 
         observables_.push_back(std::make_pair(
@@ -187,6 +257,7 @@ template <typename PrecisionT> class LightningObsManager {
                 Pennylane::LightningQubit::Observables::Hamiltonian<VectorStateT>(
                     coeffs, std::move(obs_vec))),
             ObsType::Hamiltonian));
+        pauli_sums_.push_back(std::move(pauli_sum));
 
         return static_cast<ObsIdType>(obs_size);
     }
@@ -0,0 +1,204 @@
+// Copyright 2024 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <complex>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Catalyst::Runtime::Simulator {
+
+/**
+ * @brief The LightningPrefixCache shares the circuit prefix common to consecutive executions of
+ * variants of the same circuit, such as the shifted circuits of the parameter-shift rule.
+ *
+ * Once enabled, the cache traces the gates applied to each freshly allocated register. When an
+ * execution reaches a point where the variants diverge, the device snapshots the state and the
+ * cache keeps the traced gates as the prefix of the snapshot. The next executions then skip the
+ * gates that match the prefix, and the device restores the snapshot instead of simulating them
+ * when the first gate that does not match the prefix, or any other instruction, is reached. If
+ * an execution diverges from the prefix before reaching its end, the skipped gates are replayed
+ * from the initial state, so that the cache never changes the results of a circuit.
+ */
+class LightningPrefixCache {
+  public:
+    // A gate applied to device wires: a named gate, a `QubitUnitary` matrix, a `QFT`, or a
+    // `PauliRot` of the given Pauli word.
+    struct Gate {
+        std::string name;
+        std::string pauli_word;
+        std::vector<double> params;
+        std::vector<std::complex<double>> matrix;
+        std::vector<size_t> wires;
+        std::vector<size_t> controlled_wires;
+        std::vector<bool> controlled_values;
+        bool inverse;
+
+        bool operator==(const Gate &other) const = default;
+    };
+
+  private:
+    bool enabled{false};
+    bool tracing{false};
+    bool skipping{false};
+
+    // Whether the current execution reached a checkpoint
+    bool checkpointed{false};
+
+    // The gates applied to the register of the current execution
+    std::vector<Gate> trace{};
+
+    // The gates that prepared the snapshot, the number of qubits of the snapshot, and the number
+    // of gates of the prefix matched by the current execution
+    std::vector<Gate> prefix{};
+    std::optional<size_t> snapshot_id{std::nullopt};
+    size_t snapshot_num_qubits{0};
+    size_t num_matched{0};
+
+  public:
+    LightningPrefixCache() = default;
+    ~LightningPrefixCache() = default;
+
+    LightningPrefixCache(const LightningPrefixCache &) = delete;
+    LightningPrefixCache &operator=(const LightningPrefixCache &) = delete;
+    LightningPrefixCache(LightningPrefixCache &&) = delete;
+    LightningPrefixCache &operator=(LightningPrefixCache &&) = delete;
+
+    /**
+     * @brief Trace the registers allocated from now on.
+     */
+    void enable() noexcept { enabled = true; }
+
+    [[nodiscard]] auto isEnabled() const -> bool { return enabled; }
+
+    [[nodiscard]] auto isTracing() const -> bool { return tracing; }
+
+    [[nodiscard]] auto isSkipping() const -> bool { return skipping; }
+
+    /**
+     * @brief Start tracing a freshly allocated register of `num_qubits` qubits, and skip the gates
+     * of the prefix if the register matches the snapshot.
+     */
+    void startExecution(size_t num_qubits)
+    {
+        trace.clear();
+        tracing = enabled;
+        skipping = tracing && snapshot_id.has_value() && num_qubits == snapshot_num_qubits;
+        num_matched = 0;
+    }
+
+    /**
+     * @brief Stop tracing the current register, whose state no longer follows from its gates.
+     * This must be called once the skipped gates have been resumed.
+     */
+    void stopExecution() noexcept
+    {
+        trace.clear();
+        tracing = false;
+        skipping = false;
+    }
+
+    /**
+     * @brief Mark that the current execution reached a checkpoint, and may thus share its prefix
+     * with the next executions.
+     */
+    void checkpoint() noexcept { checkpointed = true; }
+
+    /**
+     * @brief Stop tracing the register of an execution that ended. The cache is disabled once an
+     * execution reached no checkpoint, as the executions no longer share a prefix.
+     *
+     * @return the snapshot of the disabled cache, to release
+     */
+    auto finishExecution() noexcept -> std::optional<size_t>
+    {
+        stopExecution();
+        if (std::exchange(checkpointed, false) || !enabled) {
+            return std::nullopt;
+        }
+        enabled = false;
+        prefix.clear();
+        snapshot_num_qubits = 0;
+        num_matched = 0;
+        return std::exchange(snapshot_id, std::nullopt);
+    }
+
+    /**
+     * @brief Skip the given gate if it is the next gate of the prefix. A gate that is not
+     * skipped must only be applied and traced once the skipped gates have been resumed.
+     *
+     * @return true if the gate is part of the prefix and must not be applied
+     */
+    auto skipGate(const Gate &gate) -> bool
+    {
+        if (skipping && num_matched < prefix.size() && prefix[num_matched] == gate) {
+            num_matched++;
+            return true;
+        }
+        return false;
+    }
+
+    void traceGate(Gate &&gate)
+    {
+        if (tracing) {
+            trace.push_back(std::move(gate));
+        }
+    }
+
+    /**
+     * @brief Whether the current execution skipped every gate of the prefix, such that the
+     * snapshot holds its state.
+     */
+    [[nodiscard]] auto atSnapshot() const -> bool
+    {
+        return skipping && num_matched == prefix.size();
+    }
+
+    /**
+     * @brief The skipped gates, to replay from the initial state when the current execution
+     * diverged from the prefix before reaching the snapshot.
+     */
+    [[nodiscard]] auto getSkippedGates() const -> std::span<const Gate>
+    {
+        return std::span<const Gate>{prefix}.first(num_matched);
+    }
+
+    /**
+     * @brief Stop skipping gates once the device has restored the snapshot or replayed the
+     * skipped gates.
+     */
+    void resume()
+    {
+        trace.assign(prefix.begin(), prefix.begin() + num_matched);
+        skipping = false;
+    }
+
+    [[nodiscard]] auto getSnapshot() const -> std::optional<size_t> { return snapshot_id; }
+
+    /**
+     * @brief Use the given snapshot of the current state, prepared by the traced gates, as the
+     * new prefix.
+     */
+    void setSnapshot(size_t id, size_t num_qubits)
+    {
+        prefix = trace;
+        snapshot_id = id;
+        snapshot_num_qubits = num_qubits;
+    }
+};
+} // namespace Catalyst::Runtime::Simulator
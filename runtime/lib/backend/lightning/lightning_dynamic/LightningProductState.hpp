@@ -0,0 +1,210 @@
+// Copyright 2024 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <complex>
+#include <memory>
+#include <vector>
+
+namespace Catalyst::Runtime::Simulator {
+
+/**
+ * @brief The LightningProductState holds the state of a freshly allocated register as a tensor
+ * product of independent factors, until its qubits are entangled.
+ *
+ * Each qubit starts in a factor of its own, and a gate is applied to the factor holding its wires.
+ * The factors of the wires of a gate are merged into one beforehand, so that a factor only grows
+ * with the qubits entangled with it. Circuits that act on unentangled qubits for a long time, such
+ * as data-encoding layers, then apply their first gates to states of a few amplitudes. The dense
+ * state of the whole register is only expanded from the factors once a gate would entangle all of
+ * its qubits, or when any other instruction is reached.
+ */
+template <class StateVectorT> class LightningProductState {
+  public:
+    struct Factor {
+        // The device wires of the factor, the first being its most significant wire
+        std::vector<size_t> wires;
+        std::unique_ptr<StateVectorT> sv;
+
+        /**
+         * @brief The wires of the factor state for the given device wires of the factor.
+         */
+        [[nodiscard]] auto getLocalWires(const std::vector<size_t> &dev_wires) const
+            -> std::vector<size_t>
+        {
+            std::vector<size_t> local_wires;
+            local_wires.reserve(dev_wires.size());
+            for (auto wire : dev_wires) {
+                local_wires.push_back(std::find(wires.begin(), wires.end(), wire) - wires.begin());
+            }
+            return local_wires;
+        }
+    };
+
+  private:
+    bool tracing{false};
+    size_t num_qubits{0};
+
+    std::vector<Factor> factors{};
+    // The index of the factor of each device wire
+    std::vector<size_t> factor_ids{};
+
+    void updateFactorIds()
+    {
+        for (size_t id = 0; id < factors.size(); id++) {
+            for (auto wire : factors[id].wires) {
+                factor_ids[wire] = id;
+            }
+        }
+    }
+
+  public:
+    LightningProductState() = default;
+    ~LightningProductState() = default;
+
+    LightningProductState(const LightningProductState &) = delete;
+    LightningProductState &operator=(const LightningProductState &) = delete;
+    LightningProductState(LightningProductState &&) = delete;
+    LightningProductState &operator=(LightningProductState &&) = delete;
+
+    [[nodiscard]] auto isTracing() const -> bool { return tracing; }
+
+    [[nodiscard]] auto getNumQubits() const -> size_t { return num_qubits; }
+
+    /**
+     * @brief Hold a freshly allocated register of `num_qubits` qubits in the all-zero state, with
+     * one factor per qubit.
+     */
+    void startExecution(size_t num_qubits)
+    {
+        this->num_qubits = num_qubits;
+        factors.clear();
+        factors.reserve(num_qubits);
+        for (size_t wire = 0; wire < num_qubits; wire++) {
+            factors.push_back(Factor{{wire}, std::make_unique<StateVectorT>(1)});
+        }
+        factor_ids.resize(num_qubits);
+        updateFactorIds();
+        tracing = true;
+    }
+
+    /**
+     * @brief Stop holding the factors, once the device holds the dense state of the register.
+     */
+    void stopExecution() noexcept
+    {
+        factors.clear();
+        factor_ids.clear();
+        num_qubits = 0;
+        tracing = false;
+    }
+
+    /**
+     * @brief Merge the factors of the given device wires into a single factor, whose wires are the
+     * wires of the merged factors one after the other.
+     *
+     * @return The merged factor, or nullptr if it would hold every qubit of the register, in
+     * which case the factors are left unchanged.
+     */
+    auto merge(const std::vector<size_t> &dev_wires) -> Factor *
+    {
+        std::vector<size_t> ids;
+        for (auto wire : dev_wires) {
+            ids.push_back(factor_ids[wire]);
+        }
+        std::sort(ids.begin(), ids.end());
+        ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+
+        if (ids.size() == 1) {
+            return factors[ids.front()].wires.size() < num_qubits ? &factors[ids.front()]
+                                                                  : nullptr;
+        }
+
+        size_t num_wires = 0;
+        for (auto id : ids) {
+            num_wires += factors[id].wires.size();
+        }
+        if (num_wires == num_qubits) {
+            return nullptr;
+        }
+
+        // data[i * 2^k + j] = lhs[i] * rhs[j], with the k wires of rhs after the wires of lhs
+        std::vector<size_t> wires;
+        std::vector<std::complex<double>> data{std::complex<double>{1, 0}};
+        for (auto id : ids) {
+            const auto &factor = factors[id];
+            const auto *rhs = factor.sv->getData();
+            const size_t rhs_size = factor.sv->getLength();
+
+            std::vector<std::complex<double>> product(data.size() * rhs_size);
+            for (size_t i = 0; i < data.size(); i++) {
+                for (size_t j = 0; j < rhs_size; j++) {
+                    product[i * rhs_size + j] = data[i] * rhs[j];
+                }
+            }
+            data = std::move(product);
+            wires.insert(wires.end(), factor.wires.begin(), factor.wires.end());
+        }
+
+        for (auto it = ids.rbegin(); it != ids.rend(); it++) {
+            factors.erase(factors.begin() + static_cast<std::ptrdiff_t>(*it));
+        }
+        factors.push_back(
+            Factor{std::move(wires), std::make_unique<StateVectorT>(data.data(), data.size())});
+        updateFactorIds();
+        return &factors.back();
+    }
+
+    /**
+     * @brief Write the dense state of the register, the tensor product of the factors, to `data`
+     * of size `2^num_qubits`, the first device wire being the most significant one.
+     */
+    void expand(std::complex<double> *data) const
+    {
+        std::fill(data, data + (size_t{1} << num_qubits), std::complex<double>{0, 0});
+        data[0] = {1, 0};
+
+        // The amplitudes are only non-zero on the bits of the expanded factors, so that each
+        // factor multiplies the amplitudes of the subsets of these bits in place.
+        size_t mask = 0;
+        for (const auto &factor : factors) {
+            const size_t num_wires = factor.wires.size();
+            const auto *amplitudes = factor.sv->getData();
+
+            std::vector<size_t> offsets(size_t{1} << num_wires, 0);
+            for (size_t local = 0; local < offsets.size(); local++) {
+                for (size_t bit = 0; bit < num_wires; bit++) {
+                    if ((local >> (num_wires - 1 - bit)) & 1) {
+                        offsets[local] |= size_t{1} << (num_qubits - 1 - factor.wires[bit]);
+                    }
+                }
+            }
+
+            for (size_t subset = mask;; subset = (subset - 1) & mask) {
+                const auto amplitude = data[subset];
+                for (size_t local = offsets.size() - 1; local > 0; local--) {
+                    data[subset | offsets[local]] = amplitude * amplitudes[local];
+                }
+                data[subset] = amplitude * amplitudes[0];
+                if (!subset) {
+                    break;
+                }
+            }
+            mask |= offsets.back();
+        }
+    }
+};
+} // namespace Catalyst::Runtime::Simulator
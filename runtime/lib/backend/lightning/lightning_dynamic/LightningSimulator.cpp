@@ -23,6 +23,8 @@ namespace Catalyst::Runtime::Simulator {
 
 auto LightningSimulator::AllocateQubit() -> QubitIdType
 {
+    this->stopPrefix();
+    this->measurement_groups.clear();
     size_t sv_id = this->device_sv->allocateWire();
     return this->qubit_manager.Allocate(sv_id);
 }
@@ -35,7 +37,21 @@ auto LightningSimulator::AllocateQubits(size_t num_qubits) -> std::vector<QubitI
 
     // at the first call when num_qubits == 0
     if (!this->GetNumQubits()) {
-        this->device_sv = std::make_unique<StateVectorT>(num_qubits);
+        this->measurement_groups.clear();
+        if (!this->tape_recording && !this->batch) {
+            this->prefix_cache.startExecution(num_qubits);
+            this->branch_cache.startExecution(num_qubits);
+        }
+
+        // The register is held as a product state when enabled and its gates are not traced
+        // otherwise, and its dense state is only allocated once needed.
+        if (this->product_state_enabled && !this->tape_recording && !this->batch &&
+            !this->isTracingGates()) {
+            this->product_state.startExecution(num_qubits);
+        }
+        else {
+            this->device_sv = std::make_unique<StateVectorT>(num_qubits);
+        }
         return this->qubit_manager.AllocateRange(0, num_qubits);
     }
 
@@ -46,23 +62,39 @@ auto LightningSimulator::AllocateQubits(size_t num_qubits) -> std::vector<QubitI
 
 void LightningSimulator::ReleaseAllQubits()
 {
+    // The prefix cache and its snapshot are only kept while the executions reach checkpoints.
+    if (const auto snapshot = this->prefix_cache.finishExecution()) {
+        this->snapshots.erase(snapshot.value());
+    }
+    this->branch_cache.stopExecution();
+    this->measurement_groups.clear();
     this->device_sv->clearData();
+    this->product_state.stopExecution();
     this->qubit_manager.ReleaseAll();
 }
 
 void LightningSimulator::ReleaseQubit(QubitIdType q)
 {
+    this->stopPrefix();
+    this->measurement_groups.clear();
     if (this->qubit_manager.isValidQubitId(q)) {
         this->device_sv->releaseWire(this->qubit_manager.getDeviceId(q));
     }
     this->qubit_manager.Release(q);
 }
 
-auto LightningSimulator::GetNumQubits() const -> size_t { return this->device_sv->getNumQubits(); }
+auto LightningSimulator::GetNumQubits() const -> size_t
+{
+    if (this->product_state.isTracing()) {
+        return this->product_state.getNumQubits();
+    }
+    return this->device_sv->getNumQubits();
+}
 
 void LightningSimulator::StartTapeRecording()
 {
     RT_FAIL_IF(this->tape_recording, "Cannot re-activate the cache manager");
+    this->stopPrefix();
     this->tape_recording = true;
     this->cache_manager.Reset();
 }
@@ -81,15 +113,307 @@ auto LightningSimulator::CacheManagerInfo()
             this->cache_manager.getObservablesKeys()};
 }
 
-void LightningSimulator::SetDeviceShots(size_t shots) { this->device_shots = shots; }
+void LightningSimulator::SetDeviceShots(size_t shots)
+{
+    this->measurement_groups.clear();
+    this->device_shots = shots;
+}
 
 auto LightningSimulator::GetDeviceShots() const -> size_t { return this->device_shots; }
 
+void LightningSimulator::SetDeviceSeed(uint64_t seed)
+{
+    this->gen = Catalyst::Runtime::Philox4x32{seed};
+    this->gen_stream = 0;
+}
+
+void LightningSimulator::StartBatch(size_t batch_size)
+{
+    RT_FAIL_IF(this->batch, "Cannot start a batched execution within another one");
+    RT_FAIL_IF(this->device_shots, "Batched execution is only supported in analytic mode");
+    RT_FAIL_IF(this->tape_recording, "Batched execution does not support gradients");
+    this->stopPrefix();
+    this->batch = std::make_unique<LightningBatch>(batch_size, this->num_threads);
+}
+
+void LightningSimulator::SetBatchLane(size_t lane)
+{
+    RT_FAIL_IF(!this->batch, "Cannot select a batch lane outside of a batched execution");
+    this->batch->setLane(lane);
+}
+
+void LightningSimulator::ExecuteBatch()
+{
+    RT_FAIL_IF(!this->batch, "Cannot execute a batch outside of a batched execution");
+    this->batch->execute();
+}
+
+void LightningSimulator::StopBatch() { this->batch.reset(); }
+
+auto LightningSimulator::Snapshot() -> size_t
+{
+    RT_FAIL_IF(this->batch, "State snapshots are not supported in batched execution");
+    this->resumePrefix();
+
+    auto &&state = this->device_sv->getDataVector();
+    const size_t id = this->next_snapshot_id++;
+    auto &&data =
+        std::make_shared<const std::vector<std::complex<double>>>(state.begin(), state.end());
+    this->snapshots.emplace(id, StateSnapshot{this->GetNumQubits(), std::move(data)});
+    return id;
+}
+
+void LightningSimulator::Restore(size_t id)
+{
+    RT_FAIL_IF(this->batch, "State snapshots are not supported in batched execution");
+
+    // The restored state no longer follows from the gates applied to the register.
+    this->prefix_cache.stopExecution();
+    this->branch_cache.stopExecution();
+    this->resumeProduct();
+    this->loadSnapshot(id);
+}
+
+void LightningSimulator::ReleaseSnapshot(size_t id)
+{
+    RT_FAIL_IF(!this->snapshots.erase(id), "Invalid snapshot id");
+}
+
+void LightningSimulator::loadSnapshot(size_t id)
+{
+    auto &&it = this->snapshots.find(id);
+    RT_FAIL_IF(it == this->snapshots.end(), "Invalid snapshot id");
+    RT_FAIL_IF(it->second.num_qubits != this->GetNumQubits(),
+               "Cannot restore a snapshot of a different number of qubits");
+
+    const auto &data = *it->second.data;
+    this->device_sv->updateData(data.data(), data.size());
+}
+
+void LightningSimulator::Checkpoint(bool diverges)
+{
+    // Registers are traced from the first checkpoint on, and tapes and batches, which need to see
+    // every gate, are never traced. The branch cache defers the gates itself.
+    if (this->tape_recording || this->batch || this->branch_cache.isEnabled()) {
+        return;
+    }
+    this->prefix_cache.checkpoint();
+    if (!this->prefix_cache.isEnabled()) {
+        this->prefix_cache.enable();
+        return;
+    }
+
+    // The snapshot already holds the state when every gate of its prefix was skipped.
+    if (!diverges || !this->prefix_cache.isTracing() || this->prefix_cache.atSnapshot()) {
+        return;
+    }
+
+    const auto previous = this->prefix_cache.getSnapshot();
+    const size_t id = this->Snapshot();
+    if (previous) {
+        this->snapshots.erase(previous.value());
+    }
+    this->prefix_cache.setSnapshot(id, this->GetNumQubits());
+}
+
+auto LightningSimulator::skipPrefixGate(LightningPrefixCache::Gate &&gate) -> bool
+{
+    if (this->product_state.isTracing()) {
+        if (this->applyFactorGate(gate)) {
+            return true;
+        }
+        this->resumeProduct();
+        return false;
+    }
+    if (this->branch_cache.isTracing()) {
+        this->branch_cache.deferGate(std::move(gate));
+        return true;
+    }
+    if (this->prefix_cache.skipGate(gate)) {
+        return true;
+    }
+
+    this->resumePrefix();
+    this->prefix_cache.traceGate(std::move(gate));
+    return false;
+}
+
+void LightningSimulator::resumePrefix()
+{
+    this->resumeProduct();
+    this->resumeBranch();
+    if (!this->prefix_cache.isSkipping()) {
+        return;
+    }
+
+    // Restore the snapshot if the execution skipped its entire prefix, and replay the skipped
+    // gates from the initial state otherwise.
+    if (this->prefix_cache.atSnapshot()) {
+        this->loadSnapshot(this->prefix_cache.getSnapshot().value());
+    }
+    else {
+        for (const auto &gate : this->prefix_cache.getSkippedGates()) {
+            this->applyGate(*this->device_sv, gate);
+        }
+    }
+    this->prefix_cache.resume();
+}
+
+void LightningSimulator::stopPrefix()
+{
+    this->resumePrefix();
+    this->prefix_cache.stopExecution();
+}
+
+void LightningSimulator::loadBranch()
+{
+    auto &&data = this->device_sv->getDataVector();
+    if (const auto &state = this->branch_cache.getState()) {
+        std::copy(state->begin(), state->end(), data.begin());
+    }
+    else {
+        std::fill(data.begin(), data.end(), std::complex<double>{0, 0});
+        data[0] = {1, 0};
+    }
+    for (const auto &gate : this->branch_cache.getDeferredGates()) {
+        this->applyGate(*this->device_sv, gate);
+    }
+}
+
+void LightningSimulator::resumeBranch()
+{
+    if (!this->branch_cache.isTracing()) {
+        return;
+    }
+
+    // Load the state the current branch reaches after the deferred gates, and simulate these
+    // gates the first time only.
+    if (const auto state = this->branch_cache.findFinalState()) {
+        this->device_sv->updateData(state->data(), state->size());
+    }
+    else {
+        this->loadBranch();
+        auto &&data = this->device_sv->getDataVector();
+        this->branch_cache.storeFinalState({data.begin(), data.end()});
+    }
+    this->branch_cache.stopExecution();
+}
+
+auto LightningSimulator::applyFactorGate(const LightningPrefixCache::Gate &gate) -> bool
+{
+    // The QFT kernel transforms wires that are contiguous in the dense state.
+    if (gate.name == "QFT") {
+        return false;
+    }
+
+    // A global phase applies to any factor.
+    std::vector<size_t> wires = gate.wires;
+    wires.insert(wires.end(), gate.controlled_wires.begin(), gate.controlled_wires.end());
+    if (wires.empty()) {
+        wires.push_back(0);
+    }
+
+    auto *factor = this->product_state.merge(wires);
+    if (!factor) {
+        return false;
+    }
+
+    LightningPrefixCache::Gate local_gate = gate;
+    local_gate.wires = factor->getLocalWires(gate.wires);
+    local_gate.controlled_wires = factor->getLocalWires(gate.controlled_wires);
+    this->applyGate(*factor->sv, local_gate);
+    return true;
+}
+
+void LightningSimulator::resumeProduct()
+{
+    if (!this->product_state.isTracing()) {
+        return;
+    }
+
+    // Allocate the dense state of the register, the tensor product of its factors.
+    this->device_sv = std::make_unique<StateVectorT>(this->product_state.getNumQubits());
+    this->product_state.expand(this->device_sv->getData());
+    this->product_state.stopExecution();
+}
+
+auto LightningSimulator::measureBranch(QubitIdType wire, std::optional<int32_t> postselect)
+    -> std::optional<bool>
+{
+    RT_FAIL_IF(!isValidQubit(wire), "Invalid given wire to measure");
+    const size_t dev_wire = this->qubit_manager.getDeviceId(wire);
+
+    // The state before the measurement is only simulated when the measurement is first reached,
+    // or when an outcome is first drawn.
+    bool loaded = false;
+    auto *measurement = this->branch_cache.findMeasurement(dev_wire);
+    if (!measurement) {
+        if (!this->branch_cache.canStore()) {
+            return std::nullopt;
+        }
+        this->loadBranch();
+        loaded = true;
+
+        Pennylane::LightningQubit::Measures::Measurements<StateVectorT> m{*(this->device_sv)};
+        measurement = &this->branch_cache.addMeasurement(dev_wire, m.probs({dev_wire}));
+    }
+
+    const bool outcome = Lightning::simulateDraw(measurement->probs, postselect,
+                                                 this->gen.uniform(this->gen_stream++, 0));
+
+    if (!measurement->branches[outcome]) {
+        if (!loaded) {
+            this->loadBranch();
+        }
+        this->collapseState(dev_wire, outcome);
+
+        // Continue the execution from the collapsed state when it does not fit in the cache.
+        if (!this->branch_cache.canStore()) {
+            this->branch_cache.stopExecution();
+            return outcome;
+        }
+        auto &&data = this->device_sv->getDataVector();
+        this->branch_cache.storeBranch(*measurement, outcome, {data.begin(), data.end()});
+    }
+    this->branch_cache.enterBranch(*measurement, outcome);
+    return outcome;
+}
+
+void LightningSimulator::applyGate(StateVectorT &sv, const LightningPrefixCache::Gate &gate)
+{
+    if (gate.name == "QFT") {
+        RT_FAIL_IF(gate.wires.empty(), "Invalid number of wires for QFT");
+        Lightning::applyQFTParallel(sv.getData(), sv.getNumQubits(), gate.wires.front(),
+                                    gate.wires.size(), gate.inverse, this->num_threads);
+    }
+    else if (gate.name == "PauliRot") {
+        const double theta = gate.params.front();
+        Lightning::applyPauliRotationParallel(sv.getData(), sv.getNumQubits(), gate.pauli_word,
+                                              gate.wires, gate.inverse ? -theta : theta,
+                                              this->num_threads);
+    }
+    else if (!gate.matrix.empty() && gate.controlled_wires.empty()) {
+        sv.applyMatrix(gate.matrix.data(), gate.wires, gate.inverse);
+    }
+    else if (!gate.matrix.empty()) {
+        sv.applyControlledMatrix(gate.matrix.data(), gate.controlled_wires,
+                                 gate.controlled_values, gate.wires, gate.inverse);
+    }
+    else if (gate.controlled_wires.empty()) {
+        sv.applyOperation(gate.name, gate.wires, gate.inverse, gate.params);
+    }
+    else {
+        sv.applyOperation(gate.name, gate.controlled_wires, gate.controlled_values, gate.wires,
+                          gate.inverse, gate.params);
+    }
+}
+
 void LightningSimulator::PrintState()
 {
     using std::cout;
     using std::endl;
 
+    this->resumePrefix();
     const size_t num_qubits = this->device_sv->getNumQubits();
     const size_t size = Pennylane::Util::exp2(num_qubits);
     size_t idx = 0;
@@ -127,6 +451,18 @@ void LightningSimulator::NamedOperation(const std::string &name, const std::vect
     auto &&dev_wires = getDeviceWires(wires);
     auto &&dev_controlled_wires = getDeviceWires(controlled_wires);
 
+    if (this->batch) {
+        this->batch->addOperation(name, params, dev_wires, inverse, dev_controlled_wires,
+                                  controlled_values, this->GetNumQubits());
+        return;
+    }
+
+    if (this->isTracingGates() &&
+        this->skipPrefixGate(
+            {name, {}, params, {}, dev_wires, dev_controlled_wires, controlled_values, inverse})) {
+        return;
+    }
+
     // Update the state-vector
     if (controlled_wires.empty()) {
         this->device_sv->applyOperation(name, dev_wires, inverse, params);
@@ -158,6 +494,18 @@ void LightningSimulator::MatrixOperation(const std::vector<std::complex<double>>
     auto &&dev_wires = getDeviceWires(wires);
     auto &&dev_controlled_wires = getDeviceWires(controlled_wires);
 
+    if (this->batch) {
+        this->batch->addMatrixOperation(matrix, dev_wires, inverse, dev_controlled_wires,
+                                        controlled_values, this->GetNumQubits());
+        return;
+    }
+
+    if (this->isTracingGates() &&
+        this->skipPrefixGate({"QubitUnitary", {}, {}, matrix, dev_wires, dev_controlled_wires,
+                              controlled_values, inverse})) {
+        return;
+    }
+
     // Update the state-vector
     if (controlled_wires.empty()) {
         this->device_sv->applyMatrix(matrix.data(), dev_wires, inverse);
@@ -174,6 +522,106 @@ void LightningSimulator::MatrixOperation(const std::vector<std::complex<double>>
     }
 }
 
+void LightningSimulator::QFT(const std::vector<QubitIdType> &wires, bool inverse,
+                             const std::vector<QubitIdType> &controlled_wires,
+                             const std::vector<bool> &controlled_values)
+{
+    RT_FAIL_IF(!isValidQubits(wires), "Given wires do not refer to qubits");
+    if (wires.empty()) {
+        return;
+    }
+
+    // The FFT kernel transforms a contiguous block of wires in place. Controlled transforms,
+    // recorded tapes, and batches, which need to see the individual gates, use the gate
+    // decomposition.
+    auto &&dev_wires = getDeviceWires(wires);
+    auto &&gap = std::adjacent_find(dev_wires.begin(), dev_wires.end(),
+                                    [](size_t lhs, size_t rhs) { return rhs != lhs + 1; });
+    const bool contiguous = gap == dev_wires.end();
+    if (!contiguous || !controlled_wires.empty() || this->tape_recording || this->batch) {
+        QuantumDevice::QFT(wires, inverse, controlled_wires, controlled_values);
+        return;
+    }
+
+    if (this->isTracingGates() &&
+        this->skipPrefixGate({"QFT", {}, {}, {}, dev_wires, {}, {}, inverse})) {
+        return;
+    }
+
+    Lightning::applyQFTParallel(this->device_sv->getData(), this->GetNumQubits(), dev_wires.front(),
+                                dev_wires.size(), inverse, this->num_threads);
+}
+
+void LightningSimulator::PauliRotation(const std::string &pauli_word, double theta,
+                                       const std::vector<QubitIdType> &wires, bool inverse,
+                                       const std::vector<QubitIdType> &controlled_wires,
+                                       const std::vector<bool> &controlled_values)
+{
+    RT_FAIL_IF(pauli_word.size() != wires.size(), "Invalid Pauli word for the given wires");
+    RT_FAIL_IF(!isValidQubits(wires), "Given wires do not refer to qubits");
+
+    // The bit-mask kernel applies the rotation in a single pass over the state vector. Controlled
+    // rotations and batches use the gate decomposition.
+    if (!controlled_wires.empty() || this->batch) {
+        QuantumDevice::PauliRotation(pauli_word, theta, wires, inverse, controlled_wires,
+                                     controlled_values);
+        return;
+    }
+
+    auto &&dev_wires = getDeviceWires(wires);
+    if (this->isTracingGates() &&
+        this->skipPrefixGate({"PauliRot", pauli_word, {theta}, {}, dev_wires, {}, {}, inverse})) {
+        return;
+    }
+
+    Lightning::applyPauliRotationParallel(this->device_sv->getData(), this->GetNumQubits(),
+                                          pauli_word, dev_wires, inverse ? -theta : theta,
+                                          this->num_threads);
+
+    // Update tape caching if required
+    if (this->tape_recording) {
+        this->cache_manager.addPauliRotation(pauli_word, theta, dev_wires, inverse);
+    }
+}
+
+void LightningSimulator::SetState(DataView<std::complex<double>, 1> &state,
+                                  const std::vector<QubitIdType> &wires)
+{
+    RT_FAIL_IF(this->batch, "State preparation is not supported in batched execution");
+    RT_FAIL_IF(!isValidQubits(wires), "Given wires do not refer to qubits");
+    RT_FAIL_IF(state.size() != (size_t{1} << wires.size()),
+               "Invalid size of the state for the given wires");
+    // The adjoint method differentiates from the state prepared before the first recorded
+    // operation, so the state can only be prepared ahead of the recorded gates.
+    RT_FAIL_IF(this->tape_recording && this->cache_manager.getNumOperations(),
+               "State preparation is only supported before the recorded operations");
+
+    this->stopPrefix();
+
+    std::vector<std::complex<double>> amplitudes(state.begin(), state.end());
+    Lightning::setStateParallel(this->device_sv->getData(), this->GetNumQubits(),
+                                getDeviceWires(wires), amplitudes.data(), this->num_threads);
+}
+
+void LightningSimulator::SetBasisState(DataView<int8_t, 1> &bits,
+                                       const std::vector<QubitIdType> &wires)
+{
+    RT_FAIL_IF(this->batch, "State preparation is not supported in batched execution");
+    RT_FAIL_IF(!isValidQubits(wires), "Given wires do not refer to qubits");
+    RT_FAIL_IF(bits.size() != wires.size(), "Invalid number of bits for the given wires");
+    RT_FAIL_IF(this->tape_recording && this->cache_manager.getNumOperations(),
+               "State preparation is only supported before the recorded operations");
+
+    this->stopPrefix();
+
+    size_t index = 0;
+    for (auto bit : bits) {
+        index = (index << 1) | (bit ? 1 : 0);
+    }
+    Lightning::setBasisStateParallel(this->device_sv->getData(), this->GetNumQubits(),
+                                     getDeviceWires(wires), index, this->num_threads);
+}
+
 auto LightningSimulator::Observable(ObsId id, const std::vector<std::complex<double>> &matrix,
                                     const std::vector<QubitIdType> &wires) -> ObsIdType
 {
@@ -183,27 +631,45 @@ auto LightningSimulator::Observable(ObsId id, const std::vector<std::complex<dou
     auto &&dev_wires = getDeviceWires(wires);
 
     if (id == ObsId::Hermitian) {
+        RT_FAIL_IF(this->batch, "Hermitian observables are not supported in batched execution");
         return this->obs_manager.createHermitianObs(matrix, dev_wires);
     }
 
-    return this->obs_manager.createNamedObs(id, dev_wires);
+    auto key = this->obs_manager.createNamedObs(id, dev_wires);
+    if (this->batch) {
+        this->batch->addNamedObservable(key, id, dev_wires);
+    }
+    return key;
 }
 
 auto LightningSimulator::TensorObservable(const std::vector<ObsIdType> &obs) -> ObsIdType
 {
-    return this->obs_manager.createTensorProdObs(obs);
+    auto key = this->obs_manager.createTensorProdObs(obs);
+    if (this->batch) {
+        this->batch->addTensorObservable(key, obs);
+    }
+    return key;
 }
 
 auto LightningSimulator::HamiltonianObservable(const std::vector<double> &coeffs,
                                                const std::vector<ObsIdType> &obs) -> ObsIdType
 {
-    return this->obs_manager.createHamiltonianObs(coeffs, obs);
+    auto key = this->obs_manager.createHamiltonianObs(coeffs, obs);
+    if (this->batch) {
+        this->batch->addHamiltonianObservable(key, coeffs, obs);
+    }
+    return key;
 }
 
 auto LightningSimulator::Expval(ObsIdType obsKey) -> double
 {
     RT_FAIL_IF(!this->obs_manager.isValidObservables({obsKey}),
                "Invalid key for cached observables");
+    if (this->batch) {
+        return this->batch->expval(obsKey, this->GetNumQubits());
+    }
+    this->resumePrefix();
+
     auto &&obs = this->obs_manager.getObservable(obsKey);
 
     // update tape caching
@@ -211,6 +677,10 @@ auto LightningSimulator::Expval(ObsIdType obsKey) -> double
         this->cache_manager.addObservable(obsKey, MeasurementsT::Expval);
     }
 
+    if (auto &&estimate = this->estimateGrouped(obsKey)) {
+        return estimate->first;
+    }
+
     Pennylane::LightningQubit::Measures::Measurements<StateVectorT> m{*(this->device_sv)};
 
     return device_shots ? m.expval(*obs, device_shots, {}) : m.expval(*obs);
@@ -220,6 +690,11 @@ auto LightningSimulator::Var(ObsIdType obsKey) -> double
 {
     RT_FAIL_IF(!this->obs_manager.isValidObservables({obsKey}),
                "Invalid key for cached observables");
+    if (this->batch) {
+        return this->batch->var(obsKey, this->GetNumQubits());
+    }
+    this->resumePrefix();
+
     auto &&obs = this->obs_manager.getObservable(obsKey);
 
     // update tape caching
@@ -227,13 +702,117 @@ auto LightningSimulator::Var(ObsIdType obsKey) -> double
         this->cache_manager.addObservable(obsKey, MeasurementsT::Var);
     }
 
+    if (auto &&estimate = this->estimateGrouped(obsKey)) {
+        return estimate->second;
+    }
+
     Pennylane::LightningQubit::Measures::Measurements<StateVectorT> m{*(this->device_sv)};
 
     return device_shots ? m.var(*obs, device_shots) : m.var(*obs);
 }
 
+auto LightningSimulator::ExpvalVar(ObsIdType obsKey) -> std::pair<double, double>
+{
+    RT_FAIL_IF(!this->obs_manager.isValidObservables({obsKey}),
+               "Invalid key for cached observables");
+    if (this->batch) {
+        const size_t num_qubits = this->GetNumQubits();
+        return {this->batch->expval(obsKey, num_qubits), this->batch->var(obsKey, num_qubits)};
+    }
+    this->resumePrefix();
+
+    // tape caching records the two measurements separately
+    if (this->tape_recording) {
+        return {this->Expval(obsKey), this->Var(obsKey)};
+    }
+
+    if (auto &&estimate = this->estimateGrouped(obsKey)) {
+        return estimate.value();
+    }
+
+    auto &&obs = this->obs_manager.getObservable(obsKey);
+
+    if (device_shots) {
+        Pennylane::LightningQubit::Measures::Measurements<StateVectorT> m{*(this->device_sv)};
+        return {m.expval(*obs, device_shots, {}), m.var(*obs, device_shots)};
+    }
+
+    // Both <H> and <H^2> follow from a single application of the observable to the state.
+    StateVectorT applied{*(this->device_sv)};
+    obs->applyInPlace(applied);
+    const size_t length = applied.getLength();
+    const double expval = std::real(Pennylane::LightningQubit::Util::innerProdC(
+        this->device_sv->getData(), applied.getData(), length));
+    const double mean_square = std::real(
+        Pennylane::LightningQubit::Util::innerProdC(applied.getData(), applied.getData(), length));
+    return {expval, mean_square - expval * expval};
+}
+
+void LightningSimulator::GroupMeasurements(const std::vector<ObsIdType> &obsKeys)
+{
+    RT_FAIL_IF(!this->obs_manager.isValidObservables(obsKeys),
+               "Invalid key for cached observables");
+    this->measurement_groups.clear();
+
+    // Analytic measurements are exact, and batches, tapes and Metropolis sampling compute each
+    // measurement separately.
+    if (!this->device_shots || this->batch || this->tape_recording || this->mcmc) {
+        return;
+    }
+
+    std::vector<std::pair<ObsIdType, PauliSumT>> observables;
+    for (auto key : obsKeys) {
+        if (auto &&pauli_sum = this->obs_manager.getPauliSum(key)) {
+            observables.emplace_back(key, pauli_sum.value());
+        }
+    }
+    this->measurement_groups.group(observables);
+}
+
+void LightningSimulator::rotateToPauliBasis(StateVectorT &sv, size_t wire, char pauli)
+{
+    if (pauli == 'X') {
+        sv.applyOperation("Hadamard", {wire}, false);
+    }
+    else if (pauli == 'Y') {
+        sv.applyOperation("PauliZ", {wire}, false);
+        sv.applyOperation("S", {wire}, false);
+        sv.applyOperation("Hadamard", {wire}, false);
+    }
+}
+
+auto LightningSimulator::estimateGrouped(ObsIdType obsKey)
+    -> std::optional<std::pair<double, double>>
+{
+    if (this->tape_recording || !this->measurement_groups.contains(obsKey)) {
+        return std::nullopt;
+    }
+
+    // The samples of a group are drawn at its first measurement, from a copy of the state rotated
+    // into the eigenbasis of the Pauli operator on each wire of the group.
+    if (!this->measurement_groups.hasSamples(obsKey)) {
+        StateVectorT rotated{*(this->device_sv)};
+        for (const auto &[wire, pauli] : this->measurement_groups.getBasis(obsKey)) {
+            rotateToPauliBasis(rotated, wire, pauli);
+        }
+
+        Pennylane::LightningQubit::Measures::Measurements<StateVectorT> m{rotated};
+        this->measurement_groups.setSamples(
+            obsKey, Lightning::generateSampleIndicesParallel(m.probs(), this->device_shots,
+                                                             this->gen, this->gen_stream++,
+                                                             this->num_threads));
+    }
+    return this->measurement_groups.estimate(obsKey, this->GetNumQubits());
+}
+
 void LightningSimulator::State(DataView<std::complex<double>, 1> &state)
 {
+    if (this->batch) {
+        this->batch->state(state, this->GetNumQubits());
+        return;
+    }
+    this->resumePrefix();
+
     auto &&dv_state = this->device_sv->getDataVector();
     RT_FAIL_IF(state.size() != dv_state.size(), "Invalid size for the pre-allocated state vector");
 
@@ -242,6 +821,12 @@ void LightningSimulator::State(DataView<std::complex<double>, 1> &state)
 
 void LightningSimulator::Probs(DataView<double, 1> &probs)
 {
+    if (this->batch) {
+        this->batch->probs(probs, {}, this->GetNumQubits());
+        return;
+    }
+    this->resumePrefix();
+
     Pennylane::LightningQubit::Measures::Measurements<StateVectorT> m{*(this->device_sv)};
     auto &&dv_probs = device_shots ? m.probs(device_shots) : m.probs();
 
@@ -260,6 +845,12 @@ void LightningSimulator::PartialProbs(DataView<double, 1> &probs,
     RT_FAIL_IF(!isValidQubits(wires), "Invalid given wires to measure");
 
     auto dev_wires = getDeviceWires(wires);
+    if (this->batch) {
+        this->batch->probs(probs, dev_wires, numQubits);
+        return;
+    }
+    this->resumePrefix();
+
     Pennylane::LightningQubit::Measures::Measurements<StateVectorT> m{*(this->device_sv)};
     auto &&dv_probs = device_shots ? m.probs(dev_wires, device_shots) : m.probs(dev_wires);
 
@@ -286,20 +877,48 @@ std::vector<size_t> LightningSimulator::GenerateSamplesMetropolis(size_t shots)
 
 std::vector<size_t> LightningSimulator::GenerateSamples(size_t shots)
 {
+    RT_FAIL_IF(this->batch, "Sampling is not supported in batched execution");
+    this->resumePrefix();
+
     if (this->mcmc) {
         return this->GenerateSamplesMetropolis(shots);
     }
-    // generate_samples is a member function of the Measures class.
     Pennylane::LightningQubit::Measures::Measurements<StateVectorT> m{*(this->device_sv)};
 
-    // PL-Lightning generates samples using the alias method.
-    // Reference: https://en.wikipedia.org/wiki/Alias_method
+    // Samples are drawn by inverse transform sampling over the cumulative
+    // probabilities, split across threads with one Philox substream per shot.
     // Given the number of samples, returns 1-D vector of samples
     // in binary, each sample is separated by a stride equal to
     // the number of qubits.
     //
     // Return Value Optimization (RVO)
-    return m.generate_samples(shots);
+    return Lightning::generateSamplesParallel(m.probs(), this->GetNumQubits(), shots, this->gen,
+                                              this->gen_stream++, this->num_threads);
+}
+
+std::vector<size_t> LightningSimulator::GenerateSampleIndices(size_t shots)
+{
+    RT_FAIL_IF(this->batch, "Sampling is not supported in batched execution");
+    this->resumePrefix();
+
+    if (this->mcmc) {
+        const size_t numQubits = this->GetNumQubits();
+        auto &&li_samples = this->GenerateSamplesMetropolis(shots);
+
+        std::vector<size_t> indices(shots);
+        for (size_t shot = 0; shot < shots; shot++) {
+            for (size_t wire = 0; wire < numQubits; wire++) {
+                indices[shot] = (indices[shot] << 1) | li_samples[shot * numQubits + wire];
+            }
+        }
+        return indices;
+    }
+    Pennylane::LightningQubit::Measures::Measurements<StateVectorT> m{*(this->device_sv)};
+
+    // Same draws as GenerateSamples, without unpacking the index of each sampled basis state
+    // into one bit per qubit.
+    return Lightning::generateSampleIndicesParallel(m.probs(), shots, this->gen,
+                                                    this->gen_stream++, this->num_threads);
 }
 
 void LightningSimulator::Sample(DataView<double, 2> &samples, size_t shots)
@@ -350,11 +969,100 @@ void LightningSimulator::PartialSample(DataView<double, 2> &samples,
     }
 }
 
+void LightningSimulator::PackedSample(DataView<int64_t, 1> &samples, size_t shots)
+{
+    RT_FAIL_IF(this->GetNumQubits() > static_cast<size_t>(std::numeric_limits<uint64_t>::digits),
+               "Too many qubits to pack the samples of");
+    RT_FAIL_IF(samples.size() != shots, "Invalid size for the pre-allocated packed samples");
+
+    auto &&indices = this->GenerateSampleIndices(shots);
+    std::transform(indices.begin(), indices.end(), samples.begin(),
+                   [](size_t idx) { return static_cast<int64_t>(idx); });
+}
+
+void LightningSimulator::PartialPackedSample(DataView<int64_t, 1> &samples,
+                                             const std::vector<QubitIdType> &wires, size_t shots)
+{
+    const size_t numWires = wires.size();
+    const size_t numQubits = this->GetNumQubits();
+
+    RT_FAIL_IF(numWires > numQubits, "Invalid number of wires");
+    RT_FAIL_IF(!isValidQubits(wires), "Invalid given wires to measure");
+    RT_FAIL_IF(numWires > static_cast<size_t>(std::numeric_limits<uint64_t>::digits),
+               "Too many wires to pack the samples of");
+    RT_FAIL_IF(samples.size() != shots, "Invalid size for the pre-allocated packed samples");
+
+    // get device wires
+    auto &&dev_wires = getDeviceWires(wires);
+
+    auto &&indices = this->GenerateSampleIndices(shots);
+
+    // Gather the bits of the desired wires from the index of each sampled basis state, in
+    // which wire 0 is the most significant bit.
+    auto samplesIter = samples.begin();
+    for (size_t shot = 0; shot < shots; shot++) {
+        uint64_t packed = 0;
+        for (auto wire : dev_wires) {
+            packed = (packed << 1) | ((indices[shot] >> (numQubits - 1 - wire)) & 1U);
+        }
+        *(samplesIter++) = static_cast<int64_t>(packed);
+    }
+}
+
+void LightningSimulator::Shadow(DataView<int64_t, 2> &records,
+                                const std::vector<QubitIdType> &wires, size_t shots)
+{
+    RT_FAIL_IF(this->batch, "Classical shadows are not supported in batched execution");
+    RT_FAIL_IF(wires.size() > this->GetNumQubits(), "Invalid number of wires");
+    RT_FAIL_IF(!isValidQubits(wires), "Invalid given wires to measure");
+    RT_FAIL_IF(records.size() != shots * 2,
+               "Invalid size for the pre-allocated classical shadow records");
+    this->resumePrefix();
+
+    // get device wires, where no wires denote the entire wires
+    std::vector<size_t> dev_wires(this->GetNumQubits());
+    if (wires.empty()) {
+        std::iota(dev_wires.begin(), dev_wires.end(), 0);
+    }
+    else {
+        dev_wires = getDeviceWires(wires);
+    }
+    const size_t numWires = dev_wires.size();
+
+    auto &&bases = Lightning::generateShadowBasesParallel(numWires, shots, this->gen,
+                                                          this->gen_stream++, this->num_threads);
+
+    // The shots are sampled together per distinct bases, from a copy of the state rotated into
+    // them, so that the state is copied at most 3^numWires times.
+    std::map<uint64_t, std::vector<size_t>> shots_per_bases;
+    for (size_t shot = 0; shot < shots; shot++) {
+        shots_per_bases[bases[shot]].push_back(shot);
+    }
+
+    constexpr std::string_view paulis = "IXYZ";
+    for (const auto &[packed_bases, basis_shots] : shots_per_bases) {
+        StateVectorT rotated{*(this->device_sv)};
+        for (size_t i = 0; i < numWires; i++) {
+            const size_t pauli = (packed_bases >> (2 * (numWires - 1 - i))) & 3U;
+            rotateToPauliBasis(rotated, dev_wires[i], paulis[pauli]);
+        }
+
+        Pennylane::LightningQubit::Measures::Measurements<StateVectorT> m{rotated};
+        auto &&indices = Lightning::generateSampleIndicesParallel(
+            m.probs(dev_wires), basis_shots.size(), this->gen, this->gen_stream++,
+            this->num_threads);
+        for (size_t i = 0; i < basis_shots.size(); i++) {
+            records(basis_shots[i], 0) = static_cast<int64_t>(packed_bases);
+            records(basis_shots[i], 1) = static_cast<int64_t>(indices[i]);
+        }
+    }
+}
+
 void LightningSimulator::Counts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts,
                                 size_t shots)
 {
     const size_t numQubits = this->GetNumQubits();
-    const size_t numElements = 1U << numQubits;
+    const size_t numElements = size_t{1} << numQubits;
 
     RT_FAIL_IF(eigvals.size() != numElements || counts.size() != numElements,
                "Invalid size for the pre-allocated counts");
@@ -387,7 +1095,7 @@ void LightningSimulator::PartialCounts(DataView<double, 1> &eigvals, DataView<in
 {
     const size_t numWires = wires.size();
     const size_t numQubits = this->GetNumQubits();
-    const size_t numElements = 1U << numWires;
+    const size_t numElements = size_t{1} << numWires;
 
     RT_FAIL_IF(numWires > numQubits, "Invalid number of wires");
     RT_FAIL_IF(!isValidQubits(wires), "Invalid given wires to measure");
@@ -420,24 +1128,56 @@ void LightningSimulator::PartialCounts(DataView<double, 1> &eigvals, DataView<in
     }
 }
 
-auto LightningSimulator::Measure(QubitIdType wire, std::optional<int32_t> postselect) -> Result
+void LightningSimulator::storeSparseCounts(DataView<double, 1> &eigvals,
+                                           DataView<int64_t, 1> &counts,
+                                           const std::vector<size_t> &dev_wires, size_t shots)
 {
-    // get a measurement
-    std::vector<QubitIdType> wires = {reinterpret_cast<QubitIdType>(wire)};
+    RT_FAIL_IF(dev_wires.size() > static_cast<size_t>(std::numeric_limits<double>::digits),
+               "Too many wires to store the samples of sparse counts as doubles");
+    RT_FAIL_IF(eigvals.size() != shots || counts.size() != shots,
+               "Invalid size for the pre-allocated sparse counts");
 
-    std::vector<double> probs(1U << wires.size());
-    DataView<double, 1> buffer_view(probs);
-    this->PartialProbs(buffer_view, wires);
+    auto li_samples = this->GenerateSamples(shots);
 
-    // It represents the measured result, true for 1, false for 0
-    bool mres = Lightning::simulateDraw(probs, postselect);
+    // Only the observed bitstrings are counted, into hash tables rather than into an array of
+    // all the 2^numWires bitstrings.
+    auto &&outcomes = Lightning::countOutcomesParallel(li_samples, this->GetNumQubits(), dev_wires,
+                                                       shots, this->num_threads);
+
+    std::fill(eigvals.begin(), eigvals.end(), -1);
+    std::fill(counts.begin(), counts.end(), 0);
+    for (size_t idx = 0; idx < outcomes.size(); idx++) {
+        eigvals(idx) = static_cast<double>(outcomes[idx].first);
+        counts(idx) = outcomes[idx].second;
+    }
+}
+
+void LightningSimulator::SparseCounts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts,
+                                      size_t shots)
+{
+    std::vector<size_t> dev_wires(this->GetNumQubits());
+    std::iota(dev_wires.begin(), dev_wires.end(), 0);
+
+    this->storeSparseCounts(eigvals, counts, dev_wires, shots);
+}
+
+void LightningSimulator::PartialSparseCounts(DataView<double, 1> &eigvals,
+                                             DataView<int64_t, 1> &counts,
+                                             const std::vector<QubitIdType> &wires, size_t shots)
+{
+    RT_FAIL_IF(wires.size() > this->GetNumQubits(), "Invalid number of wires");
+    RT_FAIL_IF(!isValidQubits(wires), "Invalid given wires to measure");
 
+    this->storeSparseCounts(eigvals, counts, getDeviceWires(wires), shots);
+}
+
+void LightningSimulator::collapseState(size_t dev_wire, bool outcome)
+{
     const size_t numQubits = this->GetNumQubits();
 
     auto &&state = this->device_sv->getDataVector();
 
-    auto &&dev_wires = this->getDeviceWires(wires);
-    const auto stride = pow(2, numQubits - (1 + dev_wires[0]));
+    const auto stride = pow(2, numQubits - (1 + dev_wire));
     const auto vec_size = pow(2, numQubits);
     const auto section_size = vec_size / stride;
     const auto half_section_size = section_size / 2;
@@ -447,7 +1187,7 @@ auto LightningSimulator::Measure(QubitIdType wire, std::optional<int32_t> postse
     // *_*_*_*_ for stride 1
     // **__**__ for stride 2
     // ****____ for stride 4
-    const size_t k = mres ? 0 : 1;
+    const size_t k = outcome ? 0 : 1;
     for (size_t idx = 0; idx < half_section_size; idx++) {
         for (size_t ids = 0; ids < stride; ids++) {
             auto v = stride * (k + 2 * idx) + ids;
@@ -464,6 +1204,33 @@ auto LightningSimulator::Measure(QubitIdType wire, std::optional<int32_t> postse
     // normalize the vector
     double norm = std::sqrt(total);
     std::for_each(state.begin(), state.end(), [norm](auto &elem) { elem /= norm; });
+}
+
+auto LightningSimulator::Measure(QubitIdType wire, std::optional<int32_t> postselect) -> Result
+{
+    RT_FAIL_IF(this->batch, "Mid-circuit measurements are not supported in batched execution");
+
+    if (this->branch_cache.isTracing()) {
+        if (auto outcome = this->measureBranch(wire, postselect)) {
+            return outcome.value() ? this->One() : this->Zero();
+        }
+    }
+
+    // The collapsed state no longer follows from the gates applied to the register.
+    this->stopPrefix();
+
+    RT_FAIL_IF(!isValidQubit(wire), "Invalid given wire to measure");
+    const size_t dev_wire = this->qubit_manager.getDeviceId(wire);
+
+    // The outcome is drawn from the exact probabilities rather than the ones estimated from the
+    // device shots, as in measureBranch, so both draw the same outcomes from the same seed.
+    Pennylane::LightningQubit::Measures::Measurements<StateVectorT> m{*(this->device_sv)};
+
+    // It represents the measured result, true for 1, false for 0
+    bool mres = Lightning::simulateDraw(m.probs({dev_wire}), postselect,
+                                        this->gen.uniform(this->gen_stream++, 0));
+
+    this->collapseState(dev_wire, mres);
 
     return mres ? this->One() : this->Zero();
 }
@@ -472,6 +1239,9 @@ auto LightningSimulator::Measure(QubitIdType wire, std::optional<int32_t> postse
 void LightningSimulator::Gradient(std::vector<DataView<double, 1>> &gradients,
                                   const std::vector<size_t> &trainParams)
 {
+    RT_FAIL_IF(this->batch, "Gradients are not supported in batched execution");
+    this->resumePrefix();
+
     const bool tp_empty = trainParams.empty();
     const size_t num_observables = this->cache_manager.getNumObservables();
     const size_t num_params = this->cache_manager.getNumParams();
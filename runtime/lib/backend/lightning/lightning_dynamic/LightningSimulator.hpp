@@ -17,18 +17,31 @@
 #define __device_lightning
 
 #include <bitset>
+#include <charconv>
 #include <cmath>
 #include <cstdint>
 #include <iostream>
 #include <limits>
+#include <map>
+#include <memory>
 #include <numeric>
+#include <optional>
+#include <random>
 #include <span>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
 
 #include "StateVectorLQubitDynamic.hpp"
 
 #include "CacheManager.hpp"
 #include "Exception.hpp"
+#include "LightningBatch.hpp"
+#include "LightningBranchCache.hpp"
+#include "LightningMeasurementGroups.hpp"
 #include "LightningObsManager.hpp"
+#include "LightningPrefixCache.hpp"
+#include "LightningProductState.hpp"
 #include "QuantumDevice.hpp"
 #include "QubitManager.hpp"
 #include "Utils.hpp"
@@ -45,6 +58,7 @@ class LightningSimulator final : public Catalyst::Runtime::QuantumDevice {
     static constexpr size_t default_num_burnin{100}; // tidy: readability-magic-numbers
     static constexpr std::string_view default_kernel_name{
         "Local"}; // tidy: readability-magic-numbers
+    static constexpr size_t default_max_branch_amplitudes{size_t{1} << 26}; // 1 GiB of states
 
     Catalyst::Runtime::QubitManager<QubitIdType, size_t> qubit_manager{};
     Catalyst::Runtime::CacheManager<std::complex<double>> cache_manager{};
@@ -55,9 +69,60 @@ class LightningSimulator final : public Catalyst::Runtime::QuantumDevice {
     size_t num_burnin{0};
     std::string kernel_name;
 
+    // Counter-based generator for sampling and mid-circuit measurements. Every
+    // call draws from a fresh substream so that seeded runs are reproducible.
+    Catalyst::Runtime::Philox4x32 gen{};
+    uint64_t gen_stream{0};
+    size_t num_threads{0};
+
     std::unique_ptr<StateVectorT> device_sv = std::make_unique<StateVectorT>(0);
     LightningObsManager<double> obs_manager{};
 
+    // The batched execution in progress, if any
+    std::unique_ptr<LightningBatch> batch{nullptr};
+
+    // State snapshots are immutable, and shared between the snapshot ids and the prefix cache.
+    struct StateSnapshot {
+        size_t num_qubits;
+        std::shared_ptr<const std::vector<std::complex<double>>> data;
+    };
+    std::unordered_map<size_t, StateSnapshot> snapshots{};
+    size_t next_snapshot_id{0};
+    LightningPrefixCache prefix_cache{};
+
+    // The branches of mid-circuit measurements shared between executions, if enabled
+    LightningBranchCache branch_cache{};
+
+    // The factors of the state of a register whose gates are not traced otherwise, until the
+    // dense state is needed, if enabled
+    bool product_state_enabled{false};
+    LightningProductState<StateVectorT> product_state{};
+
+    // The shot-based measurements announced by `GroupMeasurements` that are still pending
+    LightningMeasurementGroups measurement_groups{};
+
+    void loadSnapshot(size_t id);
+    void applyGate(StateVectorT &sv, const LightningPrefixCache::Gate &gate);
+    auto applyFactorGate(const LightningPrefixCache::Gate &gate) -> bool;
+    void resumeProduct();
+    auto skipPrefixGate(LightningPrefixCache::Gate &&gate) -> bool;
+    void resumePrefix();
+    void stopPrefix();
+    void loadBranch();
+    void resumeBranch();
+    auto measureBranch(QubitIdType wire, std::optional<int32_t> postselect) -> std::optional<bool>;
+    void collapseState(size_t dev_wire, bool outcome);
+    static void rotateToPauliBasis(StateVectorT &sv, size_t wire, char pauli);
+    auto estimateGrouped(ObsIdType obsKey) -> std::optional<std::pair<double, double>>;
+    void storeSparseCounts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts,
+                           const std::vector<size_t> &dev_wires, size_t shots);
+
+    [[nodiscard]] inline auto isTracingGates() const -> bool
+    {
+        return this->prefix_cache.isTracing() || this->branch_cache.isTracing() ||
+               this->product_state.isTracing();
+    }
+
     inline auto isValidQubit(QubitIdType wire) -> bool
     {
         return this->qubit_manager.isValidQubitId(wire);
@@ -94,6 +159,31 @@ class LightningSimulator final : public Catalyst::Runtime::QuantumDevice {
                          ? static_cast<size_t>(std::stoll(args["num_burnin"]))
                          : default_num_burnin;
         kernel_name = args.contains("kernel_name") ? args["kernel_name"] : default_kernel_name;
+        if (args.contains("num_threads")) {
+            const std::string &threads_str = args["num_threads"];
+            const char *threads_end = threads_str.data() + threads_str.size();
+            auto [ptr, ec] = std::from_chars(threads_str.data(), threads_end, num_threads);
+            RT_FAIL_IF(ec != std::errc{} || ptr != threads_end,
+                       "Invalid number of device threads, expected a non-negative integer");
+        }
+        if (args.contains("mcm_branching") && args["mcm_branching"] == "True") {
+            this->branch_cache.enable(default_max_branch_amplitudes);
+        }
+        product_state_enabled = args.contains("product_state") && args["product_state"] == "True";
+
+        if (args.contains("seed") && args["seed"] != "None") {
+            const std::string &seed_str = args["seed"];
+            const char *seed_end = seed_str.data() + seed_str.size();
+            uint64_t seed = 0;
+            auto [ptr, ec] = std::from_chars(seed_str.data(), seed_end, seed);
+            RT_FAIL_IF(ec != std::errc{} || ptr != seed_end,
+                       "Invalid device seed, expected a non-negative 64-bit integer");
+            this->SetDeviceSeed(seed);
+        }
+        else {
+            std::random_device rd;
+            this->SetDeviceSeed(static_cast<uint64_t>(rd()) << 32 | rd());
+        }
     }
     ~LightningSimulator() override = default;
 
@@ -102,9 +192,41 @@ class LightningSimulator final : public Catalyst::Runtime::QuantumDevice {
     QUANTUM_DEVICE_RT_DECLARATIONS;
     QUANTUM_DEVICE_QIS_DECLARATIONS;
 
+    void SetDeviceSeed(uint64_t seed) override;
+    void StartBatch(size_t batch_size) override;
+    void SetBatchLane(size_t lane) override;
+    void ExecuteBatch() override;
+    void StopBatch() override;
+    auto Snapshot() -> size_t override;
+    void Restore(size_t id) override;
+    void ReleaseSnapshot(size_t id) override;
+    void Checkpoint(bool diverges) override;
+    auto ExpvalVar(ObsIdType obsKey) -> std::pair<double, double> override;
+    void GroupMeasurements(const std::vector<ObsIdType> &obsKeys) override;
+    void QFT(const std::vector<QubitIdType> &wires, bool inverse = false,
+             const std::vector<QubitIdType> &controlled_wires = {},
+             const std::vector<bool> &controlled_values = {}) override;
+    void PauliRotation(const std::string &pauli_word, double theta,
+                       const std::vector<QubitIdType> &wires, bool inverse = false,
+                       const std::vector<QubitIdType> &controlled_wires = {},
+                       const std::vector<bool> &controlled_values = {}) override;
+    void SetState(DataView<std::complex<double>, 1> &state,
+                  const std::vector<QubitIdType> &wires) override;
+    void SetBasisState(DataView<int8_t, 1> &bits, const std::vector<QubitIdType> &wires) override;
+    void SparseCounts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts,
+                      size_t shots) override;
+    void PartialSparseCounts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts,
+                             const std::vector<QubitIdType> &wires, size_t shots) override;
+    void PackedSample(DataView<int64_t, 1> &samples, size_t shots) override;
+    void PartialPackedSample(DataView<int64_t, 1> &samples, const std::vector<QubitIdType> &wires,
+                             size_t shots) override;
+    void Shadow(DataView<int64_t, 2> &records, const std::vector<QubitIdType> &wires,
+                size_t shots) override;
+
     auto CacheManagerInfo()
         -> std::tuple<size_t, size_t, size_t, std::vector<std::string>, std::vector<ObsIdType>>;
     auto GenerateSamplesMetropolis(size_t shots) -> std::vector<size_t>;
     auto GenerateSamples(size_t shots) -> std::vector<size_t>;
+    auto GenerateSampleIndices(size_t shots) -> std::vector<size_t>;
 };
 } // namespace Catalyst::Runtime::Simulator
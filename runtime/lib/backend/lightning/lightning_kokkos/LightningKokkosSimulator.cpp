@@ -195,6 +195,62 @@ void LightningKokkosSimulator::MatrixOperation(const std::vector<std::complex<do
     }
 }
 
+void LightningKokkosSimulator::SetState(DataView<std::complex<double>, 1> &state,
+                                        const std::vector<QubitIdType> &wires)
+{
+    using UnmanagedComplexHostView = Kokkos::View<Kokkos::complex<double> *, Kokkos::HostSpace,
+                                                  Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+    RT_FAIL_IF(!isValidQubits(wires), "Given wires do not refer to qubits");
+    RT_FAIL_IF(state.size() != (size_t{1} << wires.size()),
+               "Invalid size of the state for the given wires");
+    RT_FAIL_IF(this->tape_recording && this->cache_manager.getNumOperations(),
+               "State preparation is only supported before the recorded operations");
+
+    const size_t num_qubits = this->GetNumQubits();
+    const size_t size = Pennylane::Util::exp2(num_qubits);
+
+    // Prepare the state on a host copy of the state vector
+    std::vector<std::complex<double>> buffer(size);
+    auto *buffer_kptr = reinterpret_cast<Kokkos::complex<double> *>(buffer.data());
+    auto device_data = this->device_sv->getView();
+    Kokkos::deep_copy(UnmanagedComplexHostView(buffer_kptr, size), device_data);
+
+    std::vector<std::complex<double>> amplitudes(state.begin(), state.end());
+    Lightning::setStateParallel(buffer.data(), num_qubits, getDeviceWires(wires),
+                                amplitudes.data());
+
+    Kokkos::deep_copy(device_data, UnmanagedComplexHostView(buffer_kptr, size));
+}
+
+void LightningKokkosSimulator::SetBasisState(DataView<int8_t, 1> &bits,
+                                             const std::vector<QubitIdType> &wires)
+{
+    using UnmanagedComplexHostView = Kokkos::View<Kokkos::complex<double> *, Kokkos::HostSpace,
+                                                  Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+    RT_FAIL_IF(!isValidQubits(wires), "Given wires do not refer to qubits");
+    RT_FAIL_IF(bits.size() != wires.size(), "Invalid number of bits for the given wires");
+    RT_FAIL_IF(this->tape_recording && this->cache_manager.getNumOperations(),
+               "State preparation is only supported before the recorded operations");
+
+    const size_t num_qubits = this->GetNumQubits();
+    const size_t size = Pennylane::Util::exp2(num_qubits);
+
+    std::vector<std::complex<double>> buffer(size);
+    auto *buffer_kptr = reinterpret_cast<Kokkos::complex<double> *>(buffer.data());
+    auto device_data = this->device_sv->getView();
+    Kokkos::deep_copy(UnmanagedComplexHostView(buffer_kptr, size), device_data);
+
+    size_t index = 0;
+    for (auto bit : bits) {
+        index = (index << 1) | (bit ? 1 : 0);
+    }
+    Lightning::setBasisStateParallel(buffer.data(), num_qubits, getDeviceWires(wires), index);
+
+    Kokkos::deep_copy(device_data, UnmanagedComplexHostView(buffer_kptr, size));
+}
+
 auto LightningKokkosSimulator::Observable(ObsId id, const std::vector<std::complex<double>> &matrix,
                                           const std::vector<QubitIdType> &wires) -> ObsIdType
 {
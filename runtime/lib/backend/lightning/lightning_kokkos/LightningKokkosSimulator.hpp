@@ -91,6 +91,10 @@ class LightningKokkosSimulator final : public Catalyst::Runtime::QuantumDevice {
     QUANTUM_DEVICE_RT_DECLARATIONS;
     QUANTUM_DEVICE_QIS_DECLARATIONS;
 
+    void SetState(DataView<std::complex<double>, 1> &state,
+                  const std::vector<QubitIdType> &wires) override;
+    void SetBasisState(DataView<int8_t, 1> &bits, const std::vector<QubitIdType> &wires) override;
+
     auto CacheManagerInfo()
         -> std::tuple<size_t, size_t, size_t, std::vector<std::string>, std::vector<ObsIdType>>;
 };
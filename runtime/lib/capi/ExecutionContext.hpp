@@ -258,6 +258,12 @@ class ExecutionContext final {
 
     bool initial_tape_recorder_status;
 
+    // Batched execution: the number of lanes (0 when not batching), the lane of the next device
+    // initialization, and the device that runs every lane of the batch
+    size_t batch_size{0};
+    size_t batch_lane{0};
+    RTDevice *batch_device{nullptr};
+
     // ExecutionContext pointers
     std::unique_ptr<MemoryManager> memory_man_ptr{nullptr};
     std::unique_ptr<PythonInterpreterGuard> py_guard{nullptr};
@@ -277,6 +283,37 @@ class ExecutionContext final {
         return initial_tape_recorder_status;
     }
 
+    void startBatch(size_t size)
+    {
+        RT_FAIL_IF(batch_size, "Cannot start a batched execution within another one");
+        RT_FAIL_IF(!size, "Invalid batch size");
+        batch_size = size;
+        batch_lane = 0;
+        batch_device = nullptr;
+    }
+
+    void setBatchLane(size_t lane)
+    {
+        RT_FAIL_IF(!batch_size, "Cannot select a batch lane outside of a batched execution");
+        RT_FAIL_IF(lane >= batch_size, "Invalid batch lane");
+        batch_lane = lane;
+    }
+
+    void setBatchDevice(RTDevice *device) noexcept { batch_device = device; }
+
+    void stopBatch() noexcept
+    {
+        batch_size = 0;
+        batch_lane = 0;
+        batch_device = nullptr;
+    }
+
+    [[nodiscard]] auto getBatchSize() const -> size_t { return batch_size; }
+
+    [[nodiscard]] auto getBatchLane() const -> size_t { return batch_lane; }
+
+    [[nodiscard]] auto getBatchDevice() const -> RTDevice * { return batch_device; }
+
     [[nodiscard]] auto getMemoryManager() const -> const std::unique_ptr<MemoryManager> &
     {
         return memory_man_ptr;
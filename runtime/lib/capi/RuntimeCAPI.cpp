@@ -16,12 +16,14 @@
 #include <cstdlib>
 #include <ctime>
 
+#include <algorithm>
 #include <bitset>
 #include <stdexcept>
 
 #include <memory>
 #include <ostream>
 #include <string_view>
+#include <tuple>
 
 #include "mlir/ExecutionEngine/CRunnerUtils.h"
 
@@ -51,20 +53,30 @@ bool getModifiersAdjoint(const Modifiers *modifiers)
     return !modifiers ? false : modifiers->adjoint;
 }
 
-std::vector<QubitIdType> getModifiersControlledWires(const Modifiers *modifiers)
+// The controlled wires and values are unpacked into thread local buffers, whose capacity is
+// reused across gates, so that applying a controlled gate does not allocate.
+const std::vector<QubitIdType> &getModifiersControlledWires(const Modifiers *modifiers)
 {
-    return !modifiers ? std::vector<QubitIdType>()
-                      : std::vector<QubitIdType>(
-                            reinterpret_cast<QubitIdType *>(modifiers->controlled_wires),
-                            reinterpret_cast<QubitIdType *>(modifiers->controlled_wires) +
-                                modifiers->num_controlled);
+    thread_local std::vector<QubitIdType> controlled_wires;
+    if (!modifiers) {
+        controlled_wires.clear();
+        return controlled_wires;
+    }
+    auto *wires = reinterpret_cast<QubitIdType *>(modifiers->controlled_wires);
+    controlled_wires.assign(wires, wires + modifiers->num_controlled);
+    return controlled_wires;
 }
 
-std::vector<bool> getModifiersControlledValues(const Modifiers *modifiers)
+const std::vector<bool> &getModifiersControlledValues(const Modifiers *modifiers)
 {
-    return !modifiers ? std::vector<bool>()
-                      : std::vector<bool>(modifiers->controlled_values,
-                                          modifiers->controlled_values + modifiers->num_controlled);
+    thread_local std::vector<bool> controlled_values;
+    if (!modifiers) {
+        controlled_values.clear();
+        return controlled_values;
+    }
+    controlled_values.assign(modifiers->controlled_values,
+                             modifiers->controlled_values + modifiers->num_controlled);
+    return controlled_values;
 }
 
 #define MODIFIERS_ARGS(mod)                                                                        \
@@ -258,6 +270,16 @@ static int __catalyst__rt__device_init__impl(int8_t *rtd_lib, int8_t *rtd_name,
     if (CTX->getDeviceRecorderStatus()) {
         getQuantumDevicePtr()->StartTapeRecording();
     }
+    if (CTX->getBatchSize()) {
+        // Every lane of a batch must run on the device that recorded the first lane.
+        if (!CTX->getBatchDevice()) {
+            getQuantumDevicePtr()->StartBatch(CTX->getBatchSize());
+            CTX->setBatchDevice(RTD_PTR);
+        }
+        RT_FAIL_IF(CTX->getBatchDevice() != RTD_PTR,
+                   "Batched execution requires all lanes to run on the same device");
+        getQuantumDevicePtr()->SetBatchLane(CTX->getBatchLane());
+    }
     return 0;
 }
 
@@ -297,6 +319,39 @@ void __catalyst__rt__toggle_recorder(bool status)
     }
 }
 
+void __catalyst__rt__batch_begin(int64_t batch_size)
+{
+    RT_FAIL_IF(!CTX, "Invalid use of the global driver before initialization");
+    RT_FAIL_IF(RTD_PTR, "Cannot start a batched execution while a device is active");
+    RT_FAIL_IF(batch_size <= 0, "Invalid batch size");
+    CTX->startBatch(static_cast<size_t>(batch_size));
+}
+
+void __catalyst__rt__batch_lane(int64_t lane)
+{
+    RT_FAIL_IF(!CTX, "Invalid use of the global driver before initialization");
+    RT_FAIL_IF(lane < 0, "Invalid batch lane");
+    CTX->setBatchLane(static_cast<size_t>(lane));
+}
+
+void __catalyst__rt__batch_execute()
+{
+    RT_FAIL_IF(!CTX, "Invalid use of the global driver before initialization");
+    RT_FAIL_IF(!CTX->getBatchDevice(), "Cannot execute a batch without any recorded lane");
+    CTX->getBatchDevice()->getQuantumDevicePtr()->ExecuteBatch();
+}
+
+void __catalyst__rt__batch_end()
+{
+    RT_FAIL_IF(!CTX, "Invalid use of the global driver before initialization");
+    if (RTDevice *device = CTX->getBatchDevice()) {
+        device->getQuantumDevicePtr()->StopBatch();
+    }
+    CTX->stopBatch();
+}
+
+void __catalyst__rt__checkpoint(bool diverges) { getQuantumDevicePtr()->Checkpoint(diverges); }
+
 static QUBIT *__catalyst__rt__qubit_allocate__impl()
 {
     RT_ASSERT(getQuantumDevicePtr() != nullptr);
@@ -323,22 +378,14 @@ static QirArray *__catalyst__rt__qubit_allocate_array__impl(int64_t num_qubits)
     // And the device library can choose how to handle everything.
     std::vector<QubitIdType> qubit_vector = getQuantumDevicePtr()->AllocateQubits(num_qubits);
 
-    // I don't like this copying.
-    std::vector<QubitIdType> *qubit_vector_ptr =
-        new std::vector<QubitIdType>(qubit_vector.begin(), qubit_vector.end());
+    // The layout of `QirQubitArray` is known to the compiler, which indexes `data`
+    // directly when lowering `quantum.extract`.
+    const size_t num_allocated = qubit_vector.size();
+    QirQubitArray *qubit_array_ptr =
+        new QirQubitArray{new QubitIdType[num_allocated], static_cast<int64_t>(num_allocated)};
+    std::copy(qubit_vector.begin(), qubit_vector.end(), qubit_array_ptr->data);
 
-    // Because this function is interfacing with C
-    // I think we should return a trivial-type
-    //     https://en.cppreference.com/w/cpp/named_req/TrivialType
-    // Why should we return a trivial type?
-    //
-    // Paraphrasing from stackoverflow: https://stackoverflow.com/a/72409589
-    //     extern "C" will avoid name mangling from happening.
-    //     It doesn't prevent a function from returning or accepting a C++ type.
-    //     But the calling language needs to understand the data-layout for the
-    //     type being returned.
-    //     For non-trivial types, this will be difficult to impossible.
-    return (QirArray *)qubit_vector_ptr;
+    return (QirArray *)qubit_array_ptr;
 }
 
 QirArray *__catalyst__rt__qubit_allocate_array(int64_t num_qubits)
@@ -362,8 +409,8 @@ void __catalyst__rt__qubit_release(QUBIT *qubit)
 static int __catalyst__rt__qubit_release_array__impl(QirArray *qubit_array)
 {
     getQuantumDevicePtr()->ReleaseAllQubits();
-    std::vector<QubitIdType> *qubit_array_ptr =
-        reinterpret_cast<std::vector<QubitIdType> *>(qubit_array);
+    QirQubitArray *qubit_array_ptr = reinterpret_cast<QirQubitArray *>(qubit_array);
+    delete[] qubit_array_ptr->data;
     delete qubit_array_ptr;
     return 0;
 }
@@ -385,6 +432,20 @@ RESULT *__catalyst__rt__result_get_one() { return getQuantumDevicePtr()->One();
 
 RESULT *__catalyst__rt__result_get_zero() { return getQuantumDevicePtr()->Zero(); }
 
+static void _gradient_impl(int64_t numResults, MemRefT<double, 1> *const *results,
+                           const std::vector<size_t> &train_params)
+{
+    std::vector<DataView<double, 1>> mem_views;
+    mem_views.reserve(numResults);
+    for (int64_t i = 0; i < numResults; i++) {
+        mem_views.emplace_back(results[i]->data_aligned, results[i]->offset, results[i]->sizes,
+                               results[i]->strides);
+    }
+
+    // num_observables * num_train_params
+    getQuantumDevicePtr()->Gradient(mem_views, train_params);
+}
+
 void __catalyst__qis__Gradient(int64_t numResults, /* results = */...)
 {
     RT_ASSERT(numResults >= 0);
@@ -399,14 +460,13 @@ void __catalyst__qis__Gradient(int64_t numResults, /* results = */...)
     }
     va_end(args);
 
-    std::vector<DataView<double, 1>> mem_views;
-    mem_views.reserve(numResults);
-    for (auto *mr : mem_ptrs) {
-        mem_views.emplace_back(mr->data_aligned, mr->offset, mr->sizes, mr->strides);
-    }
+    _gradient_impl(numResults, mem_ptrs.data(), {});
+}
 
-    // num_observables * num_train_params
-    getQuantumDevicePtr()->Gradient(mem_views, {});
+void __catalyst__qis__Gradient_array(int64_t numResults, MemRefT_double_1d **results)
+{
+    RT_ASSERT(numResults >= 0);
+    _gradient_impl(numResults, reinterpret_cast<MemRefT<double, 1> **>(results), {});
 }
 
 void __catalyst__qis__Gradient_params(MemRefT_int64_1d *params, int64_t numResults,
@@ -440,14 +500,7 @@ void __catalyst__qis__Gradient_params(MemRefT_int64_1d *params, int64_t numResul
     }
     va_end(args);
 
-    std::vector<DataView<double, 1>> mem_views;
-    mem_views.reserve(numResults);
-    for (auto *mr : mem_ptrs) {
-        mem_views.emplace_back(mr->data_aligned, mr->offset, mr->sizes, mr->strides);
-    }
-
-    // num_observables * num_train_params
-    getQuantumDevicePtr()->Gradient(mem_views, train_params);
+    _gradient_impl(numResults, mem_ptrs.data(), train_params);
 }
 
 void __catalyst__qis__GlobalPhase(double phi, const Modifiers *modifiers)
@@ -659,22 +712,70 @@ void __catalyst__qis__Toffoli(QUBIT *wire0, QUBIT *wire1, QUBIT *wire2, const Mo
                                           /* modifiers */ MODIFIERS_ARGS(modifiers));
 }
 
+static auto _wires_from_args(int64_t numQubits, va_list *args) -> std::vector<QubitIdType>
+{
+    std::vector<QubitIdType> wires(numQubits);
+    for (int64_t i = 0; i < numQubits; i++) {
+        wires[i] = va_arg(*args, QubitIdType);
+    }
+    return wires;
+}
+
+static auto _wires_from_array(int64_t numQubits, QUBIT **qubits) -> std::vector<QubitIdType>
+{
+    std::vector<QubitIdType> wires(numQubits);
+    for (int64_t i = 0; i < numQubits; i++) {
+        wires[i] = reinterpret_cast<QubitIdType>(qubits[i]);
+    }
+    return wires;
+}
+
 void __catalyst__qis__MultiRZ(double theta, const Modifiers *modifiers, int64_t numQubits, ...)
 {
     RT_ASSERT(numQubits >= 0);
 
     va_list args;
     va_start(args, numQubits);
-    std::vector<QubitIdType> wires(numQubits);
-    for (int64_t i = 0; i < numQubits; i++) {
-        wires[i] = va_arg(args, QubitIdType);
-    }
+    std::vector<QubitIdType> wires = _wires_from_args(numQubits, &args);
     va_end(args);
 
     getQuantumDevicePtr()->NamedOperation("MultiRZ", {theta}, wires,
                                           /* modifiers */ MODIFIERS_ARGS(modifiers));
 }
 
+void __catalyst__qis__MultiRZ_array(double theta, const Modifiers *modifiers, int64_t numQubits,
+                                    QUBIT **qubits)
+{
+    RT_ASSERT(numQubits >= 0);
+
+    getQuantumDevicePtr()->NamedOperation("MultiRZ", {theta},
+                                          _wires_from_array(numQubits, qubits),
+                                          /* modifiers */ MODIFIERS_ARGS(modifiers));
+}
+
+void __catalyst__qis__QFT(const Modifiers *modifiers, int64_t numQubits, QUBIT **qubits)
+{
+    RT_ASSERT(numQubits >= 0);
+
+    getQuantumDevicePtr()->QFT(_wires_from_array(numQubits, qubits),
+                               /* modifiers */ MODIFIERS_ARGS(modifiers));
+}
+
+void __catalyst__qis__PauliRot(double theta, const char *pauli_word, const Modifiers *modifiers,
+                               int64_t numQubits, QUBIT **qubits)
+{
+    RT_ASSERT(numQubits >= 0);
+
+    const std::string_view word{pauli_word};
+    RT_FAIL_IF(word.size() != static_cast<size_t>(numQubits),
+               "Invalid length of Pauli word for the given qubits");
+    RT_FAIL_IF(word.find_first_not_of("IXYZ") != std::string_view::npos, "Invalid Pauli word");
+
+    getQuantumDevicePtr()->PauliRotation(std::string{word}, theta,
+                                         _wires_from_array(numQubits, qubits),
+                                         /* modifiers */ MODIFIERS_ARGS(modifiers));
+}
+
 void __catalyst__qis__ISWAP(QUBIT *wire0, QUBIT *wire1, const Modifiers *modifiers)
 {
     getQuantumDevicePtr()->NamedOperation(
@@ -690,9 +791,8 @@ void __catalyst__qis__PSWAP(double phi, QUBIT *wire0, QUBIT *wire1, const Modifi
         MODIFIERS_ARGS(modifiers));
 }
 
-static void _qubitUnitary_impl(MemRefT_CplxT_double_2d *matrix, int64_t numQubits,
-                               std::vector<std::complex<double>> &coeffs,
-                               std::vector<QubitIdType> &wires, va_list *args)
+static void _qubitUnitary_impl(MemRefT_CplxT_double_2d *matrix, const Modifiers *modifiers,
+                               int64_t numQubits, const std::vector<QubitIdType> &wires)
 {
     const size_t num_rows = matrix->sizes[0];
     const size_t num_col = matrix->sizes[1];
@@ -703,16 +803,14 @@ static void _qubitUnitary_impl(MemRefT_CplxT_double_2d *matrix, int64_t numQubit
                 "The size of the matrix must be pow(2, numWires) * pow(2, numWires).");
     }
 
-    wires.reserve(numQubits);
-    for (int64_t i = 0; i < numQubits; i++) {
-        wires.push_back(va_arg(*args, QubitIdType));
-    }
-
     const size_t matrix_size = num_rows * num_col;
+    std::vector<std::complex<double>> coeffs;
     coeffs.reserve(matrix_size);
     for (size_t i = 0; i < matrix_size; i++) {
         coeffs.emplace_back(matrix->data_aligned[i].real, matrix->data_aligned[i].imag);
     }
+
+    getQuantumDevicePtr()->MatrixOperation(coeffs, wires, MODIFIERS_ARGS(modifiers));
 }
 
 void __catalyst__qis__QubitUnitary(MemRefT_CplxT_double_2d *matrix, const Modifiers *modifiers,
@@ -729,12 +827,56 @@ void __catalyst__qis__QubitUnitary(MemRefT_CplxT_double_2d *matrix, const Modifi
     }
 
     va_list args;
-    std::vector<std::complex<double>> coeffs;
-    std::vector<QubitIdType> wires;
     va_start(args, numQubits);
-    _qubitUnitary_impl(matrix, numQubits, coeffs, wires, &args);
+    std::vector<QubitIdType> wires = _wires_from_args(numQubits, &args);
     va_end(args);
-    return getQuantumDevicePtr()->MatrixOperation(coeffs, wires, MODIFIERS_ARGS(modifiers));
+
+    _qubitUnitary_impl(matrix, modifiers, numQubits, wires);
+}
+
+void __catalyst__qis__QubitUnitary_array(MemRefT_CplxT_double_2d *matrix,
+                                         const Modifiers *modifiers, int64_t numQubits,
+                                         QUBIT **qubits)
+{
+    RT_ASSERT(numQubits >= 0);
+
+    if (matrix == nullptr) {
+        RT_FAIL("The QubitUnitary matrix must be initialized");
+    }
+
+    if (numQubits > __catalyst__rt__num_qubits()) {
+        RT_FAIL("Invalid number of wires");
+    }
+
+    _qubitUnitary_impl(matrix, modifiers, numQubits, _wires_from_array(numQubits, qubits));
+}
+
+void __catalyst__qis__SetState(MemRefT_CplxT_double_1d *state, int64_t numQubits, QUBIT **qubits)
+{
+    RT_ASSERT(numQubits >= 0);
+    RT_FAIL_IF(state == nullptr, "The state to prepare must be initialized");
+    RT_FAIL_IF(state->sizes[0] != (1UL << numQubits),
+               "Invalid size of the state; The size of the state must be pow(2, numWires)");
+
+    MemRefT<std::complex<double>, 1> *state_p = (MemRefT<std::complex<double>, 1> *)state;
+    DataView<std::complex<double>, 1> view(state_p->data_aligned, state_p->offset,
+                                           state_p->sizes, state_p->strides);
+
+    getQuantumDevicePtr()->SetState(view, _wires_from_array(numQubits, qubits));
+}
+
+void __catalyst__qis__SetBasisState(MemRefT_int8_1d *bits, int64_t numQubits, QUBIT **qubits)
+{
+    RT_ASSERT(numQubits >= 0);
+    RT_FAIL_IF(bits == nullptr, "The basis state to prepare must be initialized");
+    RT_FAIL_IF(bits->sizes[0] != static_cast<size_t>(numQubits),
+               "Invalid size of the basis state; The basis state must have one bit per wire");
+
+    MemRefT<int8_t, 1> *bits_p = (MemRefT<int8_t, 1> *)bits;
+    DataView<int8_t, 1> view(bits_p->data_aligned, bits_p->offset, bits_p->sizes,
+                             bits_p->strides);
+
+    getQuantumDevicePtr()->SetBasisState(view, _wires_from_array(numQubits, qubits));
 }
 
 ObsIdType __catalyst__qis__NamedObs(int64_t obsId, QUBIT *wire)
@@ -743,7 +885,7 @@ ObsIdType __catalyst__qis__NamedObs(int64_t obsId, QUBIT *wire)
                                              {reinterpret_cast<QubitIdType>(wire)});
 }
 
-ObsIdType __catalyst__qis__HermitianObs(MemRefT_CplxT_double_2d *matrix, int64_t numQubits, ...)
+static void _hermitianObs_check(MemRefT_CplxT_double_2d *matrix, int64_t numQubits)
 {
     RT_ASSERT(numQubits >= 0);
 
@@ -751,22 +893,19 @@ ObsIdType __catalyst__qis__HermitianObs(MemRefT_CplxT_double_2d *matrix, int64_t
         RT_FAIL("The Hermitian matrix must be initialized");
     }
 
-    const size_t num_rows = matrix->sizes[0];
-    const size_t num_col = matrix->sizes[1];
     const size_t expected_size = std::pow(2, numQubits);
 
-    if (num_rows != expected_size || num_col != expected_size) {
+    if (matrix->sizes[0] != expected_size || matrix->sizes[1] != expected_size) {
         RT_FAIL("Invalid given Hermitian matrix; "
                 "The size of the matrix must be pow(2, numWires) * pow(2, numWires).");
     }
+}
 
-    va_list args;
-    va_start(args, numQubits);
-    std::vector<QubitIdType> wires(numQubits);
-    for (int64_t i = 0; i < numQubits; i++) {
-        wires[i] = va_arg(args, QubitIdType);
-    }
-    va_end(args);
+static auto _hermitianObs_impl(MemRefT_CplxT_double_2d *matrix, int64_t numQubits,
+                               const std::vector<QubitIdType> &wires) -> ObsIdType
+{
+    const size_t num_rows = matrix->sizes[0];
+    const size_t num_col = matrix->sizes[1];
 
     if (numQubits > __catalyst__rt__num_qubits()) {
         RT_FAIL("Invalid number of wires");
@@ -782,6 +921,25 @@ ObsIdType __catalyst__qis__HermitianObs(MemRefT_CplxT_double_2d *matrix, int64_t
     return getQuantumDevicePtr()->Observable(ObsId::Hermitian, coeffs, wires);
 }
 
+ObsIdType __catalyst__qis__HermitianObs(MemRefT_CplxT_double_2d *matrix, int64_t numQubits, ...)
+{
+    _hermitianObs_check(matrix, numQubits);
+
+    va_list args;
+    va_start(args, numQubits);
+    std::vector<QubitIdType> wires = _wires_from_args(numQubits, &args);
+    va_end(args);
+
+    return _hermitianObs_impl(matrix, numQubits, wires);
+}
+
+ObsIdType __catalyst__qis__HermitianObs_array(MemRefT_CplxT_double_2d *matrix, int64_t numQubits,
+                                              QUBIT **qubits)
+{
+    _hermitianObs_check(matrix, numQubits);
+    return _hermitianObs_impl(matrix, numQubits, _wires_from_array(numQubits, qubits));
+}
+
 ObsIdType __catalyst__qis__TensorObs(int64_t numObs, /*obsKeys*/...)
 {
     if (numObs < 1) {
@@ -800,8 +958,16 @@ ObsIdType __catalyst__qis__TensorObs(int64_t numObs, /*obsKeys*/...)
     return getQuantumDevicePtr()->TensorObservable(obsKeys);
 }
 
-ObsIdType __catalyst__qis__HamiltonianObs(MemRefT_double_1d *coeffs, int64_t numObs,
-                                          /*obsKeys*/...)
+ObsIdType __catalyst__qis__TensorObs_array(int64_t numObs, ObsIdType *obsKeys)
+{
+    if (numObs < 1) {
+        RT_FAIL("Invalid number of observables to create TensorProdObs");
+    }
+
+    return getQuantumDevicePtr()->TensorObservable({obsKeys, obsKeys + numObs});
+}
+
+static void _hamiltonianObs_check(MemRefT_double_1d *coeffs, int64_t numObs)
 {
     RT_ASSERT(numObs >= 0);
 
@@ -816,6 +982,12 @@ ObsIdType __catalyst__qis__HamiltonianObs(MemRefT_double_1d *coeffs, int64_t num
         RT_FAIL("Invalid coefficients for computing Hamiltonian; "
                 "The number of coefficients and observables must be equal.");
     }
+}
+
+ObsIdType __catalyst__qis__HamiltonianObs(MemRefT_double_1d *coeffs, int64_t numObs,
+                                          /*obsKeys*/...)
+{
+    _hamiltonianObs_check(coeffs, numObs);
 
     va_list args;
     va_start(args, numObs);
@@ -826,10 +998,19 @@ ObsIdType __catalyst__qis__HamiltonianObs(MemRefT_double_1d *coeffs, int64_t num
     }
     va_end(args);
 
-    std::vector<double> coeffs_vec(coeffs->data_aligned, coeffs->data_aligned + coeffs_size);
+    std::vector<double> coeffs_vec(coeffs->data_aligned, coeffs->data_aligned + numObs);
     return getQuantumDevicePtr()->HamiltonianObservable(coeffs_vec, obsKeys);
 }
 
+ObsIdType __catalyst__qis__HamiltonianObs_array(MemRefT_double_1d *coeffs, int64_t numObs,
+                                                ObsIdType *obsKeys)
+{
+    _hamiltonianObs_check(coeffs, numObs);
+
+    std::vector<double> coeffs_vec(coeffs->data_aligned, coeffs->data_aligned + numObs);
+    return getQuantumDevicePtr()->HamiltonianObservable(coeffs_vec, {obsKeys, obsKeys + numObs});
+}
+
 RESULT *__catalyst__qis__Measure(QUBIT *wire, int32_t postselect)
 {
     std::optional<int32_t> postselectOpt{postselect};
@@ -847,19 +1028,40 @@ double __catalyst__qis__Expval(ObsIdType obsKey) { return getQuantumDevicePtr()-
 
 double __catalyst__qis__Variance(ObsIdType obsKey) { return getQuantumDevicePtr()->Var(obsKey); }
 
-void __catalyst__qis__State(MemRefT_CplxT_double_1d *result, int64_t numQubits, ...)
+void __catalyst__qis__ExpvalVar(double *results, ObsIdType obsKey)
 {
-    RT_ASSERT(numQubits >= 0);
-    MemRefT<std::complex<double>, 1> *result_p = (MemRefT<std::complex<double>, 1> *)result;
+    RT_ASSERT(results != nullptr);
+
+    std::tie(results[0], results[1]) = getQuantumDevicePtr()->ExpvalVar(obsKey);
+}
+
+void __catalyst__qis__MeasurementGroup(int64_t numObs, /*obsKeys*/...)
+{
+    RT_ASSERT(numObs >= 0);
 
     va_list args;
-    va_start(args, numQubits);
-    std::vector<QubitIdType> wires(numQubits);
-    for (int64_t i = 0; i < numQubits; i++) {
-        wires[i] = va_arg(args, QubitIdType);
+    va_start(args, numObs);
+    std::vector<ObsIdType> obsKeys;
+    obsKeys.reserve(numObs);
+    for (int64_t i = 0; i < numObs; i++) {
+        obsKeys.push_back(va_arg(args, ObsIdType));
     }
     va_end(args);
 
+    getQuantumDevicePtr()->GroupMeasurements(obsKeys);
+}
+
+void __catalyst__qis__MeasurementGroup_array(int64_t numObs, ObsIdType *obsKeys)
+{
+    RT_ASSERT(numObs >= 0);
+
+    getQuantumDevicePtr()->GroupMeasurements({obsKeys, obsKeys + numObs});
+}
+
+static void _state_impl(MemRefT_CplxT_double_1d *result, const std::vector<QubitIdType> &wires)
+{
+    MemRefT<std::complex<double>, 1> *result_p = (MemRefT<std::complex<double>, 1> *)result;
+
     DataView<std::complex<double>, 1> view(result_p->data_aligned, result_p->offset,
                                            result_p->sizes, result_p->strides);
 
@@ -873,19 +1075,29 @@ void __catalyst__qis__State(MemRefT_CplxT_double_1d *result, int64_t numQubits,
     }
 }
 
-void __catalyst__qis__Probs(MemRefT_double_1d *result, int64_t numQubits, ...)
+void __catalyst__qis__State(MemRefT_CplxT_double_1d *result, int64_t numQubits, ...)
 {
     RT_ASSERT(numQubits >= 0);
-    MemRefT<double, 1> *result_p = (MemRefT<double, 1> *)result;
 
     va_list args;
     va_start(args, numQubits);
-    std::vector<QubitIdType> wires(numQubits);
-    for (int64_t i = 0; i < numQubits; i++) {
-        wires[i] = va_arg(args, QubitIdType);
-    }
+    std::vector<QubitIdType> wires = _wires_from_args(numQubits, &args);
     va_end(args);
 
+    _state_impl(result, wires);
+}
+
+void __catalyst__qis__State_array(MemRefT_CplxT_double_1d *result, int64_t numQubits,
+                                  QUBIT **qubits)
+{
+    RT_ASSERT(numQubits >= 0);
+    _state_impl(result, _wires_from_array(numQubits, qubits));
+}
+
+static void _probs_impl(MemRefT_double_1d *result, const std::vector<QubitIdType> &wires)
+{
+    MemRefT<double, 1> *result_p = (MemRefT<double, 1> *)result;
+
     DataView<double, 1> view(result_p->data_aligned, result_p->offset, result_p->sizes,
                              result_p->strides);
 
@@ -897,20 +1109,29 @@ void __catalyst__qis__Probs(MemRefT_double_1d *result, int64_t numQubits, ...)
     }
 }
 
-void __catalyst__qis__Sample(MemRefT_double_2d *result, int64_t shots, int64_t numQubits, ...)
+void __catalyst__qis__Probs(MemRefT_double_1d *result, int64_t numQubits, ...)
 {
-    RT_ASSERT(shots >= 0);
     RT_ASSERT(numQubits >= 0);
-    MemRefT<double, 2> *result_p = (MemRefT<double, 2> *)result;
 
     va_list args;
     va_start(args, numQubits);
-    std::vector<QubitIdType> wires(numQubits);
-    for (int64_t i = 0; i < numQubits; i++) {
-        wires[i] = va_arg(args, QubitIdType);
-    }
+    std::vector<QubitIdType> wires = _wires_from_args(numQubits, &args);
     va_end(args);
 
+    _probs_impl(result, wires);
+}
+
+void __catalyst__qis__Probs_array(MemRefT_double_1d *result, int64_t numQubits, QUBIT **qubits)
+{
+    RT_ASSERT(numQubits >= 0);
+    _probs_impl(result, _wires_from_array(numQubits, qubits));
+}
+
+static void _sample_impl(MemRefT_double_2d *result, int64_t shots,
+                         const std::vector<QubitIdType> &wires)
+{
+    MemRefT<double, 2> *result_p = (MemRefT<double, 2> *)result;
+
     DataView<double, 2> view(result_p->data_aligned, result_p->offset, result_p->sizes,
                              result_p->strides);
 
@@ -922,28 +1143,115 @@ void __catalyst__qis__Sample(MemRefT_double_2d *result, int64_t shots, int64_t n
     }
 }
 
-void __catalyst__qis__Counts(PairT_MemRefT_double_int64_1d *result, int64_t shots,
-                             int64_t numQubits, ...)
+void __catalyst__qis__Sample(MemRefT_double_2d *result, int64_t shots, int64_t numQubits, ...)
 {
     RT_ASSERT(shots >= 0);
     RT_ASSERT(numQubits >= 0);
-    MemRefT<double, 1> *result_eigvals_p = (MemRefT<double, 1> *)&result->first;
-    MemRefT<int64_t, 1> *result_counts_p = (MemRefT<int64_t, 1> *)&result->second;
 
     va_list args;
     va_start(args, numQubits);
-    std::vector<QubitIdType> wires(numQubits);
-    for (int64_t i = 0; i < numQubits; i++) {
-        wires[i] = va_arg(args, QubitIdType);
+    std::vector<QubitIdType> wires = _wires_from_args(numQubits, &args);
+    va_end(args);
+
+    _sample_impl(result, shots, wires);
+}
+
+void __catalyst__qis__Sample_array(MemRefT_double_2d *result, int64_t shots, int64_t numQubits,
+                                   QUBIT **qubits)
+{
+    RT_ASSERT(shots >= 0);
+    RT_ASSERT(numQubits >= 0);
+    _sample_impl(result, shots, _wires_from_array(numQubits, qubits));
+}
+
+static void _packed_sample_impl(MemRefT_int64_1d *result, int64_t shots,
+                                const std::vector<QubitIdType> &wires)
+{
+    MemRefT<int64_t, 1> *result_p = (MemRefT<int64_t, 1> *)result;
+
+    DataView<int64_t, 1> view(result_p->data_aligned, result_p->offset, result_p->sizes,
+                              result_p->strides);
+
+    if (wires.empty()) {
+        getQuantumDevicePtr()->PackedSample(view, shots);
     }
+    else {
+        getQuantumDevicePtr()->PartialPackedSample(view, wires, shots);
+    }
+}
+
+void __catalyst__qis__PackedSample(MemRefT_int64_1d *result, int64_t shots, int64_t numQubits,
+                                   ...)
+{
+    RT_ASSERT(shots >= 0);
+    RT_ASSERT(numQubits >= 0);
+
+    va_list args;
+    va_start(args, numQubits);
+    std::vector<QubitIdType> wires = _wires_from_args(numQubits, &args);
+    va_end(args);
+
+    _packed_sample_impl(result, shots, wires);
+}
+
+void __catalyst__qis__PackedSample_array(MemRefT_int64_1d *result, int64_t shots,
+                                         int64_t numQubits, QUBIT **qubits)
+{
+    RT_ASSERT(shots >= 0);
+    RT_ASSERT(numQubits >= 0);
+    _packed_sample_impl(result, shots, _wires_from_array(numQubits, qubits));
+}
+
+static void _shadow_impl(MemRefT_int64_2d *result, int64_t shots,
+                         const std::vector<QubitIdType> &wires)
+{
+    MemRefT<int64_t, 2> *result_p = (MemRefT<int64_t, 2> *)result;
+
+    DataView<int64_t, 2> view(result_p->data_aligned, result_p->offset, result_p->sizes,
+                              result_p->strides);
+
+    getQuantumDevicePtr()->Shadow(view, wires, shots);
+}
+
+void __catalyst__qis__Shadow(MemRefT_int64_2d *result, int64_t shots, int64_t numQubits, ...)
+{
+    RT_ASSERT(shots >= 0);
+    RT_ASSERT(numQubits >= 0);
+
+    va_list args;
+    va_start(args, numQubits);
+    std::vector<QubitIdType> wires = _wires_from_args(numQubits, &args);
     va_end(args);
 
+    _shadow_impl(result, shots, wires);
+}
+
+void __catalyst__qis__Shadow_array(MemRefT_int64_2d *result, int64_t shots, int64_t numQubits,
+                                   QUBIT **qubits)
+{
+    RT_ASSERT(shots >= 0);
+    RT_ASSERT(numQubits >= 0);
+    _shadow_impl(result, shots, _wires_from_array(numQubits, qubits));
+}
+
+static void _counts_impl(PairT_MemRefT_double_int64_1d *result, int64_t shots,
+                         const std::vector<QubitIdType> &wires, bool sparse = false)
+{
+    MemRefT<double, 1> *result_eigvals_p = (MemRefT<double, 1> *)&result->first;
+    MemRefT<int64_t, 1> *result_counts_p = (MemRefT<int64_t, 1> *)&result->second;
+
     DataView<double, 1> eigvals_view(result_eigvals_p->data_aligned, result_eigvals_p->offset,
                                      result_eigvals_p->sizes, result_eigvals_p->strides);
     DataView<int64_t, 1> counts_view(result_counts_p->data_aligned, result_counts_p->offset,
                                      result_counts_p->sizes, result_counts_p->strides);
 
-    if (wires.empty()) {
+    if (sparse && wires.empty()) {
+        getQuantumDevicePtr()->SparseCounts(eigvals_view, counts_view, shots);
+    }
+    else if (sparse) {
+        getQuantumDevicePtr()->PartialSparseCounts(eigvals_view, counts_view, wires, shots);
+    }
+    else if (wires.empty()) {
         getQuantumDevicePtr()->Counts(eigvals_view, counts_view, shots);
     }
     else {
@@ -951,16 +1259,58 @@ void __catalyst__qis__Counts(PairT_MemRefT_double_int64_1d *result, int64_t shot
     }
 }
 
+void __catalyst__qis__Counts(PairT_MemRefT_double_int64_1d *result, int64_t shots,
+                             int64_t numQubits, ...)
+{
+    RT_ASSERT(shots >= 0);
+    RT_ASSERT(numQubits >= 0);
+
+    va_list args;
+    va_start(args, numQubits);
+    std::vector<QubitIdType> wires = _wires_from_args(numQubits, &args);
+    va_end(args);
+
+    _counts_impl(result, shots, wires);
+}
+
+void __catalyst__qis__Counts_array(PairT_MemRefT_double_int64_1d *result, int64_t shots,
+                                   int64_t numQubits, QUBIT **qubits)
+{
+    RT_ASSERT(shots >= 0);
+    RT_ASSERT(numQubits >= 0);
+    _counts_impl(result, shots, _wires_from_array(numQubits, qubits));
+}
+
+void __catalyst__qis__SparseCounts(PairT_MemRefT_double_int64_1d *result, int64_t shots,
+                                   int64_t numQubits, ...)
+{
+    RT_ASSERT(shots >= 0);
+    RT_ASSERT(numQubits >= 0);
+
+    va_list args;
+    va_start(args, numQubits);
+    std::vector<QubitIdType> wires = _wires_from_args(numQubits, &args);
+    va_end(args);
+
+    _counts_impl(result, shots, wires, /*sparse=*/true);
+}
+
+void __catalyst__qis__SparseCounts_array(PairT_MemRefT_double_int64_1d *result, int64_t shots,
+                                         int64_t numQubits, QUBIT **qubits)
+{
+    RT_ASSERT(shots >= 0);
+    RT_ASSERT(numQubits >= 0);
+    _counts_impl(result, shots, _wires_from_array(numQubits, qubits), /*sparse=*/true);
+}
+
 int64_t __catalyst__rt__array_get_size_1d(QirArray *ptr)
 {
-    std::vector<QubitIdType> *qubit_vector_ptr = reinterpret_cast<std::vector<QubitIdType> *>(ptr);
-    return qubit_vector_ptr->size();
+    return reinterpret_cast<QirQubitArray *>(ptr)->size;
 }
 
 int8_t *__catalyst__rt__array_get_element_ptr_1d(QirArray *ptr, int64_t idx)
 {
-    std::vector<QubitIdType> *qubit_vector_ptr = reinterpret_cast<std::vector<QubitIdType> *>(ptr);
-    QubitIdType *data = qubit_vector_ptr->data();
+    QubitIdType *data = reinterpret_cast<QirQubitArray *>(ptr)->data;
     return (int8_t *)&data[idx];
 }
 }
@@ -54,6 +54,25 @@ TEST_CASE("Test addOperations with a naive example", "[CacheManager]")
     CHECK(cm.getNumObservables() == 0);
 }
 
+TEST_CASE("Test addPauliRotation caches a MultiRZ decomposition", "[CacheManager]")
+{
+    CacheManager cm = CacheManager();
+
+    cm.addPauliRotation("XIY", 0.5, {0, 1, 2}, true);
+
+    const std::vector<std::string> expected_names{"Hadamard", "S",        "Hadamard",
+                                                  "MultiRZ",  "Hadamard", "Hadamard", "S"};
+    const std::vector<size_t> expected_wires{0, 2};
+    const std::vector<bool> expected_inverses{false, true, false, true, false, false, false};
+    CHECK(cm.getOperationsNames() == expected_names);
+    CHECK(cm.getOperationsWires()[3] == expected_wires);
+    CHECK(cm.getOperationsInverses() == expected_inverses);
+    CHECK(cm.getNumParams() == 1);
+
+    REQUIRE_THROWS_WITH(cm.addPauliRotation("II", 0.5, {0, 1}, false),
+                        Catch::Contains("Cannot cache a Pauli rotation about the identity"));
+}
+
 TEMPLATE_LIST_TEST_CASE("Test edge cases of the cache manager in QuantumDevice methods",
                         "[CacheManager]", SimTypes)
 {
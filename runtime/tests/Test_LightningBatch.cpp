@@ -0,0 +1,279 @@
+// Copyright 2024 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+
+#include "RuntimeCAPI.h"
+#include "Types.h"
+
+#include "LightningSimulator.hpp"
+#include "QuantumDevice.hpp"
+
+#include "TestUtils.hpp"
+
+using namespace Catalyst::Runtime;
+using namespace Catalyst::Runtime::Simulator;
+
+namespace {
+// Apply a circuit covering named, controlled, adjoint, and matrix gates, parametrized by `x`.
+void applyCircuit(QuantumDevice &sim, const std::vector<QubitIdType> &Qs, double x)
+{
+    const std::complex<double> i{0, 1};
+    const std::vector<std::complex<double>> matrix{std::cos(x / 2), -i * std::sin(x / 2),
+                                                   -i * std::sin(x / 2), std::cos(x / 2)};
+
+    sim.NamedOperation("Hadamard", {}, {Qs[0]});
+    sim.NamedOperation("RX", {x}, {Qs[1]});
+    sim.NamedOperation("CNOT", {}, {Qs[0], Qs[2]});
+    sim.NamedOperation("Rot", {x, 2 * x, 0.3}, {Qs[2]}, true);
+    sim.NamedOperation("IsingXY", {x}, {Qs[1], Qs[2]});
+    sim.NamedOperation("CRY", {-x}, {Qs[2], Qs[0]});
+    sim.NamedOperation("PhaseShift", {x}, {Qs[1]}, false, {Qs[0]}, {false});
+    sim.NamedOperation("MultiRZ", {x / 3}, {Qs[0], Qs[1], Qs[2]});
+    sim.NamedOperation("Toffoli", {}, {Qs[0], Qs[1], Qs[2]});
+    sim.MatrixOperation(matrix, {Qs[1]}, false, {Qs[2]}, {true});
+}
+} // namespace
+
+TEST_CASE("Test batched execution with the LightningSimulator", "[Batch]")
+{
+    constexpr size_t n = 3;
+    const std::vector<double> xs{0.1, 0.7, 1.3, 2.9};
+    const size_t batch_size = xs.size();
+
+    // The expected results of each lane, from the unbatched simulator
+    std::vector<double> expvals(batch_size);
+    std::vector<double> vars(batch_size);
+    std::vector<std::vector<std::complex<double>>> states(batch_size);
+    std::vector<std::vector<double>> probs(batch_size);
+    for (size_t l = 0; l < batch_size; l++) {
+        auto sim = std::make_unique<LightningSimulator>();
+        auto Qs = sim->AllocateQubits(n);
+        applyCircuit(*sim, Qs, xs[l]);
+
+        auto x0 = sim->Observable(ObsId::PauliX, {}, {Qs[0]});
+        auto y1 = sim->Observable(ObsId::PauliY, {}, {Qs[1]});
+        auto h2 = sim->Observable(ObsId::Hadamard, {}, {Qs[2]});
+        auto tp = sim->TensorObservable({x0, y1});
+        auto ham = sim->HamiltonianObservable({xs[l], 0.5}, {tp, h2});
+        expvals[l] = sim->Expval(ham);
+        vars[l] = sim->Var(ham);
+
+        states[l].resize(1U << n);
+        DataView<std::complex<double>, 1> state_view(states[l]);
+        sim->State(state_view);
+
+        probs[l].resize(4);
+        DataView<double, 1> probs_view(probs[l]);
+        sim->PartialProbs(probs_view, {Qs[2], Qs[0]});
+    }
+
+    auto sim = std::make_unique<LightningSimulator>();
+    sim->StartBatch(batch_size);
+
+    // Recording and replay sweeps
+    for (size_t sweep = 0; sweep < 2; sweep++) {
+        for (size_t l = 0; l < batch_size; l++) {
+            sim->SetBatchLane(l);
+            auto Qs = sim->AllocateQubits(n);
+            applyCircuit(*sim, Qs, xs[l]);
+
+            auto x0 = sim->Observable(ObsId::PauliX, {}, {Qs[0]});
+            auto y1 = sim->Observable(ObsId::PauliY, {}, {Qs[1]});
+            auto h2 = sim->Observable(ObsId::Hadamard, {}, {Qs[2]});
+            auto tp = sim->TensorObservable({x0, y1});
+            auto ham = sim->HamiltonianObservable({xs[l], 0.5}, {tp, h2});
+            double expval = sim->Expval(ham);
+            double var = sim->Var(ham);
+
+            std::vector<std::complex<double>> state(1U << n);
+            DataView<std::complex<double>, 1> state_view(state);
+            sim->State(state_view);
+
+            std::vector<double> partial_probs(4);
+            DataView<double, 1> probs_view(partial_probs);
+            sim->PartialProbs(probs_view, {Qs[2], Qs[0]});
+
+            sim->ReleaseAllQubits();
+
+            if (!sweep) {
+                continue;
+            }
+
+            CHECK(expval == Approx(expvals[l]).margin(1e-7));
+            CHECK(var == Approx(vars[l]).margin(1e-7));
+            for (size_t i = 0; i < state.size(); i++) {
+                CHECK(state[i].real() == Approx(states[l][i].real()).margin(1e-7));
+                CHECK(state[i].imag() == Approx(states[l][i].imag()).margin(1e-7));
+            }
+            for (size_t i = 0; i < partial_probs.size(); i++) {
+                CHECK(partial_probs[i] == Approx(probs[l][i]).margin(1e-7));
+            }
+        }
+
+        if (!sweep) {
+            sim->ExecuteBatch();
+        }
+    }
+
+    sim->StopBatch();
+}
+
+TEST_CASE("Test batched execution of the excitation gates", "[Batch]")
+{
+    constexpr size_t n = 4;
+    const std::vector<double> xs{0.3, 1.7, 2.4};
+    const size_t batch_size = xs.size();
+
+    auto apply = [](QuantumDevice &sim, const std::vector<QubitIdType> &Qs, double x) {
+        for (auto q : Qs) {
+            sim.NamedOperation("Hadamard", {}, {q});
+        }
+        sim.NamedOperation("RY", {x}, {Qs[1]});
+        sim.NamedOperation("SingleExcitation", {x}, {Qs[3], Qs[1]});
+        sim.NamedOperation("SingleExcitationMinus", {2 * x}, {Qs[0], Qs[3]}, true);
+        sim.NamedOperation("SingleExcitationPlus", {3 * x}, {Qs[2], Qs[1]});
+        sim.NamedOperation("DoubleExcitation", {x}, {Qs[2], Qs[0], Qs[3], Qs[1]});
+        sim.NamedOperation("DoubleExcitationMinus", {2 * x}, {Qs[0], Qs[1], Qs[2], Qs[3]});
+        sim.NamedOperation("DoubleExcitationPlus", {3 * x}, {Qs[1], Qs[3], Qs[0], Qs[2]}, true);
+    };
+
+    std::vector<std::vector<std::complex<double>>> states(batch_size);
+    for (size_t l = 0; l < batch_size; l++) {
+        auto sim = std::make_unique<LightningSimulator>();
+        auto Qs = sim->AllocateQubits(n);
+        apply(*sim, Qs, xs[l]);
+        states[l].resize(1U << n);
+        DataView<std::complex<double>, 1> state_view(states[l]);
+        sim->State(state_view);
+    }
+
+    auto sim = std::make_unique<LightningSimulator>();
+    sim->StartBatch(batch_size);
+    for (size_t sweep = 0; sweep < 2; sweep++) {
+        for (size_t l = 0; l < batch_size; l++) {
+            sim->SetBatchLane(l);
+            auto Qs = sim->AllocateQubits(n);
+            apply(*sim, Qs, xs[l]);
+
+            std::vector<std::complex<double>> state(1U << n);
+            DataView<std::complex<double>, 1> state_view(state);
+            sim->State(state_view);
+            sim->ReleaseAllQubits();
+
+            for (size_t i = 0; sweep && i < state.size(); i++) {
+                CHECK(state[i].real() == Approx(states[l][i].real()).margin(1e-7));
+                CHECK(state[i].imag() == Approx(states[l][i].imag()).margin(1e-7));
+            }
+        }
+
+        if (!sweep) {
+            sim->ExecuteBatch();
+        }
+    }
+    sim->StopBatch();
+}
+
+TEST_CASE("Test batched execution through the runtime C-API", "[Batch]")
+{
+    const std::vector<double> xs{0.2, 1.1, 2.5};
+    const int64_t batch_size = static_cast<int64_t>(xs.size());
+    std::vector<double> results(xs.size());
+
+    __catalyst__rt__initialize();
+    for (const auto &[rtd_lib, rtd_name, rtd_kwargs] : getDevices()) {
+        if (rtd_name != "lightning.qubit") {
+            continue;
+        }
+
+        auto run = [&, &rtd_lib = rtd_lib, &rtd_name = rtd_name,
+                    &rtd_kwargs = rtd_kwargs](double x) {
+            __catalyst__rt__device_init((int8_t *)rtd_lib.c_str(), (int8_t *)rtd_name.c_str(),
+                                        (int8_t *)rtd_kwargs.c_str());
+            QirArray *qs = __catalyst__rt__qubit_allocate_array(2);
+            QUBIT **q0 = (QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 0);
+            QUBIT **q1 = (QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 1);
+
+            __catalyst__qis__RX(x, *q0, NO_MODIFIERS);
+            __catalyst__qis__CNOT(*q0, *q1, NO_MODIFIERS);
+            __catalyst__qis__RY(x / 2, *q1, NO_MODIFIERS);
+            double res = __catalyst__qis__Expval(__catalyst__qis__NamedObs(ObsId::PauliZ, *q1));
+
+            __catalyst__rt__qubit_release_array(qs);
+            __catalyst__rt__device_release();
+            return res;
+        };
+
+        __catalyst__rt__batch_begin(batch_size);
+        for (int64_t l = 0; l < batch_size; l++) {
+            __catalyst__rt__batch_lane(l);
+            run(xs[l]);
+        }
+        __catalyst__rt__batch_execute();
+        for (int64_t l = 0; l < batch_size; l++) {
+            __catalyst__rt__batch_lane(l);
+            results[l] = run(xs[l]);
+        }
+        __catalyst__rt__batch_end();
+
+        for (size_t l = 0; l < xs.size(); l++) {
+            CHECK(results[l] == Approx(std::cos(xs[l]) * std::cos(xs[l] / 2)).margin(1e-7));
+            CHECK(run(xs[l]) == Approx(results[l]).margin(1e-7));
+        }
+    }
+    __catalyst__rt__finalize();
+}
+
+TEST_CASE("Test batched execution with mismatching lanes", "[Batch]")
+{
+    auto sim = std::make_unique<LightningSimulator>();
+    sim->StartBatch(2);
+
+    sim->SetBatchLane(0);
+    auto Qs = sim->AllocateQubits(2);
+    sim->NamedOperation("RX", {0.1}, {Qs[0]});
+    sim->ReleaseAllQubits();
+
+    sim->SetBatchLane(1);
+    Qs = sim->AllocateQubits(2);
+    REQUIRE_THROWS_WITH(sim->NamedOperation("RY", {0.1}, {Qs[0]}),
+                        Catch::Contains("Batch lanes must apply the same gates"));
+    REQUIRE_THROWS_WITH(sim->ExecuteBatch(),
+                        Catch::Contains("Batch lanes must apply the same gates and measurements"));
+}
+
+TEST_CASE("Test unsupported instructions in batched execution", "[Batch]")
+{
+    auto sim = std::make_unique<LightningSimulator>();
+    sim->StartBatch(2);
+    sim->SetBatchLane(0);
+    auto Qs = sim->AllocateQubits(2);
+
+    REQUIRE_THROWS_WITH(sim->Measure(Qs[0], std::nullopt),
+                        Catch::Contains("not supported in batched execution"));
+    REQUIRE_THROWS_WITH(sim->Observable(ObsId::Hermitian, {1, 0, 0, 1}, {Qs[0]}),
+                        Catch::Contains("not supported in batched execution"));
+    REQUIRE_THROWS_WITH(sim->NamedOperation("OrbitalRotation", {0.1}, {Qs[0], Qs[1]}),
+                        Catch::Contains("Unsupported gate in batched execution"));
+
+    std::vector<double> samples(2);
+    size_t sizes[2] = {1, 2};
+    size_t strides[2] = {2, 1};
+    DataView<double, 2> samples_view(samples.data(), 0, sizes, strides);
+    REQUIRE_THROWS_WITH(sim->Sample(samples_view, 1),
+                        Catch::Contains("not supported in batched execution"));
+
+    REQUIRE_THROWS_WITH(std::make_unique<LightningSimulator>("{shots: 10}")->StartBatch(2),
+                        Catch::Contains("only supported in analytic mode"));
+}
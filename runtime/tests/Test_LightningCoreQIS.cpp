@@ -221,6 +221,31 @@ TEST_CASE("Qubits: allocate, release, dump", "[CoreQIS]")
     __catalyst__rt__finalize();
 }
 
+TEST_CASE("Qubits: direct access through the array layout", "[CoreQIS]")
+{
+    __catalyst__rt__initialize();
+    for (const auto &[rtd_lib, rtd_name, rtd_kwargs] : getDevices()) {
+        __catalyst__rt__device_init((int8_t *)rtd_lib.c_str(), (int8_t *)rtd_name.c_str(),
+                                    (int8_t *)rtd_kwargs.c_str());
+
+        QirArray *qs = __catalyst__rt__qubit_allocate_array(4);
+
+        // This is how the compiler lowers `quantum.extract`.
+        QirQubitArray *qs_layout = reinterpret_cast<QirQubitArray *>(qs);
+        CHECK(qs_layout->size == __catalyst__rt__array_get_size_1d(qs));
+        for (int64_t idx = 0; idx < qs_layout->size; idx++) {
+            QubitIdType *elem_ptr =
+                reinterpret_cast<QubitIdType *>(__catalyst__rt__array_get_element_ptr_1d(qs, idx));
+            CHECK(elem_ptr == &qs_layout->data[idx]);
+            CHECK(*elem_ptr == qs_layout->data[idx]);
+        }
+
+        __catalyst__rt__qubit_release_array(qs);
+        __catalyst__rt__device_release();
+    }
+    __catalyst__rt__finalize();
+}
+
 TEST_CASE("Test lightning__core__qis methods", "[CoreQIS]")
 {
     __catalyst__rt__initialize();
@@ -1430,6 +1455,81 @@ TEST_CASE("Test __catalyst__qis__MultiRZ", "[CoreQIS]")
     }
 }
 
+TEST_CASE("Test __catalyst__qis__MultiRZ_array and Probs_array", "[CoreQIS]")
+{
+    for (const auto &[rtd_lib, rtd_name, rtd_kwargs] : getDevices()) {
+        __catalyst__rt__initialize();
+        __catalyst__rt__device_init((int8_t *)rtd_lib.c_str(), (int8_t *)rtd_name.c_str(),
+                                    (int8_t *)rtd_kwargs.c_str());
+
+        QirArray *qs = __catalyst__rt__qubit_allocate_array(2);
+
+        // The qubit array is laid out as a contiguous array of qubits.
+        QUBIT **qubits = (QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 0);
+
+        __catalyst__qis__RX(M_PI, qubits[0], NO_MODIFIERS);
+        __catalyst__qis__Hadamard(qubits[0], NO_MODIFIERS);
+        __catalyst__qis__Hadamard(qubits[1], NO_MODIFIERS);
+        __catalyst__qis__MultiRZ_array(M_PI, NO_MODIFIERS, 2, qubits);
+        __catalyst__qis__Hadamard(qubits[0], NO_MODIFIERS);
+        __catalyst__qis__Hadamard(qubits[1], NO_MODIFIERS);
+
+        size_t buffer_len = 4;
+        double *buffer = new double[buffer_len];
+        MemRefT_double_1d result = {buffer, buffer, 0, {buffer_len}, {1}};
+        __catalyst__qis__Probs_array(&result, 2, qubits);
+
+        CHECK(buffer[0] == Approx(0.0).margin(1e-5));
+        CHECK(buffer[1] == Approx(1.0).margin(1e-5));
+        CHECK(buffer[2] == Approx(0.0).margin(1e-5));
+        CHECK(buffer[3] == Approx(0.0).margin(1e-5));
+
+        delete[] buffer;
+        __catalyst__rt__qubit_release_array(qs);
+        __catalyst__rt__device_release();
+        __catalyst__rt__finalize();
+    }
+}
+
+TEST_CASE("Test __catalyst__qis__HamiltonianObs_array(t) and Expval", "[CoreQIS]")
+{
+    for (const auto &[rtd_lib, rtd_name, rtd_kwargs] : getDevices()) {
+        __catalyst__rt__initialize();
+        __catalyst__rt__device_init((int8_t *)rtd_lib.c_str(), (int8_t *)rtd_name.c_str(),
+                                    (int8_t *)rtd_kwargs.c_str());
+
+        QirArray *qs = __catalyst__rt__qubit_allocate_array(2);
+
+        QUBIT **target = (QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 0);
+        QUBIT **ctrls = (QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 1);
+
+        __catalyst__qis__Hadamard(*target, NO_MODIFIERS);
+        __catalyst__qis__Hadamard(*ctrls, NO_MODIFIERS);
+        __catalyst__qis__IsingYY(0.6, *ctrls, *target, NO_MODIFIERS);
+        __catalyst__qis__CRX(0.3, *ctrls, *target, NO_MODIFIERS);
+
+        auto obs_x = __catalyst__qis__NamedObs(ObsId::PauliX, *target);
+
+        CplxT_double matrix_data[4] = {{1.0, 0.0}, {0.0, 3.0}, {2.0, 0.0}, {0.0, 5.0}};
+        MemRefT_CplxT_double_2d h_matrix = {matrix_data, matrix_data, 0, {2, 2}, {1, 0}};
+
+        auto obs_h = __catalyst__qis__HermitianObs_array(&h_matrix, 1, ctrls);
+        ObsIdType terms[2] = {obs_h, obs_x};
+        auto obs_t = __catalyst__qis__TensorObs_array(2, terms);
+
+        double coeffs_data[1] = {0.4};
+        MemRefT_double_1d coeffs = {coeffs_data, coeffs_data, 0, {1}, {1}};
+        auto obs_hamiltonian = __catalyst__qis__HamiltonianObs_array(&coeffs, 1, &obs_t);
+
+        // Same observable as the variadic "HamiltonianObs(t) and Expval" test case.
+        CHECK(__catalyst__qis__Expval(obs_hamiltonian) == Approx(0.6345775219).margin(1e-5));
+
+        __catalyst__rt__qubit_release_array(qs);
+        __catalyst__rt__device_release();
+        __catalyst__rt__finalize();
+    }
+}
+
 TEST_CASE("Test __catalyst__qis__CSWAP ", "[CoreQIS]")
 {
     for (const auto &[rtd_lib, rtd_name, rtd_kwargs] : getDevices()) {
@@ -1549,6 +1649,84 @@ TEST_CASE("Test __catalyst__qis__Counts with num_qubits=2 PartialCounts calling
     }
 }
 
+TEST_CASE("Test __catalyst__qis__SparseCounts_array with num_qubits=2", "[CoreQIS]")
+{
+    for (const auto &[rtd_lib, rtd_name, rtd_kwargs] : getDevices()) {
+        __catalyst__rt__initialize();
+        __catalyst__rt__device_init((int8_t *)rtd_lib.c_str(), (int8_t *)rtd_name.c_str(),
+                                    (int8_t *)rtd_kwargs.c_str());
+
+        QirArray *qs = __catalyst__rt__qubit_allocate_array(2);
+
+        QUBIT **target = (QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 0);
+        QUBIT **ctrls = (QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 1);
+
+        // qml.PauliX(wires=0)
+        __catalyst__qis__PauliX(*target, NO_MODIFIERS);
+
+        constexpr size_t shots = 3;
+
+        // Only the bitstring 10 is observed, and the other entries are padding
+        PairT_MemRefT_double_int64_1d result = getCounts(shots);
+        QUBIT *qubits[2] = {*target, *ctrls};
+        __catalyst__qis__SparseCounts_array(&result, shots, 2, qubits);
+        double *eigvals = result.first.data_allocated;
+        int64_t *counts = result.second.data_allocated;
+
+        CHECK((eigvals[0] == 2. && eigvals[1] == -1. && eigvals[2] == -1.));
+        CHECK((counts[0] == 3 && counts[1] == 0 && counts[2] == 0));
+
+        // The partial counts of wire 1 only observe the bitstring 0
+        __catalyst__qis__SparseCounts_array(&result, shots, 1, &qubits[1]);
+        CHECK((eigvals[0] == 0. && eigvals[1] == -1. && eigvals[2] == -1.));
+        CHECK((counts[0] == 3 && counts[1] == 0 && counts[2] == 0));
+
+        freeCounts(result);
+        __catalyst__rt__qubit_release_array(qs);
+        __catalyst__rt__device_release();
+        __catalyst__rt__finalize();
+    }
+}
+
+TEST_CASE("Test __catalyst__qis__PackedSample_array with num_qubits=2", "[CoreQIS]")
+{
+    for (const auto &[rtd_lib, rtd_name, rtd_kwargs] : getDevices()) {
+        __catalyst__rt__initialize();
+        __catalyst__rt__device_init((int8_t *)rtd_lib.c_str(), (int8_t *)rtd_name.c_str(),
+                                    (int8_t *)rtd_kwargs.c_str());
+
+        QirArray *qs = __catalyst__rt__qubit_allocate_array(2);
+
+        QUBIT **target = (QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 0);
+        QUBIT **ctrls = (QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 1);
+
+        // qml.PauliX(wires=0)
+        __catalyst__qis__PauliX(*target, NO_MODIFIERS);
+
+        constexpr size_t shots = 10;
+
+        int64_t buffer[shots];
+        MemRefT_int64_1d result = {buffer, buffer, 0, {shots}, {1}};
+        QUBIT *qubits[2] = {*target, *ctrls};
+
+        // Every sample is the bitstring 10
+        __catalyst__qis__PackedSample_array(&result, shots, 2, qubits);
+        for (size_t i = 0; i < shots; i++) {
+            CHECK(buffer[i] == 2);
+        }
+
+        // The partial samples of wire 0 are the bitstring 1
+        __catalyst__qis__PackedSample_array(&result, shots, 1, qubits);
+        for (size_t i = 0; i < shots; i++) {
+            CHECK(buffer[i] == 1);
+        }
+
+        __catalyst__rt__qubit_release_array(qs);
+        __catalyst__rt__device_release();
+        __catalyst__rt__finalize();
+    }
+}
+
 TEST_CASE("Test __catalyst__qis__Sample with num_qubits=2 calling Hadamard, ControlledPhaseShift, "
           "IsingYY, and CRX quantum operations",
           "[CoreQIS]")
@@ -940,3 +940,190 @@ TEMPLATE_LIST_TEST_CASE("IsingZZ Gate Test", "[GateSet]", SimTypes)
     CHECK(state.at(3).real() == Approx(0.4619397663).epsilon(1e-5));
     CHECK(state.at(3).imag() == Approx(-0.1913417162).epsilon(1e-5));
 }
+
+TEMPLATE_LIST_TEST_CASE("QFT matches its gate decomposition", "[GateSet]", SimTypes)
+{
+    constexpr size_t n = 5;
+    std::unique_ptr<TestType> sim = std::make_unique<TestType>();
+    std::unique_ptr<TestType> ref = std::make_unique<TestType>();
+    std::vector<QubitIdType> Qs = sim->AllocateQubits(n);
+    std::vector<QubitIdType> Rs = ref->AllocateQubits(n);
+
+    for (size_t i = 0; i < n; i++) {
+        sim->NamedOperation("RX", {0.3 * (i + 1)}, {Qs[i]}, false);
+        sim->NamedOperation("RZ", {0.7 * (i + 1)}, {Qs[i]}, false);
+        ref->NamedOperation("RX", {0.3 * (i + 1)}, {Rs[i]}, false);
+        ref->NamedOperation("RZ", {0.7 * (i + 1)}, {Rs[i]}, false);
+    }
+
+    // Contiguous wires, then non-contiguous wires in a non-monotonic order.
+    for (bool inverse : {false, true}) {
+        sim->QFT({Qs[1], Qs[2], Qs[3]}, inverse);
+        ref->QuantumDevice::QFT({Rs[1], Rs[2], Rs[3]}, inverse);
+        sim->QFT({Qs[4], Qs[0], Qs[2]}, inverse);
+        ref->QuantumDevice::QFT({Rs[4], Rs[0], Rs[2]}, inverse);
+    }
+    sim->QFT(Qs, false);
+    ref->QuantumDevice::QFT(Rs, false);
+
+    std::vector<std::complex<double>> state(1U << n);
+    std::vector<std::complex<double>> expected(1U << n);
+    DataView<std::complex<double>, 1> view(state);
+    DataView<std::complex<double>, 1> expected_view(expected);
+    sim->State(view);
+    ref->State(expected_view);
+
+    for (size_t i = 0; i < state.size(); i++) {
+        CHECK(state[i].real() == Approx(expected[i].real()).margin(1e-10));
+        CHECK(state[i].imag() == Approx(expected[i].imag()).margin(1e-10));
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("PauliRotation matches its gate decomposition", "[GateSet]", SimTypes)
+{
+    constexpr size_t n = 4;
+    std::unique_ptr<TestType> sim = std::make_unique<TestType>();
+    std::unique_ptr<TestType> ref = std::make_unique<TestType>();
+    std::vector<QubitIdType> Qs = sim->AllocateQubits(n);
+    std::vector<QubitIdType> Rs = ref->AllocateQubits(n);
+
+    for (size_t i = 0; i < n; i++) {
+        sim->NamedOperation("RX", {0.3 * (i + 1)}, {Qs[i]}, false);
+        sim->NamedOperation("RZ", {0.7 * (i + 1)}, {Qs[i]}, false);
+        ref->NamedOperation("RX", {0.3 * (i + 1)}, {Rs[i]}, false);
+        ref->NamedOperation("RZ", {0.7 * (i + 1)}, {Rs[i]}, false);
+    }
+
+    // Diagonal and non-diagonal words, on wires in a non-monotonic order.
+    const std::vector<std::pair<std::string, std::vector<size_t>>> rotations = {
+        {"XYZ", {2, 0, 3}}, {"ZZ", {1, 3}}, {"YIXY", {3, 2, 1, 0}}, {"Y", {1}}, {"IZ", {0, 2}}};
+    for (bool inverse : {false, true}) {
+        double theta = 0.4;
+        for (const auto &[word, idx] : rotations) {
+            std::vector<QubitIdType> sim_wires;
+            std::vector<QubitIdType> ref_wires;
+            for (size_t i : idx) {
+                sim_wires.push_back(Qs[i]);
+                ref_wires.push_back(Rs[i]);
+            }
+            sim->PauliRotation(word, theta, sim_wires, inverse);
+            ref->QuantumDevice::PauliRotation(word, theta, ref_wires, inverse);
+            theta += 0.45;
+        }
+    }
+
+    std::vector<std::complex<double>> state(1U << n);
+    std::vector<std::complex<double>> expected(1U << n);
+    DataView<std::complex<double>, 1> view(state);
+    DataView<std::complex<double>, 1> expected_view(expected);
+    sim->State(view);
+    ref->State(expected_view);
+
+    for (size_t i = 0; i < state.size(); i++) {
+        CHECK(state[i].real() == Approx(expected[i].real()).margin(1e-10));
+        CHECK(state[i].imag() == Approx(expected[i].imag()).margin(1e-10));
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("SetState and SetBasisState prepare a subset of wires", "[GateSet]",
+                        SimTypes)
+{
+    constexpr size_t n = 3;
+    std::unique_ptr<TestType> sim = std::make_unique<TestType>();
+    std::vector<QubitIdType> Qs = sim->AllocateQubits(n);
+
+    // Wire 1 is left in a superposition, and the amplitudes of the state are given in the order
+    // of the wires (2, 0).
+    sim->NamedOperation("RX", {0.5}, {Qs[1]}, false);
+    const std::complex<double> rx[2] = {{std::cos(0.25), 0}, {0, -std::sin(0.25)}};
+    std::vector<std::complex<double>> psi = {{0, 0.5}, {0.5, 0}, {-0.5, 0}, {0, -0.5}};
+    DataView<std::complex<double>, 1> psi_view(psi);
+    sim->SetState(psi_view, {Qs[2], Qs[0]});
+
+    std::vector<std::complex<double>> state(1U << n);
+    DataView<std::complex<double>, 1> view(state);
+    sim->State(view);
+    for (size_t i = 0; i < state.size(); i++) {
+        const size_t a = ((i & 1) << 1) | (i >> 2);
+        const std::complex<double> expected = psi[a] * rx[(i >> 1) & 1];
+        CHECK(state[i].real() == Approx(expected.real()).margin(1e-10));
+        CHECK(state[i].imag() == Approx(expected.imag()).margin(1e-10));
+    }
+
+    // The devices that do not prepare states natively have them decomposed by the frontend.
+    std::unique_ptr<TestType> other = std::make_unique<TestType>();
+    std::vector<QubitIdType> Os = other->AllocateQubits(n);
+    REQUIRE_THROWS_WITH(other->QuantumDevice::SetState(psi_view, {Os[2], Os[0]}),
+                        Catch::Contains("State preparation is not supported by this device"));
+
+    std::unique_ptr<TestType> basis = std::make_unique<TestType>();
+    std::unique_ptr<TestType> ref = std::make_unique<TestType>();
+    std::vector<QubitIdType> Bs = basis->AllocateQubits(n);
+    std::vector<QubitIdType> Rs = ref->AllocateQubits(n);
+    basis->NamedOperation("RX", {0.5}, {Bs[1]}, false);
+    ref->NamedOperation("RX", {0.5}, {Rs[1]}, false);
+
+    std::vector<int8_t> bits = {1, 0};
+    DataView<int8_t, 1> bits_view(bits);
+    basis->SetBasisState(bits_view, {Bs[2], Bs[0]});
+    ref->QuantumDevice::SetBasisState(bits_view, {Rs[2], Rs[0]});
+
+    std::vector<std::complex<double>> expected(1U << n);
+    DataView<std::complex<double>, 1> expected_view(expected);
+    basis->State(view);
+    ref->State(expected_view);
+    for (size_t i = 0; i < state.size(); i++) {
+        CHECK(state[i].real() == Approx(expected[i].real()).margin(1e-10));
+        CHECK(state[i].imag() == Approx(expected[i].imag()).margin(1e-10));
+    }
+}
+
+TEMPLATE_TEST_CASE("Unentangled qubits are held as a product state", "[GateSet]",
+                   LightningSimulator)
+{
+    constexpr size_t n = 5;
+    const std::complex<double> i{0, 1};
+    const std::vector<std::complex<double>> matrix{std::cos(0.3), -i * std::sin(0.3),
+                                                   -i * std::sin(0.3), std::cos(0.3)};
+
+    // Tapes see every gate, so that the reference applies them to the dense state.
+    auto run = [&](TestType &sim, bool dense, bool grow) {
+        if (dense) {
+            sim.StartTapeRecording();
+        }
+        std::vector<QubitIdType> Qs = sim.AllocateQubits(n);
+        sim.NamedOperation("Hadamard", {}, {Qs[0]}, false);
+        sim.NamedOperation("RX", {0.4}, {Qs[1]}, false);
+        sim.NamedOperation("RY", {0.7}, {Qs[2]}, true);
+        sim.MatrixOperation(matrix, {Qs[3]}, false);
+        sim.NamedOperation("GlobalPhase", {0.2}, {}, false);
+        sim.NamedOperation("CNOT", {}, {Qs[0], Qs[1]}, false);
+        sim.NamedOperation("RZ", {0.9}, {Qs[3]}, false, {Qs[2]}, {true});
+        sim.PauliRotation("XY", 0.5, {Qs[1], Qs[4]});
+        sim.NamedOperation("IsingXX", {0.6}, {Qs[3], Qs[0]}, false);
+        if (grow) {
+            Qs.push_back(sim.AllocateQubit());
+            sim.NamedOperation("CNOT", {}, {Qs[2], Qs[n]}, false);
+        }
+        sim.NamedOperation("CRY", {0.8}, {Qs[4], Qs[2]}, false);
+
+        std::vector<std::complex<double>> state(size_t{1} << Qs.size());
+        DataView<std::complex<double>, 1> view(state);
+        sim.State(view);
+        if (dense) {
+            sim.StopTapeRecording();
+        }
+        return state;
+    };
+
+    for (bool grow : {false, true}) {
+        std::unique_ptr<TestType> sim = std::make_unique<TestType>("{product_state : True}");
+        std::unique_ptr<TestType> ref = std::make_unique<TestType>("{product_state : True}");
+        auto &&state = run(*sim, false, grow);
+        auto &&expected = run(*ref, true, grow);
+        for (size_t idx = 0; idx < state.size(); idx++) {
+            CHECK(state[idx].real() == Approx(expected[idx].real()).margin(1e-10));
+            CHECK(state[idx].imag() == Approx(expected[idx].imag()).margin(1e-10));
+        }
+    }
+}
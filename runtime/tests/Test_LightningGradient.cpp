@@ -799,3 +799,55 @@ TEST_CASE("Test __catalyst__qis__Gradient with QubitUnitary", "[Gradient]")
     delete[] buffer;
     delete[] buffer_tp;
 }
+
+TEST_CASE("Test __catalyst__qis__Gradient with PauliRot", "[Gradient]")
+{
+    const double param = M_PI / 5;
+    // PauliRot(XYZ) |000> = cos(theta/2) |000> - i sin(theta/2) XYZ |000>, with
+    // XYZ |000> = i |110>, so <Z0> = cos^2(theta/2) - sin^2(theta/2) = cos(theta)
+    const double expected = -std::sin(param);
+
+    std::vector<int64_t> trainParams{0};
+    size_t J = trainParams.size();
+    double *buffer = new double[J];
+    MemRefT_double_1d result = {buffer, buffer, 0, {J}, {1}};
+    double *buffer_tp = new double[J];
+    MemRefT_double_1d result_tp = {buffer_tp, buffer_tp, 0, {J}, {1}};
+    int64_t *buffer_memref = trainParams.data();
+    MemRefT_int64_1d tp_memref = {buffer_memref, buffer_memref, 0, {trainParams.size()}, {1}};
+
+    __catalyst__rt__initialize();
+    for (const auto &[rtd_lib, rtd_name, rtd_kwargs] : getDevices()) {
+        __catalyst__rt__device_init((int8_t *)rtd_lib.c_str(), (int8_t *)rtd_name.c_str(),
+                                    (int8_t *)rtd_kwargs.c_str());
+
+        QirArray *qs = __catalyst__rt__qubit_allocate_array(3);
+        QUBIT *wires[3] = {*(QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 0),
+                           *(QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 1),
+                           *(QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 2)};
+
+        __catalyst__rt__toggle_recorder(/* activate_cm */ true);
+
+        __catalyst__qis__PauliRot(param, "XYZ", NO_MODIFIERS, 3, wires);
+
+        auto obs_idx_0 = __catalyst__qis__NamedObs(ObsId::PauliZ, wires[0]);
+
+        __catalyst__qis__Expval(obs_idx_0);
+
+        __catalyst__qis__Gradient_params(&tp_memref, 1, &result_tp);
+
+        __catalyst__qis__Gradient(1, &result);
+
+        __catalyst__rt__toggle_recorder(/* activate_cm */ false);
+
+        CHECK(expected == Approx(result_tp.data_aligned[0]).margin(1e-5));
+        CHECK(expected == Approx(result.data_aligned[0]).margin(1e-5));
+
+        __catalyst__rt__qubit_release_array(qs);
+        __catalyst__rt__device_release();
+    }
+    __catalyst__rt__finalize();
+
+    delete[] buffer;
+    delete[] buffer_tp;
+}
@@ -1691,6 +1691,84 @@ TEMPLATE_LIST_TEST_CASE(
         CHECK((samples4[i] == 0. || samples4[i] == 1.));
 }
 
+TEST_CASE("Philox4x32 matches the reference outputs", "[Measures]")
+{
+    // Known-answer tests of Philox4x32-10 from the Random123 distribution
+    using CounterT = Philox4x32::CounterT;
+    CHECK(Philox4x32{0}({0, 0, 0, 0}) == CounterT{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8});
+    CHECK(Philox4x32{0x299f31d0a4093822}({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}) ==
+          CounterT{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1});
+}
+
+TEST_CASE("Seeded Sample is reproducible for any number of threads", "[Measures]")
+{
+    constexpr size_t n = 4;
+    constexpr size_t shots = 10000;
+
+    auto run = [](const std::string &kwargs) {
+        std::unique_ptr<LightningSimulator> sim = std::make_unique<LightningSimulator>(kwargs);
+        std::vector<QubitIdType> Qs = sim->AllocateQubits(n);
+
+        sim->NamedOperation("RX", {0.5}, {Qs[0]}, false);
+        sim->NamedOperation("Hadamard", {}, {Qs[1]}, false);
+        sim->NamedOperation("CNOT", {}, {Qs[0], Qs[1]}, false);
+
+        std::vector<double> samples(shots * n);
+        MemRefT<double, 2> buffer{samples.data(), samples.data(), 0, {shots, n}, {1, 1}};
+        DataView<double, 2> view(buffer.data_aligned, buffer.offset, buffer.sizes, buffer.strides);
+        sim->Sample(view, shots);
+        return samples;
+    };
+
+    auto &&samples1 = run("{seed : 37, num_threads : 1}");
+    auto &&samples2 = run("{seed : 37, num_threads : 3}");
+    auto &&samples3 = run("{seed : 37, num_threads : 8}");
+    auto &&samples4 = run("{seed : 38, num_threads : 8}");
+
+    CHECK(samples1 == samples2);
+    CHECK(samples1 == samples3);
+    CHECK(samples1 != samples4);
+
+    for (const auto *kwargs : {"{seed : abc}", "{seed : -1}", "{seed : 12x}",
+                               "{seed : 18446744073709551616}"}) {
+        REQUIRE_THROWS_WITH(std::make_unique<LightningSimulator>(kwargs),
+                            Catch::Contains("Invalid device seed"));
+    }
+    for (const auto *kwargs : {"{num_threads : four}", "{num_threads : -2}", "{num_threads : 2.5}"}) {
+        REQUIRE_THROWS_WITH(std::make_unique<LightningSimulator>(kwargs),
+                            Catch::Contains("Invalid number of device threads"));
+    }
+}
+
+TEST_CASE("SetDeviceSeed restarts the sampling streams", "[Measures]")
+{
+    std::unique_ptr<LightningSimulator> sim = std::make_unique<LightningSimulator>();
+
+    constexpr size_t n = 2;
+    constexpr size_t shots = 100;
+    std::vector<QubitIdType> Qs = sim->AllocateQubits(n);
+    sim->NamedOperation("Hadamard", {}, {Qs[0]}, false);
+    sim->NamedOperation("Hadamard", {}, {Qs[1]}, false);
+
+    auto sample = [&sim]() {
+        std::vector<double> samples(shots * n);
+        MemRefT<double, 2> buffer{samples.data(), samples.data(), 0, {shots, n}, {1, 1}};
+        DataView<double, 2> view(buffer.data_aligned, buffer.offset, buffer.sizes, buffer.strides);
+        sim->Sample(view, shots);
+        return samples;
+    };
+
+    sim->SetDeviceSeed(5);
+    auto &&samples1 = sample();
+    // a second call draws from a fresh stream
+    auto &&samples2 = sample();
+    sim->SetDeviceSeed(5);
+    auto &&samples3 = sample();
+
+    CHECK(samples1 != samples2);
+    CHECK(samples1 == samples3);
+}
+
 TEMPLATE_LIST_TEST_CASE("Counts and PartialCounts tests with numWires=0-4 shots=100", "[Measures]",
                         SimTypes)
 {
@@ -1757,3 +1835,259 @@ TEMPLATE_LIST_TEST_CASE("Counts and PartialCounts tests with numWires=0-4 shots=
     CHECK(sum3 == shots);
     CHECK(sum4 == shots);
 }
+
+TEST_CASE("SparseCounts and PartialSparseCounts match the dense counts", "[Measures]")
+{
+    std::unique_ptr<LightningSimulator> sim =
+        std::make_unique<LightningSimulator>("{num_threads : 4}");
+
+    constexpr size_t n = 4;
+    constexpr size_t shots = 5000;
+    std::vector<QubitIdType> Qs = sim->AllocateQubits(n);
+
+    sim->NamedOperation("RX", {0.5}, {Qs[0]}, false);
+    sim->NamedOperation("Hadamard", {}, {Qs[1]}, false);
+    sim->NamedOperation("CNOT", {}, {Qs[0], Qs[1]}, false);
+    sim->NamedOperation("RY", {1.3}, {Qs[3]}, false);
+
+    auto check = [&](const std::vector<QubitIdType> &wires) {
+        const size_t numElements = size_t{1} << (wires.empty() ? n : wires.size());
+
+        std::vector<double> eigvals(numElements);
+        std::vector<int64_t> counts(numElements);
+        DataView<double, 1> eview(eigvals);
+        DataView<int64_t, 1> cview(counts);
+        sim->SetDeviceSeed(11);
+        if (wires.empty()) {
+            sim->Counts(eview, cview, shots);
+        }
+        else {
+            sim->PartialCounts(eview, cview, wires, shots);
+        }
+
+        std::vector<double> sparse_eigvals(shots);
+        std::vector<int64_t> sparse_counts(shots);
+        DataView<double, 1> sparse_eview(sparse_eigvals);
+        DataView<int64_t, 1> sparse_cview(sparse_counts);
+        sim->SetDeviceSeed(11);
+        if (wires.empty()) {
+            sim->SparseCounts(sparse_eview, sparse_cview, shots);
+        }
+        else {
+            sim->PartialSparseCounts(sparse_eview, sparse_cview, wires, shots);
+        }
+
+        // The observed bitstrings come first in increasing order, followed by padding.
+        size_t idx = 0;
+        for (size_t i = 0; i < numElements; i++) {
+            if (counts[i] == 0) {
+                continue;
+            }
+            CHECK(sparse_eigvals[idx] == eigvals[i]);
+            CHECK(sparse_counts[idx] == counts[i]);
+            idx++;
+        }
+        for (; idx < shots; idx++) {
+            CHECK(sparse_eigvals[idx] == -1.0);
+            CHECK(sparse_counts[idx] == 0);
+        }
+    };
+
+    check({});
+    check({Qs[2]});
+    check({Qs[3], Qs[0]});
+    check(Qs);
+
+    std::vector<double> eigvals(16);
+    std::vector<int64_t> counts(16);
+    DataView<double, 1> eview(eigvals);
+    DataView<int64_t, 1> cview(counts);
+    REQUIRE_THROWS_WITH(sim->SparseCounts(eview, cview, shots),
+                        Catch::Contains("Invalid size for the pre-allocated sparse counts"));
+}
+
+TEST_CASE("PackedSample and PartialPackedSample match the unpacked samples", "[Measures]")
+{
+    std::unique_ptr<LightningSimulator> sim =
+        std::make_unique<LightningSimulator>("{num_threads : 4}");
+
+    constexpr size_t n = 4;
+    constexpr size_t shots = 5000;
+    std::vector<QubitIdType> Qs = sim->AllocateQubits(n);
+
+    sim->NamedOperation("RX", {0.5}, {Qs[0]}, false);
+    sim->NamedOperation("Hadamard", {}, {Qs[1]}, false);
+    sim->NamedOperation("CNOT", {}, {Qs[0], Qs[1]}, false);
+    sim->NamedOperation("RY", {1.3}, {Qs[3]}, false);
+
+    auto check = [&](const std::vector<QubitIdType> &wires) {
+        const size_t numWires = wires.empty() ? n : wires.size();
+
+        std::vector<double> samples(shots * numWires);
+        MemRefT<double, 2> buffer{samples.data(), samples.data(), 0, {shots, numWires}, {1, 1}};
+        DataView<double, 2> view(buffer.data_aligned, buffer.offset, buffer.sizes, buffer.strides);
+        sim->SetDeviceSeed(11);
+        if (wires.empty()) {
+            sim->Sample(view, shots);
+        }
+        else {
+            sim->PartialSample(view, wires, shots);
+        }
+
+        std::vector<int64_t> packed(shots);
+        DataView<int64_t, 1> packed_view(packed);
+        sim->SetDeviceSeed(11);
+        if (wires.empty()) {
+            sim->PackedSample(packed_view, shots);
+        }
+        else {
+            sim->PartialPackedSample(packed_view, wires, shots);
+        }
+
+        // The first wire is the most significant bit of each packed sample.
+        for (size_t shot = 0; shot < shots; shot++) {
+            int64_t expected = 0;
+            for (size_t wire = 0; wire < numWires; wire++) {
+                expected = (expected << 1) | static_cast<int64_t>(samples[shot * numWires + wire]);
+            }
+            CHECK(packed[shot] == expected);
+        }
+    };
+
+    check({});
+    check({Qs[2]});
+    check({Qs[3], Qs[0]});
+    check(Qs);
+
+    std::vector<int64_t> packed(shots - 1);
+    DataView<int64_t, 1> packed_view(packed);
+    REQUIRE_THROWS_WITH(sim->PackedSample(packed_view, shots),
+                        Catch::Contains("Invalid size for the pre-allocated packed samples"));
+}
+
+TEST_CASE("Grouped shot-based measurements share their samples", "[Measures]")
+{
+    std::unique_ptr<LightningSimulator> sim = std::make_unique<LightningSimulator>("{seed : 7}");
+
+    constexpr size_t n = 3;
+    constexpr size_t num_shots = 10000;
+    std::vector<QubitIdType> Qs = sim->AllocateQubits(n);
+
+    // Bell state on wires 0 and 1, and |+i> on wire 2
+    sim->NamedOperation("Hadamard", {}, {Qs[0]}, false);
+    sim->NamedOperation("CNOT", {}, {Qs[0], Qs[1]}, false);
+    sim->NamedOperation("Hadamard", {}, {Qs[2]}, false);
+    sim->NamedOperation("S", {}, {Qs[2]}, false);
+
+    ObsIdType z0 = sim->Observable(ObsId::PauliZ, {}, {Qs[0]});
+    ObsIdType z1 = sim->Observable(ObsId::PauliZ, {}, {Qs[1]});
+    ObsIdType x0 = sim->Observable(ObsId::PauliX, {}, {Qs[0]});
+    ObsIdType x1 = sim->Observable(ObsId::PauliX, {}, {Qs[1]});
+    ObsIdType y2 = sim->Observable(ObsId::PauliY, {}, {Qs[2]});
+    ObsIdType x0x1 = sim->TensorObservable({x0, x1});
+    ObsIdType h = sim->HamiltonianObservable({0.5, 2.0}, {z0, y2});
+
+    sim->SetDeviceShots(num_shots);
+    sim->GroupMeasurements({z0, z1, h, x0x1, z0});
+
+    // Z0 and Z1 are perfectly correlated, and so are their estimates from the same samples.
+    double ez0 = sim->Expval(z0);
+    CHECK(ez0 == Approx(0).margin(5e-2));
+    CHECK(sim->Expval(z1) == ez0);
+    CHECK(sim->Var(z0) == Approx(1 - ez0 * ez0).margin(1e-12));
+
+    // Y2 is sampled in its eigenbasis along with Z0.
+    CHECK(sim->Expval(h) == Approx(0.5 * ez0 + 2.0).margin(1e-12));
+    CHECK(sim->Expval(x0x1) == Approx(1).margin(1e-12));
+
+    // Measurements that are not grouped, or no longer pending, draw their own samples.
+    CHECK(sim->Expval(x0) == Approx(0).margin(5e-2));
+    CHECK(sim->Expval(z1) == Approx(0).margin(5e-2));
+
+    // Analytic measurements are never grouped.
+    sim->SetDeviceShots(0);
+    sim->GroupMeasurements({z0, h});
+    CHECK(sim->Expval(h) == Approx(2.0).margin(1e-7));
+}
+
+TEST_CASE("ExpvalVar matches Expval and Var", "[Measures]")
+{
+    std::unique_ptr<LightningSimulator> sim = std::make_unique<LightningSimulator>();
+
+    constexpr size_t n = 3;
+    std::vector<QubitIdType> Qs = sim->AllocateQubits(n);
+
+    sim->NamedOperation("RX", {0.7}, {Qs[0]}, false);
+    sim->NamedOperation("RY", {0.3}, {Qs[1]}, false);
+    sim->NamedOperation("CNOT", {}, {Qs[1], Qs[2]}, false);
+    sim->NamedOperation("Hadamard", {}, {Qs[2]}, false);
+
+    std::vector<std::complex<double>> mat{{1.0, 0.0}, {0.5, -0.2}, {0.5, 0.2}, {-2.0, 0.0}};
+
+    ObsIdType her = sim->Observable(ObsId::Hermitian, mat, {Qs[0]});
+    ObsIdType px = sim->Observable(ObsId::PauliX, {}, {Qs[2]});
+    ObsIdType pz = sim->Observable(ObsId::PauliZ, {}, {Qs[1]});
+    ObsIdType tzx = sim->TensorObservable({pz, px});
+    ObsIdType h = sim->HamiltonianObservable({0.4, -1.3, 0.9}, {her, tzx, px});
+
+    for (ObsIdType obs : {her, tzx, h}) {
+        auto [expval, variance] = sim->ExpvalVar(obs);
+        CHECK(expval == Approx(sim->Expval(obs)).margin(1e-7));
+        CHECK(variance == Approx(sim->Var(obs)).margin(1e-7));
+    }
+}
+
+TEST_CASE("Shadow estimates Pauli words of a Bell state", "[Measures]")
+{
+    std::unique_ptr<LightningSimulator> sim =
+        std::make_unique<LightningSimulator>("{num_threads : 4}");
+
+    constexpr size_t n = 3;
+    constexpr size_t shots = 20000;
+    std::vector<QubitIdType> Qs = sim->AllocateQubits(n);
+
+    // Bell state on wires 0 and 2, and |1> on wire 1
+    sim->NamedOperation("Hadamard", {}, {Qs[0]}, false);
+    sim->NamedOperation("CNOT", {}, {Qs[0], Qs[2]}, false);
+    sim->NamedOperation("PauliX", {}, {Qs[1]}, false);
+
+    auto shadow = [&](const std::vector<QubitIdType> &wires) {
+        std::vector<int64_t> records(shots * 2);
+        size_t sizes[2] = {shots, 2};
+        size_t strides[2] = {2, 1};
+        DataView<int64_t, 2> view(records.data(), 0, sizes, strides);
+        sim->SetDeviceSeed(5);
+        sim->Shadow(view, wires, shots);
+        return records;
+    };
+
+    auto &&records = shadow({Qs[2], Qs[0]});
+    CHECK(records == shadow({Qs[2], Qs[0]}));
+
+    // Every shot measures each wire in the X (1), Y (2) or Z (3) basis, and the outcomes of the
+    // Bell state agree in the same X or Z bases.
+    for (size_t shot = 0; shot < shots; shot++) {
+        const int64_t bases = records[2 * shot];
+        const int64_t outcomes = records[2 * shot + 1];
+        CHECK((bases >> 2) >= 1);
+        CHECK((bases & 3) >= 1);
+        if (bases == 0b0101 || bases == 0b1111) {
+            CHECK((outcomes == 0b00 || outcomes == 0b11));
+        }
+    }
+
+    using Lightning::estimateShadowExpval;
+    CHECK(estimateShadowExpval(records, "II") == Approx(1.0));
+    CHECK(estimateShadowExpval(records, "XX") == Approx(1.0).margin(0.15));
+    CHECK(estimateShadowExpval(records, "YY") == Approx(-1.0).margin(0.15));
+    CHECK(estimateShadowExpval(records, "ZZ") == Approx(1.0).margin(0.15));
+    CHECK(estimateShadowExpval(records, "ZI") == Approx(0.0).margin(0.1));
+    CHECK(estimateShadowExpval(records, "XZ") == Approx(0.0).margin(0.15));
+
+    // No wires denote the entire wires.
+    auto &&all_records = shadow({});
+    CHECK(estimateShadowExpval(all_records, "IZI") == Approx(-1.0).margin(0.1));
+
+    REQUIRE_THROWS_WITH(estimateShadowExpval(records, "XA"),
+                        Catch::Contains("Invalid Pauli word to estimate from a classical shadow"));
+}
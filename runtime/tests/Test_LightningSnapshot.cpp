@@ -0,0 +1,289 @@
+// Copyright 2024 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <array>
+#include <cmath>
+#include <numbers>
+#include <tuple>
+
+#include "RuntimeCAPI.h"
+#include "Types.h"
+
+#include "LightningSimulator.hpp"
+#include "QuantumDevice.hpp"
+
+#include "TestUtils.hpp"
+
+using namespace Catalyst::Runtime;
+using namespace Catalyst::Runtime::Simulator;
+
+namespace {
+// The number of gate parameters of the circuit below
+constexpr size_t num_params = 5;
+
+// Run a circuit whose gate parameters are shifted by `shifts`, marking every parametrized gate
+// with a checkpoint as the parameter-shift rule does, and return the expectation value of Z0 Z2.
+double runShiftedCircuit(QuantumDevice &sim, const std::vector<double> &shifts)
+{
+    const std::complex<double> i{0, 1};
+    const std::vector<std::complex<double>> matrix{std::cos(0.4), -i * std::sin(0.4),
+                                                   -i * std::sin(0.4), std::cos(0.4)};
+
+    auto Qs = sim.AllocateQubits(3);
+
+    sim.NamedOperation("Hadamard", {}, {Qs[0]});
+    sim.Checkpoint(shifts[0] != 0);
+    sim.NamedOperation("RX", {0.3 + shifts[0]}, {Qs[1]});
+    sim.NamedOperation("CNOT", {}, {Qs[0], Qs[2]});
+    sim.MatrixOperation(matrix, {Qs[2]}, false, {Qs[1]}, {true});
+    sim.Checkpoint(shifts[1] != 0 || shifts[2] != 0);
+    sim.NamedOperation("Rot", {0.5 + shifts[1], -0.7 + shifts[2], 0.2}, {Qs[2]});
+    sim.QFT({Qs[0], Qs[1]});
+    sim.Checkpoint(shifts[3] != 0);
+    sim.PauliRotation("XZ", 1.1 + shifts[3], {Qs[1], Qs[2]});
+    sim.Checkpoint(shifts[4] != 0);
+    sim.NamedOperation("CRY", {0.9 + shifts[4]}, {Qs[0], Qs[2]});
+
+    auto z0 = sim.Observable(ObsId::PauliZ, {}, {Qs[0]});
+    auto z2 = sim.Observable(ObsId::PauliZ, {}, {Qs[2]});
+    double res = sim.Expval(sim.TensorObservable({z0, z2}));
+
+    sim.ReleaseAllQubits();
+    return res;
+}
+
+// Compute the parameter-shift gradient of the circuit above.
+std::vector<double> shiftedGradient(QuantumDevice &sim)
+{
+    constexpr double shift = std::numbers::pi / 2;
+
+    std::vector<double> gradient(num_params);
+    for (size_t p = 0; p < num_params; p++) {
+        std::vector<double> shifts(num_params, 0);
+        shifts[p] = shift;
+        double pos = runShiftedCircuit(sim, shifts);
+        shifts[p] = -shift;
+        double neg = runShiftedCircuit(sim, shifts);
+        gradient[p] = (pos - neg) / 2;
+    }
+    return gradient;
+}
+
+// Run a circuit with two mid-circuit measurements, the second one depending on the outcome of the
+// first one, and return the outcomes with the expectation value of Z1 Z2.
+std::tuple<bool, bool, double> runMeasuredCircuit(QuantumDevice &sim)
+{
+    auto Qs = sim.AllocateQubits(3);
+
+    sim.NamedOperation("Hadamard", {}, {Qs[0]});
+    sim.NamedOperation("RX", {0.7}, {Qs[1]});
+    bool m0 = *sim.Measure(Qs[0], std::nullopt);
+    if (m0) {
+        sim.NamedOperation("CNOT", {}, {Qs[0], Qs[2]});
+    }
+    else {
+        sim.NamedOperation("RY", {1.2}, {Qs[2]});
+    }
+    sim.NamedOperation("CRX", {0.5}, {Qs[1], Qs[2]});
+    bool m1 = *sim.Measure(Qs[2], std::nullopt);
+    sim.NamedOperation("Hadamard", {}, {Qs[1]});
+
+    auto z1 = sim.Observable(ObsId::PauliZ, {}, {Qs[1]});
+    auto z2 = sim.Observable(ObsId::PauliZ, {}, {Qs[2]});
+    double res = sim.Expval(sim.TensorObservable({z1, z2}));
+
+    sim.ReleaseAllQubits();
+    return {m0, m1, res};
+}
+} // namespace
+
+TEST_CASE("Test state snapshots with the LightningSimulator", "[Snapshot]")
+{
+    auto sim = std::make_unique<LightningSimulator>();
+    auto Qs = sim->AllocateQubits(2);
+
+    sim->NamedOperation("Hadamard", {}, {Qs[0]});
+    sim->NamedOperation("CRX", {0.7}, {Qs[0], Qs[1]});
+
+    std::vector<std::complex<double>> expected(4);
+    DataView<std::complex<double>, 1> expected_view(expected);
+    sim->State(expected_view);
+
+    size_t id = sim->Snapshot();
+
+    // Restoring a snapshot does not consume it
+    for (size_t run = 0; run < 2; run++) {
+        sim->NamedOperation("PauliY", {}, {Qs[1]});
+        sim->NamedOperation("RZ", {0.3}, {Qs[0]});
+        sim->Restore(id);
+
+        std::vector<std::complex<double>> state(4);
+        DataView<std::complex<double>, 1> state_view(state);
+        sim->State(state_view);
+        for (size_t i = 0; i < state.size(); i++) {
+            CHECK(state[i].real() == Approx(expected[i].real()).margin(1e-7));
+            CHECK(state[i].imag() == Approx(expected[i].imag()).margin(1e-7));
+        }
+    }
+
+    sim->ReleaseSnapshot(id);
+    REQUIRE_THROWS_WITH(sim->Restore(id), Catch::Contains("Invalid snapshot id"));
+    REQUIRE_THROWS_WITH(sim->ReleaseSnapshot(id), Catch::Contains("Invalid snapshot id"));
+
+    id = sim->Snapshot();
+    Qs.push_back(sim->AllocateQubit());
+    REQUIRE_THROWS_WITH(sim->Restore(id), Catch::Contains("Cannot restore a snapshot of a "
+                                                          "different number of qubits"));
+}
+
+TEST_CASE("Test sharing the prefix of shifted circuits with the LightningSimulator", "[Snapshot]")
+{
+    // Without checkpoints, every shifted circuit is simulated from the initial state.
+    std::vector<double> expected(num_params);
+    for (size_t p = 0; p < num_params; p++) {
+        std::vector<double> shifts(num_params, 0);
+        shifts[p] = std::numbers::pi / 2;
+        double pos = runShiftedCircuit(*std::make_unique<LightningSimulator>(), shifts);
+        shifts[p] = -std::numbers::pi / 2;
+        double neg = runShiftedCircuit(*std::make_unique<LightningSimulator>(), shifts);
+        expected[p] = (pos - neg) / 2;
+    }
+
+    auto sim = std::make_unique<LightningSimulator>();
+
+    // The gradient is the same in every pass: the first pass enables the prefix cache, and the
+    // next passes start from the snapshot taken by the previous pass.
+    for (size_t pass = 0; pass < 3; pass++) {
+        auto &&gradient = shiftedGradient(*sim);
+        for (size_t p = 0; p < num_params; p++) {
+            CHECK(gradient[p] == Approx(expected[p]).margin(1e-7));
+        }
+    }
+
+    // The unshifted circuit skips the entire prefix and restores the snapshot.
+    std::vector<double> shifts(num_params, 0);
+    auto ref = std::make_unique<LightningSimulator>();
+    CHECK(runShiftedCircuit(*sim, shifts) == Approx(runShiftedCircuit(*ref, shifts)).margin(1e-7));
+
+    // Circuits that diverge from the prefix before reaching the snapshot are replayed.
+    auto Qs = sim->AllocateQubits(3);
+    sim->NamedOperation("Hadamard", {}, {Qs[0]});
+    sim->NamedOperation("CNOT", {}, {Qs[0], Qs[1]});
+    std::vector<double> probs(4);
+    DataView<double, 1> probs_view(probs);
+    sim->PartialProbs(probs_view, {Qs[0], Qs[1]});
+    CHECK(probs[0] == Approx(0.5).margin(1e-7));
+    CHECK(probs[3] == Approx(0.5).margin(1e-7));
+    sim->ReleaseAllQubits();
+
+    // That execution reached no checkpoint, which disabled the cache and released its snapshot.
+    // The next gradients enable it again.
+    for (size_t pass = 0; pass < 2; pass++) {
+        auto &&gradient = shiftedGradient(*sim);
+        for (size_t p = 0; p < num_params; p++) {
+            CHECK(gradient[p] == Approx(expected[p]).margin(1e-7));
+        }
+    }
+
+    // An empty QFT is not traced, and leaves the state unchanged.
+    Qs = sim->AllocateQubits(2);
+    sim->NamedOperation("Hadamard", {}, {Qs[0]});
+    sim->QFT({});
+    sim->PartialProbs(probs_view, {Qs[0], Qs[1]});
+    CHECK(probs[0] == Approx(0.5).margin(1e-7));
+    CHECK(probs[2] == Approx(0.5).margin(1e-7));
+    sim->ReleaseAllQubits();
+}
+
+TEST_CASE("Test checkpoints through the runtime C-API", "[Snapshot]")
+{
+    __catalyst__rt__initialize();
+    for (const auto &[rtd_lib, rtd_name, rtd_kwargs] : getDevices()) {
+        auto run = [&, &rtd_lib = rtd_lib, &rtd_name = rtd_name,
+                    &rtd_kwargs = rtd_kwargs](double x, double y, bool shifted) {
+            __catalyst__rt__device_init((int8_t *)rtd_lib.c_str(), (int8_t *)rtd_name.c_str(),
+                                        (int8_t *)rtd_kwargs.c_str());
+            QirArray *qs = __catalyst__rt__qubit_allocate_array(2);
+            QUBIT **q0 = (QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 0);
+            QUBIT **q1 = (QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 1);
+
+            __catalyst__qis__RX(x, *q0, NO_MODIFIERS);
+            __catalyst__qis__CNOT(*q0, *q1, NO_MODIFIERS);
+            __catalyst__rt__checkpoint(shifted);
+            __catalyst__qis__RY(y, *q1, NO_MODIFIERS);
+            double res = __catalyst__qis__Expval(__catalyst__qis__NamedObs(ObsId::PauliZ, *q1));
+
+            __catalyst__rt__qubit_release_array(qs);
+            __catalyst__rt__device_release();
+            return res;
+        };
+
+        for (double y : {0.1, 0.1 + std::numbers::pi / 2, 0.1 - std::numbers::pi / 2}) {
+            CHECK(run(0.4, y, y != 0.1) == Approx(std::cos(0.4) * std::cos(y)).margin(1e-7));
+        }
+    }
+    __catalyst__rt__finalize();
+}
+
+TEST_CASE("Test sharing the branches of mid-circuit measurements with the LightningSimulator",
+          "[Snapshot]")
+{
+    // The branch cache draws the outcomes from the same probabilities and random numbers, so the
+    // executions of the same circuit return the same results with or without it.
+    auto sim = std::make_unique<LightningSimulator>("{seed : 11, mcm_branching : True}");
+    auto ref = std::make_unique<LightningSimulator>("{seed : 11}");
+
+    std::array<size_t, 2> num_ones{0, 0};
+    constexpr size_t num_runs = 200;
+    for (size_t run = 0; run < num_runs; run++) {
+        auto &&[m0, m1, res] = runMeasuredCircuit(*sim);
+        auto &&[ref_m0, ref_m1, ref_res] = runMeasuredCircuit(*ref);
+        CHECK(m0 == ref_m0);
+        CHECK(m1 == ref_m1);
+        CHECK(res == Approx(ref_res).margin(1e-7));
+        num_ones[0] += m0;
+        num_ones[1] += m1;
+    }
+
+    // The first measurement is a fair coin, and every branch is reached.
+    CHECK(num_ones[0] > num_runs / 4);
+    CHECK(num_ones[0] < 3 * num_runs / 4);
+    CHECK(num_ones[1] > 0);
+    CHECK(num_ones[1] < num_runs);
+
+    // With shots, the expectation values are estimated from samples, but the outcomes of the
+    // measurements are still drawn from the exact probabilities in both cases.
+    auto shots_sim =
+        std::make_unique<LightningSimulator>("{seed : 11, shots : 100, mcm_branching : True}");
+    auto shots_ref = std::make_unique<LightningSimulator>("{seed : 11, shots : 100}");
+    for (size_t run = 0; run < num_runs; run++) {
+        auto &&[m0, m1, res] = runMeasuredCircuit(*shots_sim);
+        auto &&[ref_m0, ref_m1, ref_res] = runMeasuredCircuit(*shots_ref);
+        CHECK(m0 == ref_m0);
+        CHECK(m1 == ref_m1);
+    }
+
+    // Other instructions end the walk of the branches, and leave the state simulated as usual.
+    auto Qs = sim->AllocateQubits(3);
+    sim->NamedOperation("Hadamard", {}, {Qs[0]});
+    sim->NamedOperation("CNOT", {}, {Qs[0], Qs[1]});
+    std::vector<double> probs(4);
+    DataView<double, 1> probs_view(probs);
+    sim->PartialProbs(probs_view, {Qs[0], Qs[1]});
+    CHECK(probs[0] == Approx(0.5).margin(1e-7));
+    CHECK(probs[3] == Approx(0.5).margin(1e-7));
+    bool m = *sim->Measure(Qs[0]);
+    CHECK(m == *sim->Measure(Qs[1]));
+    sim->ReleaseAllQubits();
+}